@@ -0,0 +1,568 @@
+/**
+ * @file bench.cpp
+ * @brief Benchmarks dos subsistemas que não dependem de OpenGL
+ *
+ * Cada caso roda alguns quadros de aquecimento e depois mede tempo e
+ * alocações por quadro. Compilado pelo `make bench` com
+ * -DRASTREAR_ALOCACOES: casos marcados como "sem alocação" que alocarem
+ * em regime permanente fazem o programa sair com código 1.
+ *
+ * No fim, uma partida roteirizada em ponto fixo precisa terminar com
+ * CHECKSUM_Q16_16: o valor é o mesmo em qualquer compilador, CPU e flag
+ * de otimização. Se mudar, a simulação perdeu o determinismo entre builds
+ * (ou mudou de propósito, e a constante precisa ser atualizada).
+ *
+ * A triangulação de contornos (Triangulador) também é conferida: a soma
+ * das áreas dos triângulos precisa bater com a área do contorno, e o SAT
+ * vetorizado precisa dar as mesmas colisões e MTVs do escalar. O
+ * AlocadorFaixas (faixas das malhas nos VBOs compartilhados) precisa voltar
+ * a uma faixa livre só depois de liberar tudo. A ordenação radix das chaves
+ * de desenho precisa dar a mesma ordem de um std::stable_sort.
+ *
+ * Uso: ./bench_app [filtro]   (roda só os casos cujo nome contém o filtro)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "core/AlocadorFaixas.hpp"
+#include "core/ArenaQuadro.hpp"
+#include "core/RastreioAlocacoes.hpp"
+#include "core/SistemaJobs.hpp"
+#include "fisica/ColisaoSAT.hpp"
+#include "fisica/MundoFisico.hpp"
+#include "geometry/Triangulacao.hpp"
+#include "jogo/LotePartidas.hpp"
+#include "jogo/OponenteIA.hpp"
+#include "jogo/Partida.hpp"
+#include "render/ChavesDesenho.hpp"
+
+static const int QUADROS_AQUECIMENTO = 30;
+static const int QUADROS_MEDIDOS = 200;
+
+/// Um caso de benchmark: uma função que executa um "quadro" de trabalho
+struct CasoBench {
+    const char* nome;
+    bool exigeZeroAlocacoes;       ///< Regressão se alocar em regime permanente
+    std::function<void()> quadro;
+};
+
+struct ResultadoBench {
+    double msPorQuadro;
+    double alocacoesPorQuadro;
+    double bytesPorQuadro;
+};
+
+static ResultadoBench medir(const CasoBench& caso, ArenaQuadro& arena) {
+    for (int i = 0; i < QUADROS_AQUECIMENTO; i++) {
+        caso.quadro();
+        arena.reiniciar();
+    }
+
+    size_t alocacoes = 0;
+    size_t bytes = 0;
+    double segundos = 0.0;
+    for (int i = 0; i < QUADROS_MEDIDOS; i++) {
+        iniciarQuadroAlocacoes();
+        auto inicio = std::chrono::steady_clock::now();
+        caso.quadro();
+        auto fim = std::chrono::steady_clock::now();
+        arena.reiniciar();
+
+        ContagemAlocacoes c = alocacoesTotaisDoQuadro();
+        alocacoes += c.alocacoes;
+        bytes += c.bytes;
+        segundos += std::chrono::duration<double>(fim - inicio).count();
+    }
+    return ResultadoBench{
+        segundos * 1000.0 / QUADROS_MEDIDOS,
+        static_cast<double>(alocacoes) / QUADROS_MEDIDOS,
+        static_cast<double>(bytes) / QUADROS_MEDIDOS
+    };
+}
+
+// ========== Partida Roteirizada ==========
+
+static const uint64_t SEMENTE_ROTEIRO = 4242;
+static const uint32_t TICKS_ROTEIRO = 120 * 60 * 5;   // 5 minutos de jogo
+static const uint64_t CHECKSUM_Q16_16 = 0xb5183dc924ad065eull;
+
+/// Os dois jogadores seguem a bola (comparando no próprio tipo T) e às vezes erram
+template<typename T>
+static uint8_t entradaRoteiro(const EstadoPartidaT<T>& e) {
+    uint32_t h = (e.tick / 30) * 2654435761u;
+    h ^= h >> 13;
+    const T margem = escalar<T>(0.03f);
+    uint8_t entradas = 0;
+    for (int i = 0; i < 2; i++) {
+        if ((h >> (i * 8)) % 5 == 0) continue;   // distraído
+        if (e.bolaY > e.raqueteY[i] + margem) entradas |= i == 0 ? ENTRADA_P1_CIMA : ENTRADA_P2_CIMA;
+        if (e.bolaY < e.raqueteY[i] - margem) entradas |= i == 0 ? ENTRADA_P1_BAIXO : ENTRADA_P2_BAIXO;
+    }
+    return entradas;
+}
+
+template<typename T>
+static uint64_t checksumRoteiro(EstadoPartidaT<T>* final) {
+    PartidaT<T> partida(SEMENTE_ROTEIRO);
+    for (uint32_t t = 0; t < TICKS_ROTEIRO; t++) partida.passo(entradaRoteiro(partida.getEstado()));
+    *final = partida.getEstado();
+    return partida.checksum();
+}
+
+// ========== Lote de Partidas ==========
+
+static const size_t PARTIDAS_LOTE = 4096;
+
+/// Bot de treino: segue a bola com um erro que muda a cada meio segundo
+static uint8_t entradaTreino(float bolaY, float raquete0, float raquete1, uint32_t partida, uint32_t tick) {
+    uint8_t entradas = 0;
+    const float raquete[2] = { raquete0, raquete1 };
+    for (int j = 0; j < 2; j++) {
+        uint32_t h = (partida * 2 + j) * 2654435761u ^ (tick / 60) * 40503u;
+        h ^= h >> 15;
+        h *= 0x2c1b3c6du;
+        h ^= h >> 12;
+        float alvo = bolaY + (static_cast<float>(h & 0xff) / 255.0f - 0.5f) * 0.6f;
+        if (alvo > raquete[j] + 0.02f) entradas |= j == 0 ? ENTRADA_P1_CIMA : ENTRADA_P2_CIMA;
+        if (alvo < raquete[j] - 0.02f) entradas |= j == 0 ? ENTRADA_P1_BAIXO : ENTRADA_P2_BAIXO;
+    }
+    return entradas;
+}
+
+static void entradasDoLote(const LotePartidas& lote, uint32_t tick, std::vector<uint8_t>& entradas) {
+    const float* bolaY = lote.getBolaY();
+    const float* r0 = lote.getRaqueteY(0);
+    const float* r1 = lote.getRaqueteY(1);
+    for (size_t i = 0; i < lote.getNumPartidas(); i++) {
+        entradas[i] = entradaTreino(bolaY[i], r0[i], r1[i], static_cast<uint32_t>(i), tick);
+    }
+}
+
+/// O lote precisa seguir bit a bit partidas escalares com as mesmas sementes e entradas
+static bool loteConfereComEscalar(size_t partidas, uint32_t ticks) {
+    const uint64_t base = 99;
+    LotePartidas lote(partidas, 1000000, base);
+    std::vector<PartidaT<float>> escalares;
+    for (size_t i = 0; i < partidas; i++) escalares.emplace_back(LotePartidas::semente(base, i, 0));
+    std::vector<uint8_t> entradas(partidas);
+    for (uint32_t t = 0; t < ticks; t++) {
+        entradasDoLote(lote, t, entradas);
+        lote.passo(entradas.data());
+        for (size_t i = 0; i < partidas; i++) {
+            const EstadoPartidaT<float>& e = escalares[i].getEstado();
+            escalares[i].passo(entradaTreino(e.bolaY, e.raqueteY[0], e.raqueteY[1], static_cast<uint32_t>(i), t));
+        }
+    }
+    PartidaT<float> comparacao;
+    for (size_t i = 0; i < partidas; i++) {
+        comparacao.restaurar(lote.getEstado(i));
+        if (comparacao.checksum() != escalares[i].checksum()) return false;
+    }
+    return true;
+}
+
+static void preencherMundo(MundoFisico& mundo, int corpos, float raio) {
+    std::mt19937 gerador(7);
+    std::uniform_real_distribution<float> pos(-0.95f, 0.95f);
+    std::uniform_real_distribution<float> vel(-0.5f, 0.5f);
+    for (int i = 0; i < corpos; i++) {
+        mundo.adicionarCorpo(pos(gerador), pos(gerador), vel(gerador), vel(gerador), raio);
+    }
+}
+
+// ========== Triangulação ==========
+
+/**
+ * Contorno de fase côncavo: raio com ondulações largas, médias e um pouco
+ * de ruído. `ruido` 1 sorteia o raio de cada ponto (pior caso do corte de
+ * orelhas: quase metade dos vértices reflexos, dentes em todo lugar).
+ */
+static std::vector<float> contornoFase(size_t pontos, float ruido) {
+    std::mt19937 gerador(11);
+    std::uniform_real_distribution<float> sorteio(-1.0f, 1.0f);
+    std::vector<float> contorno(pontos * 2);
+    for (size_t i = 0; i < pontos; i++) {
+        float angulo = 6.2831853f * static_cast<float>(i) / static_cast<float>(pontos);
+        float ondas = 0.15f * std::sin(7.0f * angulo) + 0.08f * std::sin(31.0f * angulo);
+        float raio = 0.75f + (1.0f - ruido) * ondas + (0.02f + 0.23f * ruido) * sorteio(gerador);
+        contorno[i * 2] = raio * std::cos(angulo);
+        contorno[i * 2 + 1] = raio * std::sin(angulo);
+    }
+    return contorno;
+}
+
+/// A soma das áreas dos triângulos bate com a área (fórmula do laço) do contorno?
+static bool triangulosCobremContorno(const std::vector<float>& xy, const std::vector<uint32_t>& indices) {
+    size_t n = xy.size() / 2;
+    double areaContorno = 0.0;
+    for (size_t i = 0, j = n - 1; i < n; j = i++) {
+        areaContorno += static_cast<double>(xy[j * 2]) * xy[i * 2 + 1] - static_cast<double>(xy[i * 2]) * xy[j * 2 + 1];
+    }
+    double areaTriangulos = 0.0;
+    for (size_t t = 0; t < indices.size(); t += 3) {
+        const float* a = &xy[indices[t] * 2];
+        const float* b = &xy[indices[t + 1] * 2];
+        const float* c = &xy[indices[t + 2] * 2];
+        areaTriangulos += std::fabs((static_cast<double>(b[0]) - a[0]) * (static_cast<double>(c[1]) - a[1]) -
+                                    (static_cast<double>(c[0]) - a[0]) * (static_cast<double>(b[1]) - a[1]));
+    }
+    return indices.size() == (n - 2) * 3 && std::fabs(areaTriangulos - std::fabs(areaContorno)) <= 1e-6 * areaTriangulos;
+}
+
+// ========== SAT ==========
+
+static const size_t PARES_SAT = 10000;
+
+/**
+ * Pares de polígonos convexos (triângulos, retângulos girados, hexágonos,
+ * octógonos) com o segundo perto do primeiro: cerca de metade colide, e
+ * os pares que colidem testam todos os eixos.
+ */
+static std::vector<PoligonoConvexo> paresSAT() {
+    std::mt19937 gerador(23);
+    std::uniform_real_distribution<float> pos(-0.9f, 0.9f);
+    std::uniform_real_distribution<float> perto(-0.15f, 0.15f);
+    std::uniform_real_distribution<float> tamanho(0.04f, 0.1f);
+    std::uniform_real_distribution<float> angulo(0.0f, 6.2831853f);
+    std::vector<PoligonoConvexo> poligonos(PARES_SAT * 2);
+    for (size_t i = 0; i < poligonos.size(); i++) {
+        float cx = pos(gerador);
+        float cy = pos(gerador);
+        if (i % 2 == 1) {
+            cx = poligonos[i - 1].x[0] + perto(gerador);
+            cy = poligonos[i - 1].y[0] + perto(gerador);
+        }
+        switch (gerador() % 4) {
+            case 0: poligonos[i].regular(cx, cy, 3, tamanho(gerador), angulo(gerador)); break;
+            case 1: poligonos[i].retangulo(cx, cy, tamanho(gerador), tamanho(gerador) * 0.5f, angulo(gerador)); break;
+            case 2: poligonos[i].regular(cx, cy, 6, tamanho(gerador), angulo(gerador)); break;
+            default: poligonos[i].regular(cx, cy, 8, tamanho(gerador), angulo(gerador)); break;
+        }
+    }
+    return poligonos;
+}
+
+// ========== Faixas de Malhas ==========
+
+static const size_t FAIXAS_VIVAS = 10000;
+static const uint32_t VERTICES_FAIXAS = 2u << 20;   ///< Espaço com folga para ~10k malhas de até 200 vértices
+
+/// Tamanho de malha sorteado: de um triângulo a um círculo de 200 segmentos
+static uint32_t tamanhoMalha(std::mt19937& gerador) {
+    return 3 + gerador() % 198;
+}
+
+// ========== Chaves de Desenho ==========
+
+/// Fila de um quadro cheio: 4 camadas, 1 em 8 translúcido, 64 materiais, 16 texturas
+static std::vector<ItemOrdenacao> chavesQuadro(size_t n) {
+    std::mt19937 gerador(13);
+    std::uniform_real_distribution<float> profundidade(0.0f, 1.0f);
+    std::vector<ItemOrdenacao> itens(n);
+    for (size_t i = 0; i < n; i++) {
+        CamposChave campos;
+        campos.camada = static_cast<uint8_t>(gerador() % 4);
+        campos.translucido = gerador() % 8 == 0;
+        campos.programa = static_cast<uint16_t>(gerador() % 64);
+        campos.textura = static_cast<uint16_t>(gerador() % 16);
+        campos.profundidade = profundidade(gerador);
+        itens[i] = { montarChave(campos), static_cast<uint32_t>(i) };
+    }
+    return itens;
+}
+
+static bool menorChave(const ItemOrdenacao& a, const ItemOrdenacao& b) {
+    return a.chave < b.chave;
+}
+
+int main(int argc, char** argv) {
+    const char* filtro = argc > 1 ? argv[1] : nullptr;
+
+    SistemaJobs jobs;
+    ArenaQuadro arena(64 * 1024);
+    const float dt = 1.0f / 60.0f;
+
+    MundoFisico mundoSequencial;
+    MundoFisico mundoParalelo;
+    preencherMundo(mundoSequencial, 10000, 0.004f);
+    preencherMundo(mundoParalelo, 10000, 0.004f);
+
+    std::vector<float> dados(1 << 16, 1.0f);
+
+    PartidaT<float> partidaFloat(SEMENTE_ROTEIRO);
+    PartidaT<Q16_16> partidaFixo(SEMENTE_ROTEIRO);
+    Partida partidaIA(SEMENTE_ROTEIRO);
+
+    LotePartidas lote(PARTIDAS_LOTE);
+    std::vector<PartidaT<float>> partidasEscalares;
+    for (size_t i = 0; i < PARTIDAS_LOTE; i++) partidasEscalares.emplace_back(LotePartidas::semente(1, i, 0));
+    std::vector<uint8_t> entradasLote(PARTIDAS_LOTE);
+    uint32_t tickLote = 0;
+    uint32_t tickEscalar = 0;
+    ConfigIA configIA[2];
+    configIA[0].jogador = 0;
+    configIA[1].jogador = 1;
+    OponenteIA ias[2] = { OponenteIA(configIA[0]), OponenteIA(configIA[1]) };
+
+    std::vector<float> contorno1k = contornoFase(1000, 0.0f);
+    std::vector<float> contorno10k = contornoFase(10000, 0.0f);
+    Triangulador triangulador;
+    std::vector<uint32_t> indicesTriangulos;
+    CacheTriangulacoes& cacheTriangulacoes = CacheTriangulacoes::instancia();
+
+    std::vector<PoligonoConvexo> poligonosSAT = paresSAT();
+    std::vector<ResultadoSAT> mtvs(PARES_SAT);
+    size_t colisoesSAT = 0;
+
+    // 10k malhas vivas; cada quadro troca 10k delas por outras de tamanho qualquer
+    AlocadorFaixas faixasMalhas(VERTICES_FAIXAS);
+    std::vector<AlocadorFaixas::Faixa> faixasVivas(FAIXAS_VIVAS);
+    std::mt19937 geradorFaixas(31);
+    for (auto& faixa : faixasVivas) faixa = faixasMalhas.alocar(tamanhoMalha(geradorFaixas));
+    size_t faixasRecusadas = 0;
+
+    // Cada quadro copia a fila desordenada antes de ordenar
+    std::vector<ItemOrdenacao> chaves10k = chavesQuadro(10000);
+    std::vector<ItemOrdenacao> chaves100k = chavesQuadro(100000);
+    std::vector<ItemOrdenacao> chavesOrdenadas(chaves100k.size());
+    std::vector<ItemOrdenacao> chavesTemporario(chaves100k.size());
+
+    std::vector<CasoBench> casos = {
+        { "fisica 10k corpos (1 thread)", true, [&] {
+            EscopoAlocacao escopo(Subsistema::fisica);
+            mundoSequencial.passo(dt, nullptr, &arena);
+        }},
+        { "fisica 10k corpos (pool)", true, [&] {
+            EscopoAlocacao escopo(Subsistema::fisica);
+            mundoParalelo.passo(dt, &jobs, &arena);
+        }},
+        { "jobs paraCada 64k floats", true, [&] {
+            EscopoAlocacao escopo(Subsistema::jobs);
+            jobs.paraCada(dados.size(), 1024, [&](size_t i) { dados[i] = dados[i] * 0.5f + 1.0f; });
+        }},
+        { "partida float 1k ticks", true, [&] {
+            for (int t = 0; t < 1000; t++) partidaFloat.passo(entradaRoteiro(partidaFloat.getEstado()));
+        }},
+        { "partida Q16.16 1k ticks", true, [&] {
+            for (int t = 0; t < 1000; t++) partidaFixo.passo(entradaRoteiro(partidaFixo.getEstado()));
+        }},
+        { "partida + 2 IA 1k ticks", true, [&] {
+            for (int t = 0; t < 1000; t++) {
+                const EstadoPartida& e = partidaIA.getEstado();
+                partidaIA.passo(ias[0].decidir(e) | ias[1].decidir(e));
+            }
+        }},
+        { "4096 partidas escalar (1 thread)", true, [&] {
+            for (size_t i = 0; i < partidasEscalares.size(); i++) {
+                const EstadoPartidaT<float>& e = partidasEscalares[i].getEstado();
+                partidasEscalares[i].passo(entradaTreino(e.bolaY, e.raqueteY[0], e.raqueteY[1],
+                                                         static_cast<uint32_t>(i), tickEscalar));
+            }
+            tickEscalar++;
+        }},
+        { "4096 partidas lote SIMD (1 thread)", true, [&] {
+            entradasDoLote(lote, tickLote++, entradasLote);
+            lote.passo(entradasLote.data());
+        }},
+        { "4096 partidas lote SIMD (pool)", true, [&] {
+            entradasDoLote(lote, tickLote++, entradasLote);
+            lote.passo(entradasLote.data(), &jobs);
+        }},
+        { "triangular contorno 1k pontos", true, [&] {
+            triangulador.triangular(contorno1k.data(), contorno1k.size() / 2, indicesTriangulos);
+        }},
+        { "triangular contorno 10k pontos", true, [&] {
+            triangulador.triangular(contorno10k.data(), contorno10k.size() / 2, indicesTriangulos);
+        }},
+        { "cache contorno 10k pontos (acerto)", true, [&] {
+            cacheTriangulacoes.obter(contorno10k.data(), contorno10k.size() / 2);
+        }},
+        { "SAT 10k pares convexos (escalar)", true, [&] {
+            colisoesSAT = 0;
+            for (size_t i = 0; i < PARES_SAT; i++) {
+                colisoesSAT += colidirSATEscalar(poligonosSAT[i * 2], poligonosSAT[i * 2 + 1], &mtvs[i]);
+            }
+        }},
+        { "SAT 10k pares convexos (SIMD)", true, [&] {
+            colisoesSAT = 0;
+            for (size_t i = 0; i < PARES_SAT; i++) {
+                colisoesSAT += colidirSAT(poligonosSAT[i * 2], poligonosSAT[i * 2 + 1], &mtvs[i]);
+            }
+        }},
+        { "faixas TLSF 10k liberar+alocar", true, [&] {
+            for (size_t k = 0; k < FAIXAS_VIVAS; k++) {
+                AlocadorFaixas::Faixa& faixa = faixasVivas[geradorFaixas() % FAIXAS_VIVAS];
+                faixasMalhas.liberar(faixa);
+                faixa = faixasMalhas.alocar(tamanhoMalha(geradorFaixas));
+                faixasRecusadas += !faixa.valida();
+            }
+        }},
+        { "ordenar chaves radix 10k", true, [&] {
+            std::copy(chaves10k.begin(), chaves10k.end(), chavesOrdenadas.begin());
+            ordenarChaves(chavesOrdenadas.data(), chavesTemporario.data(), chaves10k.size());
+        }},
+        { "ordenar chaves radix 100k", true, [&] {
+            std::copy(chaves100k.begin(), chaves100k.end(), chavesOrdenadas.begin());
+            ordenarChaves(chavesOrdenadas.data(), chavesTemporario.data(), chaves100k.size());
+        }},
+        { "ordenar chaves std::sort 100k", true, [&] {
+            std::copy(chaves100k.begin(), chaves100k.end(), chavesOrdenadas.begin());
+            std::sort(chavesOrdenadas.begin(), chavesOrdenadas.end(), menorChave);
+        }},
+    };
+
+    std::printf("Threads: %u | rastreio de alocações: %s\n\n",
+                jobs.getNumThreads(), rastreioAtivo() ? "ligado" : "desligado");
+    std::printf("%-34s %12s %14s %14s\n", "caso", "ms/quadro", "alocs/quadro", "bytes/quadro");
+
+    int regressoes = 0;
+    for (const CasoBench& caso : casos) {
+        if (filtro && !std::strstr(caso.nome, filtro)) continue;
+
+        ResultadoBench r = medir(caso, arena);
+        bool falhou = rastreioAtivo() && caso.exigeZeroAlocacoes && r.alocacoesPorQuadro > 0.0;
+        std::printf("%-34s %12.4f %14.2f %14.1f%s\n", caso.nome, r.msPorQuadro,
+                    r.alocacoesPorQuadro, r.bytesPorQuadro, falhou ? "  <-- REGRESSÃO" : "");
+        if (falhou) regressoes++;
+    }
+
+    // Vazão do lote: partidas completas (11 pontos) por segundo em um núcleo
+    if (!filtro || std::strstr("lote SIMD", filtro)) {
+        LotePartidas treino(PARTIDAS_LOTE, 11, 7);
+        std::vector<uint8_t> entradasTreino(PARTIDAS_LOTE);
+        uint32_t t = 0;
+        auto inicio = std::chrono::steady_clock::now();
+        double segundos = 0.0;
+        while (segundos < 2.0) {
+            for (int k = 0; k < 120; k++) {
+                entradasDoLote(treino, t++, entradasTreino);
+                treino.passo(entradasTreino.data());
+            }
+            segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        }
+        double partidaTicks = static_cast<double>(t) * PARTIDAS_LOTE;
+        bool confere = loteConfereComEscalar(1000, 20000);
+        std::printf("\nLote SIMD (1 núcleo, %zu pistas de %zu): %.0f partidas/s, %.1f M partida-ticks/s, "
+                    "%.2f%% resolvidos no caminho escalar\n",
+                    PARTIDAS_LOTE, LotePartidas::LARGURA_SIMD, treino.getPartidasConcluidas() / segundos,
+                    partidaTicks / segundos / 1e6, 100.0 * treino.getTicksEscalares() / partidaTicks);
+        std::printf("Lote vs Partida escalar (1000 partidas, 20000 ticks): %s\n",
+                    confere ? "idênticas" : "<-- DIVERGIRAM");
+        if (!confere) regressoes++;
+    }
+
+    // Vazão da triangulação em contornos grandes e conferência das áreas
+    if (!filtro || std::strstr("triangular contorno", filtro)) {
+        std::printf("\nTriangulação (partes monótonas por varredura, O(n log n)):\n");
+        struct { const char* nome; size_t pontos; float ruido; } contornos[] = {
+            { "fase 1k", 1000, 0.0f },
+            { "fase 10k", 10000, 0.0f },
+            { "fase 100k", 100000, 0.0f },
+            { "ruido 10k (pior caso)", 10000, 1.0f },
+        };
+        for (const auto& c : contornos) {
+            std::vector<float> xy = contornoFase(c.pontos, c.ruido);
+            int repeticoes = 0;
+            auto inicio = std::chrono::steady_clock::now();
+            double segundos = 0.0;
+            while (segundos < 0.5 || repeticoes < 2) {
+                triangulador.triangular(xy.data(), c.pontos, indicesTriangulos);
+                repeticoes++;
+                segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+            }
+            bool confere = triangulosCobremContorno(xy, indicesTriangulos);
+            std::printf("  %-22s %10.3f ms/contorno %8.2f M pontos/s  %s\n", c.nome,
+                        1000.0 * segundos / repeticoes, c.pontos * repeticoes / segundos / 1e6,
+                        confere ? "área confere" : "<-- TRIANGULAÇÃO ERRADA");
+            if (!confere) regressoes++;
+        }
+        std::printf("  cache: %zu contorno(s) triangulado(s), %zu acerto(s)\n",
+                    cacheTriangulacoes.getNumEntradas(), cacheTriangulacoes.getAcertos());
+    }
+
+    // SAT: a versão vetorizada decide igual à escalar e devolve o mesmo MTV
+    if (!filtro || std::strstr("SAT", filtro)) {
+        size_t colisoes = 0;
+        size_t divergencias = 0;
+        for (size_t i = 0; i < PARES_SAT; i++) {
+            ResultadoSAT escalar, vetorial;
+            bool a = colidirSATEscalar(poligonosSAT[i * 2], poligonosSAT[i * 2 + 1], &escalar);
+            bool b = colidirSAT(poligonosSAT[i * 2], poligonosSAT[i * 2 + 1], &vetorial);
+            colisoes += a;
+            if (a != b || (a && (std::fabs(escalar.profundidade - vetorial.profundidade) > 1e-6f ||
+                                 escalar.normalX * vetorial.normalX + escalar.normalY * vetorial.normalY < 0.999f))) {
+                divergencias++;
+            }
+        }
+        std::printf("\nSAT (%zu pares, %zu colidem): SIMD vs escalar %s\n", PARES_SAT, colisoes,
+                    divergencias == 0 ? "idênticos" : "<-- DIVERGIRAM");
+        if (divergencias > 0) regressoes++;
+    }
+
+    // Faixas: nenhuma recusa com folga, e tudo liberado volta a ser um trecho só
+    if (!filtro || std::strstr("faixas TLSF", filtro)) {
+        std::printf("\nFaixas TLSF (%zu vivas em %u vértices): %u usados, %u trechos livres, maior %u",
+                    FAIXAS_VIVAS, faixasMalhas.getCapacidade(), faixasMalhas.getUsado(),
+                    faixasMalhas.getNumLivres(), faixasMalhas.getMaiorLivre());
+        for (auto& faixa : faixasVivas) faixasMalhas.liberar(faixa);
+        bool confere = faixasRecusadas == 0 && faixasMalhas.getUsado() == 0 && faixasMalhas.getNumLivres() == 1 &&
+                       faixasMalhas.getMaiorLivre() == faixasMalhas.getCapacidade();
+        std::printf("\n  %zu recusadas; depois de liberar tudo: %s\n", faixasRecusadas,
+                    confere ? "um trecho livre do tamanho do espaço" : "<-- FAIXAS PERDIDAS");
+        if (!confere) regressoes++;
+    }
+
+    // Radix: mesma ordem (estável) de um std::stable_sort pelas mesmas chaves
+    if (!filtro || std::strstr("ordenar chaves", filtro)) {
+        std::vector<ItemOrdenacao> referencia = chaves100k;
+        std::stable_sort(referencia.begin(), referencia.end(), menorChave);
+        chavesOrdenadas = chaves100k;
+        ordenarChaves(chavesOrdenadas.data(), chavesTemporario.data(), chavesOrdenadas.size());
+        bool confere = true;
+        for (size_t i = 0; i < referencia.size(); i++) {
+            confere = confere && referencia[i].chave == chavesOrdenadas[i].chave &&
+                      referencia[i].indice == chavesOrdenadas[i].indice;
+        }
+        std::printf("\nChaves de desenho (%zu): radix vs std::stable_sort %s\n", referencia.size(),
+                    confere ? "idênticos" : "<-- DIVERGIRAM");
+        if (!confere) regressoes++;
+
+        // Dois opacos sobrepostos, mesmo material: o de longe sai antes, o de perto cobre
+        CamposChave perto, longe;
+        perto.profundidade = 0.2f;
+        longe.profundidade = 0.8f;
+        ItemOrdenacao par[2] = { { montarChave(perto), 0 }, { montarChave(longe), 1 } };
+        ItemOrdenacao parTemporario[2];
+        ordenarChaves(par, parTemporario, 2);
+        bool longePrimeiro = par[0].indice == 1;
+        std::printf("  opacos sobrepostos: %s\n", longePrimeiro ? "longe antes de perto" : "<-- PERTO ANTES DE LONGE");
+        if (!longePrimeiro) regressoes++;
+    }
+
+    // Determinismo entre builds: só o ponto fixo tem valor de referência
+    EstadoPartidaT<float> finalFloat;
+    EstadoPartidaT<Q16_16> finalFixo;
+    uint64_t checksumFloat = checksumRoteiro(&finalFloat);
+    uint64_t checksumFixo = checksumRoteiro(&finalFixo);
+    bool fixoConfere = checksumFixo == CHECKSUM_Q16_16;
+    std::printf("\nPartida roteirizada (%u ticks):\n", TICKS_ROTEIRO);
+    std::printf("  float   %016llx  placar %u x %u  (depende do compilador e das flags)\n",
+                static_cast<unsigned long long>(checksumFloat), finalFloat.placar[0], finalFloat.placar[1]);
+    std::printf("  Q16.16  %016llx  placar %u x %u  %s\n", static_cast<unsigned long long>(checksumFixo),
+                finalFixo.placar[0], finalFixo.placar[1],
+                fixoConfere ? "OK" : "<-- DIVERGIU da referência");
+    if (!fixoConfere) regressoes++;
+
+    if (regressoes > 0) {
+        std::printf("\n%d regressão(ões): alocação em regime permanente, checksum divergente, triangulação, SAT, faixas ou ordenação errados\n", regressoes);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,275 @@
+#include "Cena.hpp"
+#include "../visual.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+static const char MAGIA[4] = {'P', 'P', 'C', 'N'};
+static const float PI = 3.14159265358979323846f;
+
+// Nomes do formato de texto, na ordem dos enums
+static const char* const NOMES_TIPO[NUM_TIPOS_CENA] = {"triangulo", "quadrado", "retangulo", "circulo"};
+static const char* const NOMES_COR[] = {"red", "blue", "yellow", "green", "black",
+                                        "white", "orange", "gray", "rainbow"};
+static const char* const NOMES_TEXTURA[] = {"none", "wood", "metal"};
+static const int NUM_CORES = sizeof(NOMES_COR) / sizeof(NOMES_COR[0]);
+static const int NUM_TEXTURAS = sizeof(NOMES_TEXTURA) / sizeof(NOMES_TEXTURA[0]);
+static_assert(static_cast<int>(cor::rainbow) == NUM_CORES - 1, "NOMES_COR segue o enum cor");
+static_assert(static_cast<int>(textura::metal) == NUM_TEXTURAS - 1, "NOMES_TEXTURA segue o enum textura");
+
+static int procurarNome(const char* const* nomes, int quantidade, const std::string& nome) {
+    for (int i = 0; i < quantidade; i++) {
+        if (nome == nomes[i]) return i;
+    }
+    return -1;
+}
+
+static bool maquinaLittleEndian() {
+    const uint16_t um = 1;
+    unsigned char primeiro;
+    std::memcpy(&primeiro, &um, 1);
+    return primeiro == 1;
+}
+
+/// Formas com a mesma chave usam a mesma malha unitária
+static uint32_t chaveLote(const RegistroForma& f) {
+    return (static_cast<uint32_t>(f.tipo) << 24) | (static_cast<uint32_t>(f.modo) << 16) | f.segmentos;
+}
+
+// ========== Validação ==========
+
+bool validarCena(const unsigned char* dados, size_t tamanho, std::string& erro) {
+    if (!maquinaLittleEndian()) {
+        erro = "o formato é little-endian e é usado sem conversão";
+        return false;
+    }
+    if (!dados || tamanho < sizeof(CabecalhoCena)) {
+        erro = "arquivo menor que o cabeçalho";
+        return false;
+    }
+
+    CabecalhoCena cabecalho;
+    std::memcpy(&cabecalho, dados, sizeof(cabecalho));
+    if (std::memcmp(cabecalho.magia, MAGIA, 4) != 0) {
+        erro = "não é um arquivo de cena";
+        return false;
+    }
+    if (cabecalho.versao != VERSAO_CENA) {
+        erro = "versão " + std::to_string(cabecalho.versao) + " não suportada";
+        return false;
+    }
+    if (cabecalho.bytesRegistro != sizeof(RegistroForma)) {
+        erro = "registros de " + std::to_string(cabecalho.bytesRegistro) + " bytes";
+        return false;
+    }
+    uint64_t esperado = sizeof(CabecalhoCena) + uint64_t(cabecalho.numLotes) * sizeof(LoteCena) +
+                        uint64_t(cabecalho.numFormas) * sizeof(RegistroForma);
+    if (tamanho < esperado) {
+        erro = "arquivo truncado";
+        return false;
+    }
+
+    const LoteCena* lotes = reinterpret_cast<const LoteCena*>(dados + sizeof(CabecalhoCena));
+    const RegistroForma* formas = reinterpret_cast<const RegistroForma*>(lotes + cabecalho.numLotes);
+    uint32_t proxima = 0;
+    for (uint32_t l = 0; l < cabecalho.numLotes; l++) {
+        const LoteCena& lote = lotes[l];
+        bool tesselado = lote.tipo == static_cast<uint8_t>(TipoFormaCena::circulo) && lote.modo == 0;
+        if (lote.primeira != proxima || lote.quantidade > cabecalho.numFormas - proxima) {
+            erro = "lote " + std::to_string(l) + " fora de ordem";
+            return false;
+        }
+        if (lote.tipo >= NUM_TIPOS_CENA || lote.modo > 1 || (tesselado ? lote.segmentos < 3 : lote.segmentos != 0)) {
+            erro = "lote " + std::to_string(l) + " com malha inválida";
+            return false;
+        }
+        for (uint32_t i = lote.primeira; i < lote.primeira + lote.quantidade; i++) {
+            const RegistroForma& f = formas[i];
+            if (f.tipo != lote.tipo || f.modo != lote.modo || f.segmentos != lote.segmentos) {
+                erro = "forma " + std::to_string(i) + " fora do seu lote";
+                return false;
+            }
+            if (f.cor >= NUM_CORES || f.textura >= NUM_TEXTURAS) {
+                erro = "forma " + std::to_string(i) + " com cor ou textura inválida";
+                return false;
+            }
+        }
+        proxima += lote.quantidade;
+    }
+    if (proxima != cabecalho.numFormas) {
+        erro = "formas fora de qualquer lote";
+        return false;
+    }
+    return true;
+}
+
+bool Cena::abrir(const std::string& caminho) {
+    lotes = nullptr;
+    formas = nullptr;
+    numLotes = numFormas = 0;
+    if (!arquivo.abrir(caminho)) {
+        erro = "não foi possível mapear " + caminho;
+        return false;
+    }
+    if (!validarCena(arquivo.getDados(), arquivo.getTamanho(), erro)) {
+        arquivo.fechar();
+        return false;
+    }
+
+    // Tudo validado: os ponteiros apontam para dentro do mapeamento
+    CabecalhoCena cabecalho;
+    std::memcpy(&cabecalho, arquivo.getDados(), sizeof(cabecalho));
+    numLotes = cabecalho.numLotes;
+    numFormas = cabecalho.numFormas;
+    lotes = reinterpret_cast<const LoteCena*>(arquivo.getDados() + sizeof(CabecalhoCena));
+    formas = reinterpret_cast<const RegistroForma*>(lotes + numLotes);
+    erro.clear();
+    return true;
+}
+
+// ========== Formato de Texto ==========
+
+bool lerCenaTexto(std::istream& entrada, std::vector<RegistroForma>& formas, std::string& erro) {
+    std::string linha;
+    int numeroLinha = 0;
+    while (std::getline(entrada, linha)) {
+        numeroLinha++;
+        auto falhar = [&](const std::string& motivo) {
+            erro = "linha " + std::to_string(numeroLinha) + ": " + motivo;
+            return false;
+        };
+        size_t comentario = linha.find('#');
+        if (comentario != std::string::npos) linha.erase(comentario);
+        std::istringstream campos(linha);
+        std::string nomeTipo;
+        if (!(campos >> nomeTipo)) continue;
+
+        int tipo = procurarNome(NOMES_TIPO, NUM_TIPOS_CENA, nomeTipo);
+        if (tipo < 0) return falhar("tipo desconhecido '" + nomeTipo + "'");
+        RegistroForma f{};
+        f.tipo = static_cast<uint8_t>(tipo);
+        f.cor = static_cast<uint8_t>(cor::white);
+        f.textura = static_cast<uint8_t>(textura::none);
+        if (!(campos >> f.x >> f.y)) return falhar("esperava 'tipo x y'");
+
+        // Tamanhos padrão iguais aos construtores sem tamanho de geometry/
+        float lado = 1.0f, largura = -1.0f, altura = -1.0f, raio = 0.5f, graus = 0.0f, canto = 0.0f;
+        long segmentos = 32;
+        bool sdf = false;
+        std::string token;
+        while (campos >> token) {
+            size_t igual = token.find('=');
+            std::string chave = token.substr(0, igual);
+            std::string valor = igual == std::string::npos ? "" : token.substr(igual + 1);
+            if (chave == "sdf" && igual == std::string::npos) {
+                sdf = true;
+                continue;
+            }
+            if (valor.empty()) return falhar("esperava chave=valor em '" + token + "'");
+            if (chave == "cor") {
+                int c = procurarNome(NOMES_COR, NUM_CORES, valor);
+                if (c < 0) return falhar("cor desconhecida '" + valor + "'");
+                f.cor = static_cast<uint8_t>(c);
+                continue;
+            }
+            if (chave == "textura") {
+                int t = procurarNome(NOMES_TEXTURA, NUM_TEXTURAS, valor);
+                if (t < 0) return falhar("textura desconhecida '" + valor + "'");
+                f.textura = static_cast<uint8_t>(t);
+                continue;
+            }
+
+            char* fim = nullptr;
+            float numero = std::strtof(valor.c_str(), &fim);
+            if (*fim != '\0') return falhar("número inválido em '" + token + "'");
+            if (chave == "lado") lado = numero;
+            else if (chave == "largura") largura = numero;
+            else if (chave == "altura") altura = numero;
+            else if (chave == "raio") raio = numero;
+            else if (chave == "rotacao") graus = numero;
+            else if (chave == "canto") canto = numero;
+            else if (chave == "segmentos") segmentos = static_cast<long>(numero);
+            else return falhar("chave desconhecida '" + chave + "'");
+        }
+
+        switch (static_cast<TipoFormaCena>(tipo)) {
+            case TipoFormaCena::triangulo:
+                if (sdf) return falhar("triângulo não tem modo SDF");
+                if (largura < 0.0f) largura = 1.0f;
+                if (altura < 0.0f) altura = 1.0f;
+                break;
+            case TipoFormaCena::quadrado:
+                largura = altura = lado;
+                break;
+            case TipoFormaCena::retangulo:
+                if (largura < 0.0f) largura = 1.0f;
+                if (altura < 0.0f) altura = 0.6f;
+                break;
+            case TipoFormaCena::circulo:
+                largura = altura = 2.0f * raio;
+                canto = raio;
+                if (!sdf) f.segmentos = static_cast<uint16_t>(std::min(std::max(segmentos, 3l), 65535l));
+                break;
+        }
+        if (!(largura > 0.0f) || !(altura > 0.0f)) return falhar("tamanho deve ser positivo");
+
+        // O raio do canto não pode passar da menor meia dimensão (como em gerarQuadSDF)
+        float limite = std::min(largura, altura) * 0.5f;
+        f.raioCanto = std::min(std::max(canto, 0.0f), limite);
+        f.modo = sdf ? 1 : 0;
+        f.largura = largura;
+        f.altura = altura;
+        f.rotacao = graus * PI / 180.0f;
+        formas.push_back(f);
+    }
+    return true;
+}
+
+// ========== Codificação ==========
+
+std::vector<unsigned char> codificarCena(std::vector<RegistroForma> formas) {
+    // Ordem estável: dentro do lote, as formas ficam na ordem do texto
+    std::stable_sort(formas.begin(), formas.end(), [](const RegistroForma& a, const RegistroForma& b) {
+        return chaveLote(a) < chaveLote(b);
+    });
+
+    std::vector<LoteCena> lotes;
+    for (uint32_t i = 0; i < formas.size(); i++) {
+        if (lotes.empty() || chaveLote(formas[i]) != chaveLote(formas[lotes.back().primeira])) {
+            LoteCena lote{};
+            lote.tipo = formas[i].tipo;
+            lote.modo = formas[i].modo;
+            lote.segmentos = formas[i].segmentos;
+            lote.primeira = i;
+            lotes.push_back(lote);
+        }
+        lotes.back().quantidade++;
+    }
+
+    CabecalhoCena cabecalho;
+    std::memcpy(cabecalho.magia, MAGIA, 4);
+    cabecalho.versao = VERSAO_CENA;
+    cabecalho.bytesRegistro = sizeof(RegistroForma);
+    cabecalho.numLotes = static_cast<uint32_t>(lotes.size());
+    cabecalho.numFormas = static_cast<uint32_t>(formas.size());
+
+    std::vector<unsigned char> saida(sizeof(cabecalho) + lotes.size() * sizeof(LoteCena) +
+                                     formas.size() * sizeof(RegistroForma));
+    unsigned char* p = saida.data();
+    std::memcpy(p, &cabecalho, sizeof(cabecalho));
+    p += sizeof(cabecalho);
+    if (!lotes.empty()) std::memcpy(p, lotes.data(), lotes.size() * sizeof(LoteCena));
+    p += lotes.size() * sizeof(LoteCena);
+    if (!formas.empty()) std::memcpy(p, formas.data(), formas.size() * sizeof(RegistroForma));
+    return saida;
+}
+
+bool gravarCena(const std::string& caminho, const std::vector<RegistroForma>& formas) {
+    std::vector<unsigned char> dados = codificarCena(formas);
+    std::ofstream saida(caminho, std::ios::binary);
+    if (!saida) return false;
+    saida.write(reinterpret_cast<const char*>(dados.data()), static_cast<std::streamsize>(dados.size()));
+    return static_cast<bool>(saida);
+}
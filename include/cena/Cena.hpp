@@ -0,0 +1,134 @@
+#ifndef CENA_HPP
+#define CENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+#include "../core/ArquivoMapeado.hpp"
+
+/// Tipos de forma que uma cena pode conter (mesmas formas de geometry/)
+enum class TipoFormaCena : uint8_t {
+    triangulo = 0,
+    quadrado,
+    retangulo,
+    circulo
+};
+
+static const int NUM_TIPOS_CENA = 4;
+
+/**
+ * Formato binário de cena (.ppcn), little-endian, versão 1:
+ *
+ * | bytes        | conteúdo                                      |
+ * |--------------|-----------------------------------------------|
+ * | 16           | CabecalhoCena                                 |
+ * | 16 * lotes   | LoteCena, na ordem das formas                 |
+ * | 32 * formas  | RegistroForma, agrupados por lote             |
+ *
+ * Os registros têm o layout exato da memória e o do buffer de instâncias
+ * do RenderizadorCena: o arquivo mapeado vai direto para a GPU, sem
+ * desserializar forma por forma. Um lote é uma faixa contígua de formas
+ * que usam a mesma malha (tipo, modo e, em círculos tesselados, número de
+ * segmentos) e sai em um único draw instanciado.
+ */
+
+struct CabecalhoCena {
+    char magia[4];            ///< "PPCN"
+    uint16_t versao;          ///< VERSAO_CENA
+    uint16_t bytesRegistro;   ///< sizeof(RegistroForma), para versões futuras crescerem o registro
+    uint32_t numLotes;
+    uint32_t numFormas;
+};
+
+struct LoteCena {
+    uint8_t tipo;             ///< TipoFormaCena
+    uint8_t modo;             ///< 0 = triângulos, 1 = SDF
+    uint16_t segmentos;       ///< Só círculos tesselados; 0 nos demais
+    uint32_t primeira;        ///< Índice da primeira forma do lote
+    uint32_t quantidade;
+    uint32_t reservado;
+};
+
+struct RegistroForma {
+    uint8_t tipo;             ///< TipoFormaCena
+    uint8_t cor;              ///< enum cor
+    uint8_t textura;          ///< enum textura (ignorada no modo SDF, como em visual)
+    uint8_t modo;             ///< 0 = triângulos, 1 = SDF
+    uint16_t segmentos;       ///< Círculos tesselados; 0 nos demais
+    uint16_t reservado;
+    float x, y;               ///< Centro em NDC
+    float rotacao;            ///< Radianos, anti-horário
+    float largura, altura;    ///< Círculos: 2 * raio nas duas
+    float raioCanto;          ///< Retângulos SDF arredondados
+};
+
+static_assert(sizeof(CabecalhoCena) == 16, "layout do arquivo de cena");
+static_assert(sizeof(LoteCena) == 16, "layout do arquivo de cena");
+static_assert(sizeof(RegistroForma) == 32, "layout do arquivo de cena");
+
+static const uint16_t VERSAO_CENA = 1;
+
+/**
+ * @class Cena
+ * @brief Cena binária mapeada em memória, validada e pronta para uso
+ *
+ * abrir() mapeia o arquivo e confere cabeçalho, lotes e cada registro;
+ * depois disso getFormas() aponta para dentro do mapeamento. Nada é
+ * copiado: o custo de abrir é o das faltas de página da leitura.
+ */
+class Cena {
+public:
+    /// false se o arquivo não existir ou for inválido (motivo em getErro())
+    bool abrir(const std::string& caminho);
+
+    const std::string& getErro() const { return erro; }
+
+    uint32_t getNumFormas() const { return numFormas; }
+    const RegistroForma* getFormas() const { return formas; }
+    uint32_t getNumLotes() const { return numLotes; }
+    const LoteCena* getLotes() const { return lotes; }
+    size_t getBytesArquivo() const { return arquivo.getTamanho(); }
+
+private:
+    ArquivoMapeado arquivo;
+    const LoteCena* lotes = nullptr;
+    const RegistroForma* formas = nullptr;
+    uint32_t numLotes = 0;
+    uint32_t numFormas = 0;
+    std::string erro;
+};
+
+/// Confere uma cena em memória; em caso de erro, o motivo vai para `erro`
+bool validarCena(const unsigned char* dados, size_t tamanho, std::string& erro);
+
+// ========== Conversão do Formato de Texto ==========
+
+/**
+ * @brief Lê a descrição em texto de uma cena, uma forma por linha
+ *
+ * @code
+ * # tipo x y [chave=valor ...]
+ * circulo   -0.5  0.3 raio=0.2 segmentos=48 cor=rainbow
+ * retangulo -0.2  0.8 largura=0.5 altura=0.15 cor=blue sdf canto=0.05
+ * quadrado   0.8 -0.7 lado=0.25 textura=metal rotacao=15
+ * triangulo  0.0  0.0 largura=1 altura=1
+ * @endcode
+ *
+ * Chaves: lado, largura, altura, raio, rotacao (graus), segmentos, cor e
+ * textura (nomes dos enums de visual.hpp), canto (raio dos cantos no SDF)
+ * e sdf, que não leva valor. Linhas vazias e o que vem depois de '#' são
+ * ignorados.
+ *
+ * @return bool - false no primeiro erro (com o número da linha em `erro`)
+ */
+bool lerCenaTexto(std::istream& entrada, std::vector<RegistroForma>& formas, std::string& erro);
+
+/// Agrupa as formas em lotes e monta o arquivo binário em memória
+std::vector<unsigned char> codificarCena(std::vector<RegistroForma> formas);
+
+/// Codifica e grava; false se não conseguir escrever o arquivo
+bool gravarCena(const std::string& caminho, const std::vector<RegistroForma>& formas);
+
+#endif // CENA_HPP
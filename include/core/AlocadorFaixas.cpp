@@ -0,0 +1,229 @@
+#include "AlocadorFaixas.hpp"
+
+// ========== Construtor ==========
+
+AlocadorFaixas::AlocadorFaixas(uint32_t capacidadeInicial) {
+    for (uint32_t n = 0; n < NIVEIS; n++) {
+        for (uint32_t s = 0; s < SUBDIVISOES; s++) {
+            listas[n][s] = INVALIDO;
+        }
+    }
+    crescer(capacidadeInicial);
+}
+
+// ========== Classes de Tamanho ==========
+
+void AlocadorFaixas::classe(uint32_t tamanho, uint32_t& nivel, uint32_t& sub) {
+    // Abaixo de SUBDIVISOES cada tamanho tem a sua lista; acima, o bit mais
+    // alto escolhe o nível e os LOG_SUBDIVISOES bits seguintes a subdivisão
+    if (tamanho < SUBDIVISOES) {
+        nivel = 0;
+        sub = tamanho;
+        return;
+    }
+    uint32_t bitAlto = 31u - static_cast<uint32_t>(__builtin_clz(tamanho));
+    nivel = bitAlto - LOG_SUBDIVISOES + 1;
+    sub = (tamanho >> (bitAlto - LOG_SUBDIVISOES)) - SUBDIVISOES;
+}
+
+uint32_t AlocadorFaixas::procurarLivre(uint32_t tamanho) const {
+    // Arredonda para a próxima classe: qualquer bloco dela (ou acima) cabe
+    uint64_t arredondado = tamanho;
+    if (tamanho >= SUBDIVISOES) {
+        uint32_t bitAlto = 31u - static_cast<uint32_t>(__builtin_clz(tamanho));
+        arredondado += (1ull << (bitAlto - LOG_SUBDIVISOES)) - 1;
+    }
+    if (arredondado <= 0xFFFFFFFFull) {
+        uint32_t nivel, sub;
+        classe(static_cast<uint32_t>(arredondado), nivel, sub);
+        uint32_t bits = mapaSub[nivel] & (~0u << sub);
+        if (!bits) {
+            uint32_t niveis = nivel + 1 < NIVEIS ? mapaNivel & (~0u << (nivel + 1)) : 0;
+            if (niveis) {
+                nivel = static_cast<uint32_t>(__builtin_ctz(niveis));
+                bits = mapaSub[nivel];
+            }
+        }
+        if (bits) {
+            return listas[nivel][__builtin_ctz(bits)];
+        }
+    }
+
+    // Nenhuma classe garantida: um bloco da classe exata ainda pode caber
+    uint32_t nivel, sub;
+    classe(tamanho, nivel, sub);
+    for (uint32_t i = listas[nivel][sub]; i != INVALIDO; i = blocos[i].proximoLivre) {
+        if (blocos[i].tamanho >= tamanho) return i;
+    }
+    return INVALIDO;
+}
+
+// ========== Blocos ==========
+
+uint32_t AlocadorFaixas::novoBloco() {
+    if (!blocosSoltos.empty()) {
+        uint32_t indice = blocosSoltos.back();
+        blocosSoltos.pop_back();
+        blocos[indice] = Bloco();
+        return indice;
+    }
+    blocos.emplace_back();
+    return static_cast<uint32_t>(blocos.size() - 1);
+}
+
+void AlocadorFaixas::soltarBloco(uint32_t indice) {
+    blocos[indice].tamanho = 0;
+    blocosSoltos.push_back(indice);
+}
+
+void AlocadorFaixas::inserirLivre(uint32_t indice) {
+    Bloco& bloco = blocos[indice];
+    uint32_t nivel, sub;
+    classe(bloco.tamanho, nivel, sub);
+
+    // Entra no começo da lista da classe
+    bloco.livre = true;
+    bloco.anteriorLivre = INVALIDO;
+    bloco.proximoLivre = listas[nivel][sub];
+    if (bloco.proximoLivre != INVALIDO) {
+        blocos[bloco.proximoLivre].anteriorLivre = indice;
+    }
+    listas[nivel][sub] = indice;
+    mapaSub[nivel] |= 1u << sub;
+    mapaNivel |= 1u << nivel;
+    livres++;
+}
+
+void AlocadorFaixas::removerLivre(uint32_t indice) {
+    Bloco& bloco = blocos[indice];
+    uint32_t nivel, sub;
+    classe(bloco.tamanho, nivel, sub);
+
+    if (bloco.anteriorLivre != INVALIDO) {
+        blocos[bloco.anteriorLivre].proximoLivre = bloco.proximoLivre;
+    } else {
+        listas[nivel][sub] = bloco.proximoLivre;
+    }
+    if (bloco.proximoLivre != INVALIDO) {
+        blocos[bloco.proximoLivre].anteriorLivre = bloco.anteriorLivre;
+    }
+
+    // Lista vazia: apaga os bits para a busca não parar nela
+    if (listas[nivel][sub] == INVALIDO) {
+        mapaSub[nivel] &= ~(1u << sub);
+        if (!mapaSub[nivel]) mapaNivel &= ~(1u << nivel);
+    }
+    bloco.livre = false;
+    bloco.anteriorLivre = bloco.proximoLivre = INVALIDO;
+    livres--;
+}
+
+// ========== Alocação ==========
+
+AlocadorFaixas::Faixa AlocadorFaixas::alocar(uint32_t tamanho) {
+    Faixa faixa;
+    if (tamanho == 0) return faixa;
+
+    uint32_t indice = procurarLivre(tamanho);
+    if (indice == INVALIDO) return faixa;
+    removerLivre(indice);
+
+    // Sobra vira um bloco livre logo depois (novoBloco pode mover o vetor)
+    if (blocos[indice].tamanho > tamanho) {
+        uint32_t resto = novoBloco();
+        Bloco& bloco = blocos[indice];
+        Bloco& sobra = blocos[resto];
+        sobra.offset = bloco.offset + tamanho;
+        sobra.tamanho = bloco.tamanho - tamanho;
+        sobra.anteriorFisico = indice;
+        sobra.proximoFisico = bloco.proximoFisico;
+        if (bloco.proximoFisico != INVALIDO) {
+            blocos[bloco.proximoFisico].anteriorFisico = resto;
+        } else {
+            ultimo = resto;
+        }
+        bloco.proximoFisico = resto;
+        bloco.tamanho = tamanho;
+        inserirLivre(resto);
+    }
+
+    usado += tamanho;
+    faixas++;
+    faixa.offset = blocos[indice].offset;
+    faixa.tamanho = tamanho;
+    faixa.bloco = indice;
+    return faixa;
+}
+
+void AlocadorFaixas::liberar(const Faixa& faixa) {
+    if (!faixa.valida()) return;
+    uint32_t indice = faixa.bloco;
+    usado -= blocos[indice].tamanho;
+    faixas--;
+
+    // Junta com o vizinho de depois...
+    uint32_t proximo = blocos[indice].proximoFisico;
+    if (proximo != INVALIDO && blocos[proximo].livre) {
+        removerLivre(proximo);
+        blocos[indice].tamanho += blocos[proximo].tamanho;
+        blocos[indice].proximoFisico = blocos[proximo].proximoFisico;
+        if (blocos[proximo].proximoFisico != INVALIDO) {
+            blocos[blocos[proximo].proximoFisico].anteriorFisico = indice;
+        } else {
+            ultimo = indice;
+        }
+        soltarBloco(proximo);
+    }
+
+    // ...e com o de antes, que absorve este
+    uint32_t anterior = blocos[indice].anteriorFisico;
+    if (anterior != INVALIDO && blocos[anterior].livre) {
+        removerLivre(anterior);
+        blocos[anterior].tamanho += blocos[indice].tamanho;
+        blocos[anterior].proximoFisico = blocos[indice].proximoFisico;
+        if (blocos[indice].proximoFisico != INVALIDO) {
+            blocos[blocos[indice].proximoFisico].anteriorFisico = anterior;
+        } else {
+            ultimo = anterior;
+        }
+        soltarBloco(indice);
+        indice = anterior;
+    }
+    inserirLivre(indice);
+}
+
+void AlocadorFaixas::crescer(uint32_t novaCapacidade) {
+    if (novaCapacidade <= capacidade) return;
+    uint32_t extra = novaCapacidade - capacidade;
+
+    // Última faixa livre só aumenta; senão entra um bloco livre no fim
+    if (ultimo != INVALIDO && blocos[ultimo].livre) {
+        removerLivre(ultimo);
+        blocos[ultimo].tamanho += extra;
+        inserirLivre(ultimo);
+    } else {
+        uint32_t indice = novoBloco();
+        blocos[indice].offset = capacidade;
+        blocos[indice].tamanho = extra;
+        blocos[indice].anteriorFisico = ultimo;
+        if (ultimo != INVALIDO) {
+            blocos[ultimo].proximoFisico = indice;
+        }
+        ultimo = indice;
+        inserirLivre(indice);
+    }
+    capacidade = novaCapacidade;
+}
+
+// ========== Estatísticas ==========
+
+uint32_t AlocadorFaixas::getMaiorLivre() const {
+    if (!mapaNivel) return 0;
+    uint32_t nivel = 31u - static_cast<uint32_t>(__builtin_clz(mapaNivel));
+    uint32_t sub = 31u - static_cast<uint32_t>(__builtin_clz(mapaSub[nivel]));
+    uint32_t maior = 0;
+    for (uint32_t i = listas[nivel][sub]; i != INVALIDO; i = blocos[i].proximoLivre) {
+        if (blocos[i].tamanho > maior) maior = blocos[i].tamanho;
+    }
+    return maior;
+}
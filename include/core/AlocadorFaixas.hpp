@@ -0,0 +1,118 @@
+#ifndef ALOCADOR_FAIXAS_HPP
+#define ALOCADOR_FAIXAS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class AlocadorFaixas
+ * @brief Suballocador TLSF de faixas [offset, offset + tamanho) de um espaço linear
+ *
+ * Não toca em memória: só decide onde cada faixa fica dentro de um buffer
+ * que mora em outro lugar (um VBO grande, por exemplo). As unidades são as
+ * do chamador (vértices, bytes...).
+ *
+ * Two-Level Segregated Fit: as faixas livres ficam em listas por classe de
+ * tamanho (potência de dois, dividida em SUBDIVISOES), com um bitmap por
+ * nível. Alocar acha uma lista com espaço em tempo constante (dois
+ * "find first set") e divide a faixa; liberar junta com as vizinhas livres
+ * também em tempo constante. A faixa entregue pode vir de uma classe um
+ * pouco maior que a exata (good fit), nunca de uma que talvez não caiba.
+ *
+ * Os blocos ficam em um vetor reaproveitado: depois que o número de faixas
+ * para de crescer, alocar e liberar não alocam memória.
+ *
+ * @code
+ * AlocadorFaixas faixas(4096);
+ * AlocadorFaixas::Faixa f = faixas.alocar(48);
+ * if (!f.valida()) { faixas.crescer(8192); f = faixas.alocar(48); }
+ * // ... glBufferSubData(GL_ARRAY_BUFFER, f.offset * stride, ...)
+ * faixas.liberar(f);
+ * @endcode
+ *
+ * Não é seguro entre threads.
+ */
+class AlocadorFaixas {
+public:
+    static const uint32_t INVALIDO = 0xFFFFFFFFu;
+
+    /// Resultado de alocar(): guarde inteira para liberar depois
+    struct Faixa {
+        uint32_t offset = 0;
+        uint32_t tamanho = 0;
+        uint32_t bloco = INVALIDO;    ///< Identificador interno (INVALIDO = não coube)
+
+        bool valida() const { return bloco != INVALIDO; }
+    };
+
+    /// @param capacidade - Unidades disponíveis de início (0 = só depois de crescer())
+    explicit AlocadorFaixas(uint32_t capacidade = 0);
+
+    /**
+     * @brief Reserva `tamanho` unidades contíguas
+     *
+     * @return Faixa - Inválida se nenhuma faixa livre couber (tamanho 0 também)
+     */
+    Faixa alocar(uint32_t tamanho);
+
+    /// Devolve a faixa, juntando com as vizinhas livres
+    void liberar(const Faixa& faixa);
+
+    /**
+     * @brief Aumenta o espaço para `novaCapacidade` unidades
+     *
+     * O trecho novo fica no fim (junta com a última faixa se estiver livre);
+     * faixas já entregues não mudam de lugar. Capacidade menor que a atual
+     * é ignorada.
+     */
+    void crescer(uint32_t novaCapacidade);
+
+    // ========== Estatísticas ==========
+
+    uint32_t getCapacidade() const { return capacidade; }
+    uint32_t getUsado() const { return usado; }
+    uint32_t getNumFaixas() const { return faixas; }
+
+    /// Faixas livres separadas (1 = sem fragmentação)
+    uint32_t getNumLivres() const { return livres; }
+
+    /// Maior faixa livre (percorre só a classe mais alta)
+    uint32_t getMaiorLivre() const;
+
+private:
+    static const uint32_t LOG_SUBDIVISOES = 3;
+    static const uint32_t SUBDIVISOES = 1u << LOG_SUBDIVISOES;
+    static const uint32_t NIVEIS = 32 - LOG_SUBDIVISOES + 1;
+
+    /// Trecho do espaço, livre ou ocupado, ligado aos vizinhos físicos e à lista da classe
+    struct Bloco {
+        uint32_t offset = 0;
+        uint32_t tamanho = 0;
+        uint32_t anteriorFisico = INVALIDO;
+        uint32_t proximoFisico = INVALIDO;
+        uint32_t anteriorLivre = INVALIDO;
+        uint32_t proximoLivre = INVALIDO;
+        bool livre = false;
+    };
+
+    std::vector<Bloco> blocos;
+    std::vector<uint32_t> blocosSoltos;      ///< Índices de `blocos` para reaproveitar
+    uint32_t listas[NIVEIS][SUBDIVISOES];    ///< Primeiro bloco livre de cada classe
+    uint32_t mapaNivel = 0;                  ///< Bit n: algum bloco livre no nível n
+    uint32_t mapaSub[NIVEIS] = {};           ///< Bit s: a lista [n][s] tem blocos
+    uint32_t ultimo = INVALIDO;              ///< Bloco no fim do espaço
+    uint32_t capacidade = 0;
+    uint32_t usado = 0;
+    uint32_t faixas = 0;
+    uint32_t livres = 0;
+
+    static void classe(uint32_t tamanho, uint32_t& nivel, uint32_t& sub);
+    uint32_t novoBloco();
+    void soltarBloco(uint32_t indice);
+    void inserirLivre(uint32_t indice);
+    void removerLivre(uint32_t indice);
+    uint32_t procurarLivre(uint32_t tamanho) const;
+};
+
+#endif // ALOCADOR_FAIXAS_HPP
@@ -0,0 +1,99 @@
+#include "ArenaQuadro.hpp"
+#include <cstdint>
+
+// Alinhamento do bloco principal: serve para qualquer tipo fundamental
+static const size_t ALINHAMENTO_BASE = alignof(std::max_align_t);
+
+static size_t alinharAcima(size_t valor, size_t alinhamento) {
+    return (valor + alinhamento - 1) & ~(alinhamento - 1);
+}
+
+// ========== Construtor e Destrutor ==========
+
+ArenaQuadro::ArenaQuadro(size_t capacidade, std::pmr::memory_resource* reserva)
+    : reserva(reserva),
+      memoria(static_cast<unsigned char*>(reserva->allocate(capacidade, ALINHAMENTO_BASE))),
+      capacidade(capacidade),
+      usado(0),
+      excessos(nullptr),
+      bytesExcesso(0),
+      alocacoesHeap(0),
+      alocacoesHeapUltimoQuadro(0),
+      pico(0) {}
+
+ArenaQuadro::~ArenaQuadro() {
+    reiniciar();
+    reserva->deallocate(memoria, capacidade, ALINHAMENTO_BASE);
+}
+
+// ========== Alocação ==========
+
+void* ArenaQuadro::do_allocate(size_t bytes, size_t alinhamento) {
+    uintptr_t base = reinterpret_cast<uintptr_t>(memoria);
+
+    // Caminho rápido: avança o ponteiro (várias threads podem disputar)
+    size_t atual = usado.load(std::memory_order_relaxed);
+    while (true) {
+        size_t inicio = alinharAcima(base + atual, alinhamento) - base;
+        size_t fim = inicio + bytes;
+        if (fim > capacidade) break;
+        if (usado.compare_exchange_weak(atual, fim, std::memory_order_relaxed)) {
+            return memoria + inicio;
+        }
+    }
+
+    // Caminho lento: a arena encheu neste quadro, o excesso vem da heap
+    size_t alinhamentoBloco = alinhamento > alignof(BlocoExcesso) ? alinhamento : alignof(BlocoExcesso);
+    size_t cabecalho = alinharAcima(sizeof(BlocoExcesso), alinhamentoBloco);
+    size_t total = cabecalho + bytes;
+    unsigned char* bruto = static_cast<unsigned char*>(reserva->allocate(total, alinhamentoBloco));
+
+    // O cabeçalho fica imediatamente antes dos dados devolvidos
+    BlocoExcesso* bloco = reinterpret_cast<BlocoExcesso*>(bruto + cabecalho - sizeof(BlocoExcesso));
+    bloco->bytesTotais = total;
+    bloco->alinhamento = alinhamentoBloco;
+
+    std::lock_guard<std::mutex> lk(travaExcesso);
+    bloco->proximo = excessos;
+    excessos = bloco;
+    bytesExcesso += bytes;
+    alocacoesHeap++;
+    return bruto + cabecalho;
+}
+
+void ArenaQuadro::do_deallocate(void*, size_t, size_t) {
+    // Nada: a memória volta toda de uma vez em reiniciar()
+}
+
+bool ArenaQuadro::do_is_equal(const std::pmr::memory_resource& outro) const noexcept {
+    return this == &outro;
+}
+
+// ========== Fim do Quadro ==========
+
+void ArenaQuadro::reiniciar() {
+    size_t usoQuadro = usado.load(std::memory_order_relaxed) + bytesExcesso;
+    if (usoQuadro > pico) pico = usoQuadro;
+
+    // Devolve os blocos de excesso para a heap
+    while (excessos) {
+        BlocoExcesso* bloco = excessos;
+        excessos = bloco->proximo;
+        size_t cabecalho = alinharAcima(sizeof(BlocoExcesso), bloco->alinhamento);
+        unsigned char* bruto = reinterpret_cast<unsigned char*>(bloco) + sizeof(BlocoExcesso) - cabecalho;
+        reserva->deallocate(bruto, bloco->bytesTotais, bloco->alinhamento);
+    }
+
+    // Houve excesso: cresce (com folga) para que o próximo quadro caiba inteiro
+    if (bytesExcesso > 0) {
+        size_t novaCapacidade = usoQuadro * 2;
+        reserva->deallocate(memoria, capacidade, ALINHAMENTO_BASE);
+        memoria = static_cast<unsigned char*>(reserva->allocate(novaCapacidade, ALINHAMENTO_BASE));
+        capacidade = novaCapacidade;
+    }
+
+    alocacoesHeapUltimoQuadro = alocacoesHeap;
+    alocacoesHeap = 0;
+    bytesExcesso = 0;
+    usado.store(0, std::memory_order_relaxed);
+}
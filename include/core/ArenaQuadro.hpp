@@ -0,0 +1,96 @@
+#ifndef ARENA_QUADRO_HPP
+#define ARENA_QUADRO_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+/**
+ * @class ArenaQuadro
+ * @brief Alocador linear (bump) para dados que só vivem durante um quadro
+ *
+ * Alocar é só avançar um ponteiro; liberar não faz nada. No fim do quadro
+ * reiniciar() devolve tudo de uma vez. É um std::pmr::memory_resource, então
+ * qualquer contêiner pmr pode usar a arena:
+ *
+ * @code
+ * ArenaQuadro arena(256 * 1024);
+ * std::pmr::vector<float> temp(&arena);   // nenhum malloc
+ * temp.reserve(1000);
+ * ...
+ * arena.reiniciar();                       // fim do quadro: temp não pode mais ser usado
+ * @endcode
+ *
+ * Se um quadro pedir mais que a capacidade, o excesso vem da heap (recurso
+ * de reserva) e é contado em getAlocacoesHeap(). No reiniciar() a arena
+ * cresce para caber o pico, então em regime permanente a contagem é zero.
+ *
+ * Alocar é seguro entre threads (o ponteiro avança com compare-exchange);
+ * reiniciar() deve ser chamado quando nenhuma thread estiver alocando.
+ */
+class ArenaQuadro : public std::pmr::memory_resource {
+public:
+    /**
+     * @brief Reserva a memória inicial da arena
+     *
+     * @param capacidade - Bytes disponíveis por quadro antes de recorrer à heap
+     * @param reserva - De onde vêm o bloco principal e os excessos
+     */
+    explicit ArenaQuadro(size_t capacidade,
+                         std::pmr::memory_resource* reserva = std::pmr::new_delete_resource());
+
+    ~ArenaQuadro() override;
+
+    ArenaQuadro(const ArenaQuadro&) = delete;
+    ArenaQuadro& operator=(const ArenaQuadro&) = delete;
+
+    /**
+     * @brief Fim do quadro: invalida todas as alocações e volta ao início
+     *
+     * Libera os blocos que vieram da heap e, se houve excesso, aumenta a
+     * capacidade para o próximo quadro.
+     */
+    void reiniciar();
+
+    // ========== Estatísticas ==========
+
+    size_t getCapacidade() const { return capacidade; }
+    size_t getBytesUsados() const { return usado.load(std::memory_order_relaxed); }
+
+    /// Maior uso de um quadro desde a criação (arena + excesso)
+    size_t getPicoBytes() const { return pico; }
+
+    /// Alocações que caíram na heap no quadro em andamento
+    size_t getAlocacoesHeap() const { return alocacoesHeap; }
+
+    /// Alocações que caíram na heap no último quadro encerrado por reiniciar()
+    size_t getAlocacoesHeapUltimoQuadro() const { return alocacoesHeapUltimoQuadro; }
+
+protected:
+    void* do_allocate(size_t bytes, size_t alinhamento) override;
+    void do_deallocate(void* p, size_t bytes, size_t alinhamento) override;
+    bool do_is_equal(const std::pmr::memory_resource& outro) const noexcept override;
+
+private:
+    /// Cabeçalho de um bloco de excesso (fica logo antes dos dados)
+    struct BlocoExcesso {
+        BlocoExcesso* proximo;
+        size_t bytesTotais;
+        size_t alinhamento;
+    };
+
+    std::pmr::memory_resource* reserva;
+    unsigned char* memoria;
+    size_t capacidade;
+    std::atomic<size_t> usado;
+
+    std::mutex travaExcesso;
+    BlocoExcesso* excessos;
+    size_t bytesExcesso;
+    size_t alocacoesHeap;
+    size_t alocacoesHeapUltimoQuadro;
+    size_t pico;
+};
+
+#endif // ARENA_QUADRO_HPP
@@ -0,0 +1,54 @@
+#include "ArquivoMapeado.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+ArquivoMapeado::~ArquivoMapeado() {
+    fechar();
+}
+
+ArquivoMapeado::ArquivoMapeado(ArquivoMapeado&& outro) noexcept
+    : dados(std::exchange(outro.dados, nullptr)),
+      tamanho(std::exchange(outro.tamanho, 0))
+{
+}
+
+ArquivoMapeado& ArquivoMapeado::operator=(ArquivoMapeado&& outro) noexcept {
+    if (this != &outro) {
+        fechar();
+        dados = std::exchange(outro.dados, nullptr);
+        tamanho = std::exchange(outro.tamanho, 0);
+    }
+    return *this;
+}
+
+bool ArquivoMapeado::abrir(const std::string& caminho, bool sequencial) {
+    fechar();
+
+    int descritor = ::open(caminho.c_str(), O_RDONLY);
+    if (descritor < 0) return false;
+
+    struct stat info;
+    if (::fstat(descritor, &info) != 0 || info.st_size <= 0) {
+        ::close(descritor);
+        return false;
+    }
+
+    // O mapeamento continua válido depois de fechar o descritor
+    void* mapa = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descritor, 0);
+    ::close(descritor);
+    if (mapa == MAP_FAILED) return false;
+
+    if (sequencial) ::madvise(mapa, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+    dados = static_cast<const unsigned char*>(mapa);
+    tamanho = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+void ArquivoMapeado::fechar() {
+    if (dados) ::munmap(const_cast<unsigned char*>(dados), tamanho);
+    dados = nullptr;
+    tamanho = 0;
+}
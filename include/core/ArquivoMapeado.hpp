@@ -0,0 +1,47 @@
+#ifndef ARQUIVO_MAPEADO_HPP
+#define ARQUIVO_MAPEADO_HPP
+
+#include <cstddef>
+#include <string>
+
+/**
+ * @class ArquivoMapeado
+ * @brief Arquivo inteiro mapeado em memória, só para leitura (mmap)
+ *
+ * Abrir não lê nada: as páginas entram na memória quando são tocadas pela
+ * primeira vez (falta de página), direto do cache do sistema operacional
+ * e sem cópia para um buffer do processo. Estruturas gravadas com o mesmo
+ * layout da memória podem ser usadas no lugar, sem desserializar.
+ *
+ * O mapeamento vive até o destrutor ou fechar(); ponteiros de getDados()
+ * não podem passar disso.
+ */
+class ArquivoMapeado {
+public:
+    ArquivoMapeado() = default;
+    ~ArquivoMapeado();
+
+    ArquivoMapeado(const ArquivoMapeado&) = delete;
+    ArquivoMapeado& operator=(const ArquivoMapeado&) = delete;
+    ArquivoMapeado(ArquivoMapeado&& outro) noexcept;
+    ArquivoMapeado& operator=(ArquivoMapeado&& outro) noexcept;
+
+    /**
+     * @brief Mapeia o arquivo (fecha o anterior, se houver)
+     *
+     * @param sequencial - Avisa o kernel para ler adiante (leitura do início ao fim)
+     * @return bool - false se o arquivo não existir, estiver vazio ou não puder ser mapeado
+     */
+    bool abrir(const std::string& caminho, bool sequencial = true);
+    void fechar();
+
+    const unsigned char* getDados() const { return dados; }
+    size_t getTamanho() const { return tamanho; }
+    bool aberto() const { return dados != nullptr; }
+
+private:
+    const unsigned char* dados = nullptr;
+    size_t tamanho = 0;
+};
+
+#endif // ARQUIVO_MAPEADO_HPP
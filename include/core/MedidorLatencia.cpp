@@ -0,0 +1,98 @@
+#include "MedidorLatencia.hpp"
+#include <algorithm>
+#include <iomanip>
+
+MedidorLatencia::MedidorLatencia() : apresentouAlgum(false) {
+    ordenacao.reserve(MAX_AMOSTRAS);
+}
+
+// ========== Pontos de Medição ==========
+
+void MedidorLatencia::evento() {
+    relogio::time_point agora = relogio::now();
+    std::lock_guard<std::mutex> lk(trava);
+    if (pendentes.numEventos < EVENTOS_POR_QUADRO) {
+        pendentes.eventos[pendentes.numEventos++] = agora;
+    }
+}
+
+void MedidorLatencia::amostrou(unsigned long quadro) {
+    std::lock_guard<std::mutex> lk(trava);
+    if (pendentes.numEventos == 0) return;
+
+    // Se o quadro já tinha eventos (várias amostras no mesmo quadro), junta
+    QuadroEmVoo& destino = emVoo[quadro % QUADROS_EM_VOO];
+    if (destino.quadro != quadro) {
+        destino.quadro = quadro;
+        destino.numEventos = 0;
+    }
+    for (size_t i = 0; i < pendentes.numEventos && destino.numEventos < EVENTOS_POR_QUADRO; i++) {
+        destino.eventos[destino.numEventos++] = pendentes.eventos[i];
+    }
+    pendentes.numEventos = 0;
+}
+
+void MedidorLatencia::apresentou(unsigned long quadro) {
+    relogio::time_point agora = relogio::now();
+    std::lock_guard<std::mutex> lk(trava);
+
+    if (apresentouAlgum) {
+        quadros.adicionar(std::chrono::duration<float, std::milli>(agora - ultimaApresentacao).count());
+    }
+    ultimaApresentacao = agora;
+    apresentouAlgum = true;
+
+    QuadroEmVoo& q = emVoo[quadro % QUADROS_EM_VOO];
+    if (q.quadro != quadro) return;
+    for (size_t i = 0; i < q.numEventos; i++) {
+        latencias.adicionar(std::chrono::duration<float, std::milli>(agora - q.eventos[i]).count());
+    }
+    q.numEventos = 0;
+}
+
+void MedidorLatencia::reiniciar() {
+    std::lock_guard<std::mutex> lk(trava);
+    latencias.total = 0;
+    quadros.total = 0;
+    apresentouAlgum = false;
+}
+
+// ========== Resultados ==========
+
+Percentis MedidorLatencia::calcular(const Serie& serie) const {
+    Percentis r;
+    r.amostras = serie.tamanho();
+    if (r.amostras == 0) return r;
+
+    ordenacao.assign(serie.valores, serie.valores + r.amostras);
+    std::sort(ordenacao.begin(), ordenacao.end());
+    auto percentil = [this](double p) {
+        size_t i = static_cast<size_t>(p * (ordenacao.size() - 1) + 0.5);
+        return static_cast<double>(ordenacao[i]);
+    };
+    r.p50 = percentil(0.50);
+    r.p90 = percentil(0.90);
+    r.p99 = percentil(0.99);
+    r.maximo = ordenacao.back();
+    return r;
+}
+
+Percentis MedidorLatencia::latenciaEntrada() const {
+    std::lock_guard<std::mutex> lk(trava);
+    return calcular(latencias);
+}
+
+Percentis MedidorLatencia::tempoQuadro() const {
+    std::lock_guard<std::mutex> lk(trava);
+    return calcular(quadros);
+}
+
+void MedidorLatencia::relatorio(std::ostream& saida, const char* titulo) const {
+    Percentis e = latenciaEntrada();
+    Percentis q = tempoQuadro();
+    saida << std::fixed << std::setprecision(1) << titulo
+          << " | entrada->tela (" << e.amostras << " eventos): p50 " << e.p50 << " p90 " << e.p90
+          << " p99 " << e.p99 << " max " << e.maximo << " ms"
+          << " | quadro: p50 " << q.p50 << " p99 " << q.p99 << " max " << q.maximo << " ms"
+          << std::defaultfloat << std::endl;
+}
@@ -0,0 +1,94 @@
+#ifndef MEDIDOR_LATENCIA_HPP
+#define MEDIDOR_LATENCIA_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+/**
+ * @struct Percentis
+ * @brief Resumo de uma série de amostras, em milissegundos
+ */
+struct Percentis {
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double maximo = 0.0;
+    size_t amostras = 0;
+};
+
+/**
+ * @class MedidorLatencia
+ * @brief Latência da entrada até a tela (input-to-photon) e tempo de quadro
+ *
+ * Acompanha cada evento de entrada por três pontos:
+ * 1. evento(): o evento chegou (callback de tecla, durante glfwPollEvents)
+ * 2. amostrou(quadro): a simulação leu as teclas para o quadro `quadro`;
+ *    todos os eventos pendentes passam a pertencer a ele
+ * 3. apresentou(quadro): o glfwSwapBuffers desse quadro retornou
+ *
+ * A latência de um evento é do passo 1 ao 3. O tempo que o sistema
+ * operacional levou para entregar o evento não é visível para o GLFW, e o
+ * retorno do swap não é o instante exato em que o monitor acende: os
+ * valores são um limite inferior, bons para comparar modos entre si.
+ *
+ * evento() e amostrou() rodam na thread do jogo e apresentou() na de
+ * render; uma trava protege tudo (poucas chamadas por quadro). As amostras
+ * ficam em anéis de capacidade fixa e os percentis usam um buffer
+ * reservado: nada aloca depois do construtor.
+ */
+class MedidorLatencia {
+public:
+    static constexpr size_t MAX_AMOSTRAS = 2048;        ///< Janela das séries (as mais recentes)
+    static constexpr size_t QUADROS_EM_VOO = 8;         ///< Amostrados e ainda não apresentados
+    static constexpr size_t EVENTOS_POR_QUADRO = 16;    ///< Excedentes do mesmo quadro são ignorados
+
+    MedidorLatencia();
+
+    // ========== Pontos de Medição ==========
+    void evento();
+    void amostrou(unsigned long quadro);
+    void apresentou(unsigned long quadro);
+
+    /// Descarta as séries (ex.: ao trocar de modo, para não misturar as medições)
+    void reiniciar();
+
+    // ========== Resultados ==========
+    Percentis latenciaEntrada() const;
+    Percentis tempoQuadro() const;
+
+    /// Uma linha com latência e tempo de quadro, precedida por `titulo`
+    void relatorio(std::ostream& saida, const char* titulo) const;
+
+private:
+    using relogio = std::chrono::steady_clock;
+
+    struct QuadroEmVoo {
+        unsigned long quadro = 0;
+        size_t numEventos = 0;
+        relogio::time_point eventos[EVENTOS_POR_QUADRO];
+    };
+
+    /// Anel de amostras em ms
+    struct Serie {
+        float valores[MAX_AMOSTRAS];
+        size_t total = 0;
+        void adicionar(float v) { valores[total++ % MAX_AMOSTRAS] = v; }
+        size_t tamanho() const { return total < MAX_AMOSTRAS ? total : MAX_AMOSTRAS; }
+    };
+
+    mutable std::mutex trava;
+    QuadroEmVoo pendentes;                 ///< Eventos ainda não lidos pela simulação
+    QuadroEmVoo emVoo[QUADROS_EM_VOO];
+    Serie latencias;
+    Serie quadros;
+    relogio::time_point ultimaApresentacao;
+    bool apresentouAlgum;
+    mutable std::vector<float> ordenacao;  ///< Cópia para os percentis (capacidade reservada)
+
+    Percentis calcular(const Serie& serie) const;
+};
+
+#endif // MEDIDOR_LATENCIA_HPP
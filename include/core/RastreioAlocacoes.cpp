@@ -0,0 +1,145 @@
+#include "RastreioAlocacoes.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static const size_t NUM_SUBSISTEMAS = static_cast<size_t>(Subsistema::total);
+
+// Contadores globais (relaxed: só precisam ser exatos no fim do quadro)
+static std::atomic<size_t> contAlocacoes[NUM_SUBSISTEMAS];
+static std::atomic<size_t> contBytes[NUM_SUBSISTEMAS];
+static std::atomic<size_t> contLiberacoes[NUM_SUBSISTEMAS];
+
+// Subsistema ativo na thread atual
+static thread_local Subsistema subsistemaAtual = Subsistema::geral;
+
+// ========== Escopo ==========
+
+EscopoAlocacao::EscopoAlocacao(Subsistema s) : anterior(subsistemaAtual) {
+    subsistemaAtual = s;
+}
+
+EscopoAlocacao::~EscopoAlocacao() {
+    subsistemaAtual = anterior;
+}
+
+// ========== Consulta ==========
+
+bool rastreioAtivo() {
+#ifdef RASTREAR_ALOCACOES
+    return true;
+#else
+    return false;
+#endif
+}
+
+void iniciarQuadroAlocacoes() {
+    for (size_t i = 0; i < NUM_SUBSISTEMAS; i++) {
+        contAlocacoes[i].store(0, std::memory_order_relaxed);
+        contBytes[i].store(0, std::memory_order_relaxed);
+        contLiberacoes[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+ContagemAlocacoes alocacoesDoQuadro(Subsistema s) {
+    size_t i = static_cast<size_t>(s);
+    return ContagemAlocacoes{
+        contAlocacoes[i].load(std::memory_order_relaxed),
+        contBytes[i].load(std::memory_order_relaxed),
+        contLiberacoes[i].load(std::memory_order_relaxed)
+    };
+}
+
+ContagemAlocacoes alocacoesTotaisDoQuadro() {
+    ContagemAlocacoes total{0, 0, 0};
+    for (size_t i = 0; i < NUM_SUBSISTEMAS; i++) {
+        ContagemAlocacoes c = alocacoesDoQuadro(static_cast<Subsistema>(i));
+        total.alocacoes += c.alocacoes;
+        total.bytes += c.bytes;
+        total.liberacoes += c.liberacoes;
+    }
+    return total;
+}
+
+const char* nomeSubsistema(Subsistema s) {
+    switch (s) {
+        case Subsistema::geral:     return "geral";
+        case Subsistema::fisica:    return "fisica";
+        case Subsistema::geometria: return "geometria";
+        case Subsistema::render:    return "render";
+        case Subsistema::jobs:      return "jobs";
+        default:                    return "?";
+    }
+}
+
+void relatorioAlocacoes(std::ostream& saida) {
+    // Copia tudo antes de imprimir: o próprio ostream pode alocar
+    ContagemAlocacoes c[NUM_SUBSISTEMAS];
+    for (size_t i = 0; i < NUM_SUBSISTEMAS; i++) {
+        c[i] = alocacoesDoQuadro(static_cast<Subsistema>(i));
+    }
+    for (size_t i = 0; i < NUM_SUBSISTEMAS; i++) {
+        if (c[i].alocacoes == 0 && c[i].liberacoes == 0) continue;
+        saida << "  " << nomeSubsistema(static_cast<Subsistema>(i)) << ": "
+              << c[i].alocacoes << " alocações, " << c[i].bytes << " bytes, "
+              << c[i].liberacoes << " liberações\n";
+    }
+}
+
+// ========== Operadores Globais (apenas com -DRASTREAR_ALOCACOES) ==========
+
+#ifdef RASTREAR_ALOCACOES
+
+static void contarAlocacao(size_t bytes) {
+    size_t i = static_cast<size_t>(subsistemaAtual);
+    contAlocacoes[i].fetch_add(1, std::memory_order_relaxed);
+    contBytes[i].fetch_add(bytes, std::memory_order_relaxed);
+}
+
+static void contarLiberacao(void* p) {
+    if (!p) return;
+    size_t i = static_cast<size_t>(subsistemaAtual);
+    contLiberacoes[i].fetch_add(1, std::memory_order_relaxed);
+}
+
+static void* alocarRastreado(size_t bytes) {
+    contarAlocacao(bytes);
+    void* p = std::malloc(bytes ? bytes : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+static void* alocarRastreadoAlinhado(size_t bytes, std::align_val_t alinhamento) {
+    contarAlocacao(bytes);
+    size_t a = static_cast<size_t>(alinhamento);
+    // aligned_alloc exige tamanho múltiplo do alinhamento
+    size_t tamanho = (bytes + a - 1) / a * a;
+    void* p = std::aligned_alloc(a, tamanho ? tamanho : a);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(size_t bytes) { return alocarRastreado(bytes); }
+void* operator new[](size_t bytes) { return alocarRastreado(bytes); }
+void* operator new(size_t bytes, std::align_val_t a) { return alocarRastreadoAlinhado(bytes, a); }
+void* operator new[](size_t bytes, std::align_val_t a) { return alocarRastreadoAlinhado(bytes, a); }
+
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept {
+    try { return alocarRastreado(bytes); } catch (...) { return nullptr; }
+}
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept {
+    try { return alocarRastreado(bytes); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* p) noexcept { contarLiberacao(p); std::free(p); }
+void operator delete[](void* p) noexcept { contarLiberacao(p); std::free(p); }
+void operator delete(void* p, size_t) noexcept { contarLiberacao(p); std::free(p); }
+void operator delete[](void* p, size_t) noexcept { contarLiberacao(p); std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { contarLiberacao(p); std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { contarLiberacao(p); std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { contarLiberacao(p); std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { contarLiberacao(p); std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { contarLiberacao(p); std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { contarLiberacao(p); std::free(p); }
+
+#endif // RASTREAR_ALOCACOES
@@ -0,0 +1,81 @@
+#ifndef RASTREIO_ALOCACOES_HPP
+#define RASTREIO_ALOCACOES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+/**
+ * Rastreio de alocações na heap (opcional)
+ *
+ * Compilando com -DRASTREAR_ALOCACOES, os operadores globais new/delete são
+ * substituídos por versões que contam alocações e bytes, separados pelo
+ * subsistema ativo na thread (EscopoAlocacao). Sem a flag, nada é
+ * substituído e todas as contagens ficam em zero.
+ *
+ * Uso por quadro:
+ * @code
+ * iniciarQuadroAlocacoes();
+ * {
+ *     EscopoAlocacao escopo(Subsistema::fisica);
+ *     mundo.passo(dt, &jobs, &arena);
+ * }
+ * ContagemAlocacoes c = alocacoesDoQuadro(Subsistema::fisica);
+ * @endcode
+ */
+
+/// Subsistemas que podem ser marcados com EscopoAlocacao
+enum class Subsistema : uint8_t {
+    geral = 0,   ///< Fora de qualquer escopo
+    fisica,
+    geometria,
+    render,
+    jobs,
+    total        ///< Quantidade de subsistemas (não é um subsistema)
+};
+
+/// Contagem de um subsistema desde iniciarQuadroAlocacoes()
+struct ContagemAlocacoes {
+    size_t alocacoes;
+    size_t bytes;
+    size_t liberacoes;
+};
+
+/**
+ * @class EscopoAlocacao
+ * @brief Marca as alocações desta thread com um subsistema enquanto existir
+ *
+ * Escopos podem ser aninhados; o destrutor restaura o anterior. A marca é
+ * por thread: jobs executados em outras threads precisam do próprio escopo.
+ */
+class EscopoAlocacao {
+public:
+    explicit EscopoAlocacao(Subsistema s);
+    ~EscopoAlocacao();
+
+    EscopoAlocacao(const EscopoAlocacao&) = delete;
+    EscopoAlocacao& operator=(const EscopoAlocacao&) = delete;
+
+private:
+    Subsistema anterior;
+};
+
+/// true se o programa foi compilado com -DRASTREAR_ALOCACOES
+bool rastreioAtivo();
+
+/// Zera as contagens de todos os subsistemas (chamar no início do quadro)
+void iniciarQuadroAlocacoes();
+
+/// Contagem de um subsistema no quadro atual
+ContagemAlocacoes alocacoesDoQuadro(Subsistema s);
+
+/// Soma de todos os subsistemas no quadro atual
+ContagemAlocacoes alocacoesTotaisDoQuadro();
+
+/// Nome legível do subsistema
+const char* nomeSubsistema(Subsistema s);
+
+/// Imprime uma linha por subsistema com alocações no quadro atual
+void relatorioAlocacoes(std::ostream& saida);
+
+#endif // RASTREIO_ALOCACOES_HPP
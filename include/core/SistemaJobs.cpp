@@ -0,0 +1,174 @@
+#include "SistemaJobs.hpp"
+
+// Pool e índice da fila da thread atual (nullptr/-1 para threads que não são de um pool)
+static thread_local const SistemaJobs* poolAtual = nullptr;
+static thread_local int indiceAtual = -1;
+
+// A fila própria só vale no pool dono da thread: uma trabalhadora de outro
+// pool que envia trabalho para este é tratada como thread de fora
+static int indiceNoPool(const SistemaJobs* pool) {
+    return poolAtual == pool ? indiceAtual : -1;
+}
+
+// 0 = um núcleo fica para a thread que envia o trabalho, o resto vira trabalhadora
+static unsigned calcularTrabalhadoras(unsigned pedido) {
+    if (pedido > 0) return pedido;
+    unsigned nucleos = std::thread::hardware_concurrency();
+    return nucleos > 1 ? nucleos - 1 : 0;
+}
+
+// ========== Construtor e Destrutor ==========
+
+SistemaJobs::SistemaJobs(unsigned numTrabalhadoras)
+    : filas(calcularTrabalhadoras(numTrabalhadoras)),
+      pendentes(0),
+      roubos(0),
+      rodando(true)
+{
+    // Uma fila por trabalhadora (o vetor nunca muda de tamanho: Fila tem mutex)
+    unsigned total = static_cast<unsigned>(filas.size());
+    trabalhadoras.reserve(total);
+    for (unsigned i = 0; i < total; i++) {
+        trabalhadoras.emplace_back(&SistemaJobs::laco, this, i);
+    }
+}
+
+SistemaJobs::~SistemaJobs() {
+    {
+        std::lock_guard<std::mutex> lk(travaSono);
+        rodando = false;
+    }
+    acordar.notify_all();
+    for (auto& t : trabalhadoras) {
+        t.join();
+    }
+}
+
+// ========== Execução ==========
+
+void SistemaJobs::executarIntervalo(size_t n, size_t tamanhoLote, FuncaoJob funcao, void* dados) {
+    if (n == 0) return;
+    if (tamanhoLote == 0) tamanhoLote = 1;
+
+    size_t numJobs = (n + tamanhoLote - 1) / tamanhoLote;
+
+    // Sem trabalhadoras ou com um único lote não vale a pena enfileirar
+    if (trabalhadoras.empty() || numJobs == 1) {
+        funcao(dados, 0, n);
+        return;
+    }
+
+    std::atomic<size_t> restantes(numJobs);
+    int indice = indiceNoPool(this);
+
+    // Conta os jobs antes de publicá-los: quem retirar um já encontra o
+    // contador incrementado (nunca passa por baixo de zero). O incremento
+    // sob a trava do sono evita perder um notify
+    {
+        std::lock_guard<std::mutex> lk(travaSono);
+        pendentes.fetch_add(numJobs, std::memory_order_release);
+    }
+
+    // Jobs criados dentro de um job ficam na fila da própria trabalhadora;
+    // os da thread principal são espalhados entre as filas (round-robin)
+    size_t numFilas = trabalhadoras.size();
+    size_t naoEnfileirados = 0;
+    for (size_t j = 0; j < numJobs; j++) {
+        size_t inicio = j * tamanhoLote;
+        size_t fim = inicio + tamanhoLote < n ? inicio + tamanhoLote : n;
+        size_t alvo = indice >= 0 ? static_cast<size_t>(indice) : j % numFilas;
+        Job novo{funcao, dados, inicio, fim, &restantes};
+
+        Fila& f = filas[alvo];
+        bool cabe;
+        {
+            std::lock_guard<std::mutex> lk(f.trava);
+            cabe = f.tamanho < CAPACIDADE_FILA;
+            if (cabe) {
+                f.anel[(f.inicio + f.tamanho) % CAPACIDADE_FILA] = novo;
+                f.tamanho++;
+            }
+        }
+        if (!cabe) {
+            // Fila cheia: executa aqui mesmo em vez de alocar mais espaço
+            naoEnfileirados++;
+            executar(novo);
+        }
+    }
+    if (naoEnfileirados > 0) {
+        pendentes.fetch_sub(naoEnfileirados, std::memory_order_relaxed);
+    }
+    acordar.notify_all();
+
+    // A thread que enviou ajuda até o último job do lote terminar
+    Job job;
+    while (restantes.load(std::memory_order_acquire) != 0) {
+        if (tentarObter(indice, job)) {
+            executar(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void SistemaJobs::executar(const Job& job) {
+    job.funcao(job.dados, job.inicio, job.fim);
+    job.restantes->fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool SistemaJobs::tentarObter(int indice, Job& job) {
+    int numFilas = static_cast<int>(filas.size());
+
+    // 1. Fila própria, pelo fim (LIFO)
+    if (indice >= 0) {
+        Fila& propria = filas[indice];
+        std::lock_guard<std::mutex> lk(propria.trava);
+        if (propria.tamanho > 0) {
+            propria.tamanho--;
+            job = propria.anel[(propria.inicio + propria.tamanho) % CAPACIDADE_FILA];
+            pendentes.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // 2. Rouba das outras filas, pelo início (os jobs mais antigos)
+    int partida = indice >= 0 ? indice + 1 : 0;
+    for (int k = 0; k < numFilas; k++) {
+        int vitima = (partida + k) % numFilas;
+        if (vitima == indice) continue;
+
+        Fila& f = filas[vitima];
+        std::lock_guard<std::mutex> lk(f.trava);
+        if (f.tamanho > 0) {
+            job = f.anel[f.inicio];
+            f.inicio = (f.inicio + 1) % CAPACIDADE_FILA;
+            f.tamanho--;
+            pendentes.fetch_sub(1, std::memory_order_relaxed);
+            if (indice >= 0) {
+                roubos.fetch_add(1, std::memory_order_relaxed);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void SistemaJobs::laco(unsigned indice) {
+    poolAtual = this;
+    indiceAtual = static_cast<int>(indice);
+
+    Job job;
+    while (true) {
+        if (tentarObter(indiceAtual, job)) {
+            executar(job);
+            continue;
+        }
+
+        // Sem trabalho: dorme até chegar um lote novo ou o pool encerrar
+        std::unique_lock<std::mutex> lk(travaSono);
+        acordar.wait(lk, [this] {
+            return pendentes.load(std::memory_order_acquire) > 0 || !rodando;
+        });
+        if (!rodando) return;
+    }
+}
@@ -0,0 +1,144 @@
+#ifndef SISTEMA_JOBS_HPP
+#define SISTEMA_JOBS_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class SistemaJobs
+ * @brief Pool fixo de threads com roubo de trabalho (work stealing)
+ *
+ * Cada thread trabalhadora tem sua própria fila dupla (deque). A dona
+ * consome pelo fim (LIFO, dados ainda quentes na cache) e as outras
+ * roubam pelo início quando ficam sem trabalho. A thread que envia o
+ * trabalho não fica parada esperando: ela também executa jobs até o
+ * lote terminar.
+ *
+ * Uso típico:
+ * @code
+ * SistemaJobs jobs;                       // hardware_concurrency() - 1 trabalhadoras
+ * jobs.paraCada(n, 64, [&](size_t i) {    // lotes de 64 índices
+ *     processar(i);
+ * });                                     // retorna quando todos terminaram
+ * @endcode
+ *
+ * Os jobs não alocam memória: cada um é só um ponteiro de função,
+ * um ponteiro de dados e um intervalo [inicio, fim), guardado num anel
+ * de capacidade fixa. Se uma fila encher, o job roda na hora.
+ */
+class SistemaJobs {
+public:
+    /// Função executada por um job sobre o intervalo [inicio, fim)
+    using FuncaoJob = void (*)(void* dados, size_t inicio, size_t fim);
+
+    // ========== Construtor e Destrutor ==========
+
+    /**
+     * @brief Cria o pool de threads
+     *
+     * @param numTrabalhadoras - Número de threads (0 = núcleos da máquina - 1)
+     *
+     * Com 0 trabalhadoras (máquina de 1 núcleo) tudo roda na thread que chama.
+     */
+    explicit SistemaJobs(unsigned numTrabalhadoras = 0);
+
+    /**
+     * @brief Encerra e junta (join) todas as threads
+     */
+    ~SistemaJobs();
+
+    SistemaJobs(const SistemaJobs&) = delete;
+    SistemaJobs& operator=(const SistemaJobs&) = delete;
+
+    // ========== Execução Paralela ==========
+
+    /**
+     * @brief Divide [0, n) em lotes e executa em paralelo, bloqueando até o fim
+     *
+     * @param n - Quantidade de índices
+     * @param tamanhoLote - Índices por job (lotes grandes = menos overhead)
+     * @param funcao - Ponteiro para a função de cada lote
+     * @param dados - Ponteiro repassado para a função
+     */
+    void executarIntervalo(size_t n, size_t tamanhoLote, FuncaoJob funcao, void* dados);
+
+    /**
+     * @brief Versão de executarIntervalo que aceita um lambda f(inicio, fim)
+     *
+     * O índice do lote é inicio / tamanhoLote, útil para buffers por lote.
+     */
+    template <typename F>
+    void paraCadaIntervalo(size_t n, size_t tamanhoLote, F&& f) {
+        using Tipo = std::remove_reference_t<F>;
+        executarIntervalo(n, tamanhoLote, [](void* d, size_t inicio, size_t fim) {
+            (*static_cast<Tipo*>(d))(inicio, fim);
+        }, const_cast<void*>(static_cast<const void*>(&f)));
+    }
+
+    /**
+     * @brief Executa f(i) para cada i em [0, n) em paralelo (parallel-for)
+     */
+    template <typename F>
+    void paraCada(size_t n, size_t tamanhoLote, F&& f) {
+        paraCadaIntervalo(n, tamanhoLote, [&f](size_t inicio, size_t fim) {
+            for (size_t i = inicio; i < fim; i++) {
+                f(i);
+            }
+        });
+    }
+
+    // ========== Getters ==========
+
+    /**
+     * @brief Número de threads que executam jobs (trabalhadoras + a que chama)
+     * @return unsigned - Grau de paralelismo
+     */
+    unsigned getNumThreads() const { return static_cast<unsigned>(trabalhadoras.size()) + 1; }
+
+    /**
+     * @brief Quantos jobs foram roubados de outra fila desde a criação
+     * @return size_t - Contador de roubos (indicador de balanceamento)
+     */
+    size_t getRoubos() const { return roubos.load(std::memory_order_relaxed); }
+
+private:
+    struct Job {
+        FuncaoJob funcao;
+        void* dados;
+        size_t inicio;
+        size_t fim;
+        std::atomic<size_t>* restantes; ///< Contador do lote ao qual o job pertence
+    };
+
+    /// Capacidade do anel de cada fila
+    static constexpr size_t CAPACIDADE_FILA = 1024;
+
+    /// Fila dupla de uma trabalhadora em anel fixo (a mutex é por fila, não global)
+    struct Fila {
+        std::mutex trava;
+        std::vector<Job> anel;
+        size_t inicio = 0;   ///< Posição do job mais antigo (por onde se rouba)
+        size_t tamanho = 0;  ///< Jobs na fila; o mais novo fica em inicio + tamanho - 1
+
+        Fila() : anel(CAPACIDADE_FILA) {}
+    };
+
+    std::vector<std::thread> trabalhadoras;
+    std::vector<Fila> filas;                ///< Uma por trabalhadora
+    std::atomic<size_t> pendentes;          ///< Jobs anunciados (contados antes de entrar na fila) ainda não retirados
+    std::atomic<size_t> roubos;
+    std::atomic<bool> rodando;
+    std::mutex travaSono;
+    std::condition_variable acordar;
+
+    void laco(unsigned indice);
+    bool tentarObter(int indice, Job& job);
+    void executar(const Job& job);
+};
+
+#endif // SISTEMA_JOBS_HPP
@@ -0,0 +1,209 @@
+#include "ColisaoSAT.hpp"
+#include <cfloat>
+#include <cmath>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// ========== PoligonoConvexo ==========
+
+void PoligonoConvexo::definir(const float* xy, size_t n) {
+    // Pontos repetidos em sequência (inclusive o último igual ao primeiro)
+    // dariam arestas de comprimento zero, com normal (0, 0): nesse eixo as
+    // projeções são [0, 0] e o teste acusaria separação falsa
+    x.clear();
+    y.clear();
+    for (size_t i = 0; i < n; i++) {
+        float px = xy[i * 2];
+        float py = xy[i * 2 + 1];
+        if (!x.empty() && px == x.back() && py == y.back()) continue;
+        x.push_back(px);
+        y.push_back(py);
+    }
+    while (x.size() > 1 && x.back() == x.front() && y.back() == y.front()) {
+        x.pop_back();
+        y.pop_back();
+    }
+    numVertices = x.size();
+
+    // Área com sinal decide se os pontos ficam na ordem ou são invertidos
+    float area = 0.0f;
+    for (size_t i = 0, j = numVertices - 1; i < numVertices; j = i++) {
+        area += x[j] * y[i] - x[i] * y[j];
+    }
+    if (area < 0.0f) {
+        for (size_t i = 0, j = numVertices - 1; i < j; i++, j--) {
+            std::swap(x[i], x[j]);
+            std::swap(y[i], y[j]);
+        }
+    }
+
+    // Normal externa de cada aresta no sentido anti-horário: (dy, -dx) normalizada.
+    // Um polígono reduzido a um ponto (escala zero) não tem arestas: usa os eixos X e Y
+    numNormais = numVertices > 1 ? numVertices : 2;
+    size_t eixos = (numNormais + LARGURA_SIMD - 1) / LARGURA_SIMD * LARGURA_SIMD;
+    normalX.resize(eixos);
+    normalY.resize(eixos);
+    if (numVertices > 1) {
+        for (size_t i = 0; i < numVertices; i++) {
+            size_t proximo = i + 1 < numVertices ? i + 1 : 0;
+            float dx = x[proximo] - x[i];
+            float dy = y[proximo] - y[i];
+            float inverso = 1.0f / std::sqrt(dx * dx + dy * dy);
+            normalX[i] = dy * inverso;
+            normalY[i] = -dx * inverso;
+        }
+    } else {
+        normalX[0] = 1.0f; normalY[0] = 0.0f;
+        normalX[1] = 0.0f; normalY[1] = 1.0f;
+    }
+    for (size_t i = numNormais; i < eixos; i++) {
+        normalX[i] = normalX[0];
+        normalY[i] = normalY[0];
+    }
+}
+
+void PoligonoConvexo::regular(float cx, float cy, int lados, float raio, float rotacao) {
+    // Até 64 lados na pilha; acima disso o polígono é quase um círculo
+    float pontos[128];
+    int n = lados < 3 ? 3 : (lados > 64 ? 64 : lados);
+    for (int i = 0; i < n; i++) {
+        float angulo = rotacao + 1.5707963f + 6.2831853f * static_cast<float>(i) / static_cast<float>(n);
+        pontos[i * 2] = cx + raio * std::cos(angulo);
+        pontos[i * 2 + 1] = cy + raio * std::sin(angulo);
+    }
+    definir(pontos, static_cast<size_t>(n));
+}
+
+void PoligonoConvexo::retangulo(float cx, float cy, float meiaLargura, float meiaAltura, float rotacao) {
+    float c = std::cos(rotacao);
+    float s = std::sin(rotacao);
+    const float cantos[4][2] = {
+        { -meiaLargura, -meiaAltura }, { meiaLargura, -meiaAltura },
+        { meiaLargura, meiaAltura }, { -meiaLargura, meiaAltura }
+    };
+    float pontos[8];
+    for (int i = 0; i < 4; i++) {
+        pontos[i * 2] = cx + c * cantos[i][0] - s * cantos[i][1];
+        pontos[i * 2 + 1] = cy + s * cantos[i][0] + c * cantos[i][1];
+    }
+    definir(pontos, 4);
+}
+
+// ========== Versão Escalar ==========
+
+static void projetar(const PoligonoConvexo& p, float nx, float ny, float& minimo, float& maximo) {
+    minimo = FLT_MAX;
+    maximo = -FLT_MAX;
+    for (size_t v = 0; v < p.numVertices; v++) {
+        float d = p.x[v] * nx + p.y[v] * ny;
+        minimo = d < minimo ? d : minimo;
+        maximo = d > maximo ? d : maximo;
+    }
+}
+
+bool colidirSATEscalar(const PoligonoConvexo& a, const PoligonoConvexo& b, ResultadoSAT* mtv) {
+    float melhor = FLT_MAX;
+    float melhorX = 0.0f;
+    float melhorY = 0.0f;
+
+    const PoligonoConvexo* donos[2] = { &a, &b };
+    for (const PoligonoConvexo* dono : donos) {
+        for (size_t e = 0; e < dono->numNormais; e++) {
+            float nx = dono->normalX[e];
+            float ny = dono->normalY[e];
+            float minA, maxA, minB, maxB;
+            projetar(a, nx, ny, minA, maxA);
+            projetar(b, nx, ny, minB, maxB);
+
+            // Sobreposição das projeções; <= 0 é um eixo separador. Se o lado
+            // menor é o de B antes de A, B sai pelo sentido contrário da normal
+            float avancoB = maxA - minB;
+            float recuoB = maxB - minA;
+            float sobreposicao = std::fmin(avancoB, recuoB);
+            if (sobreposicao <= 0.0f) return false;
+            if (sobreposicao < melhor) {
+                melhor = sobreposicao;
+                melhorX = recuoB < avancoB ? -nx : nx;
+                melhorY = recuoB < avancoB ? -ny : ny;
+            }
+        }
+    }
+
+    if (mtv) {
+        mtv->normalX = melhorX;
+        mtv->normalY = melhorY;
+        mtv->profundidade = melhor;
+    }
+    return true;
+}
+
+// ========== Versão SIMD ==========
+
+bool colidirSAT(const PoligonoConvexo& a, const PoligonoConvexo& b, ResultadoSAT* mtv) {
+#if defined(__SSE2__)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 infinito = _mm_set1_ps(FLT_MAX);
+    const __m128 menosInfinito = _mm_set1_ps(-FLT_MAX);
+    const __m128 bitSinal = _mm_set1_ps(-0.0f);
+    auto seleciona = [](__m128 m, __m128 s, __m128 n) { return _mm_or_ps(_mm_and_ps(m, s), _mm_andnot_ps(m, n)); };
+
+    // Melhor eixo de cada pista; a redução entre pistas fica para o fim
+    __m128 melhor = infinito;
+    __m128 melhorX = zero;
+    __m128 melhorY = zero;
+
+    const PoligonoConvexo* donos[2] = { &a, &b };
+    for (const PoligonoConvexo* dono : donos) {
+        for (size_t e = 0; e < dono->getNumEixos(); e += PoligonoConvexo::LARGURA_SIMD) {
+            __m128 nx = _mm_loadu_ps(&dono->normalX[e]);
+            __m128 ny = _mm_loadu_ps(&dono->normalY[e]);
+
+            // Quatro eixos por vez: cada vértice difundido nas pistas
+            __m128 minA = infinito, maxA = menosInfinito;
+            for (size_t v = 0; v < a.numVertices; v++) {
+                __m128 d = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a.x[v]), nx), _mm_mul_ps(_mm_set1_ps(a.y[v]), ny));
+                minA = _mm_min_ps(minA, d);
+                maxA = _mm_max_ps(maxA, d);
+            }
+            __m128 minB = infinito, maxB = menosInfinito;
+            for (size_t v = 0; v < b.numVertices; v++) {
+                __m128 d = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(b.x[v]), nx), _mm_mul_ps(_mm_set1_ps(b.y[v]), ny));
+                minB = _mm_min_ps(minB, d);
+                maxB = _mm_max_ps(maxB, d);
+            }
+
+            __m128 avancoB = _mm_sub_ps(maxA, minB);
+            __m128 recuoB = _mm_sub_ps(maxB, minA);
+            __m128 sobreposicao = _mm_min_ps(avancoB, recuoB);
+            if (_mm_movemask_ps(_mm_cmple_ps(sobreposicao, zero))) return false;
+
+            // Normal invertida (bit de sinal) nas pistas em que B sai para trás
+            __m128 inverter = _mm_and_ps(_mm_cmplt_ps(recuoB, avancoB), bitSinal);
+            __m128 menor = _mm_cmplt_ps(sobreposicao, melhor);
+            melhor = seleciona(menor, sobreposicao, melhor);
+            melhorX = seleciona(menor, _mm_xor_ps(nx, inverter), melhorX);
+            melhorY = seleciona(menor, _mm_xor_ps(ny, inverter), melhorY);
+        }
+    }
+
+    if (mtv) {
+        alignas(16) float pistas[3][4];
+        _mm_store_ps(pistas[0], melhor);
+        _mm_store_ps(pistas[1], melhorX);
+        _mm_store_ps(pistas[2], melhorY);
+        int escolhida = 0;
+        for (int i = 1; i < 4; i++) {
+            if (pistas[0][i] < pistas[0][escolhida]) escolhida = i;
+        }
+        mtv->normalX = pistas[1][escolhida];
+        mtv->normalY = pistas[2][escolhida];
+        mtv->profundidade = pistas[0][escolhida];
+    }
+    return true;
+#else
+    return colidirSATEscalar(a, b, mtv);
+#endif
+}
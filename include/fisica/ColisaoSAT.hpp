@@ -0,0 +1,82 @@
+#ifndef COLISAO_SAT_HPP
+#define COLISAO_SAT_HPP
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct PoligonoConvexo
+ * @brief Polígono convexo em coordenadas do mundo, pronto para o teste SAT
+ *
+ * Vértices em SoA e no sentido anti-horário, com a normal unitária externa
+ * de cada aresta (aresta i vai do vértice i ao i + 1) calculada uma vez em
+ * definir(). Pontos repetidos em sequência são descartados antes, então
+ * toda normal é unitária. Os vetores de normais são completados até
+ * múltiplo de LARGURA_SIMD repetindo a primeira normal: um eixo repetido
+ * não muda o resultado, e o laço SIMD não precisa de resto escalar.
+ *
+ * Reutilizar o mesmo objeto quadro a quadro não aloca (os vetores só
+ * crescem).
+ */
+struct PoligonoConvexo {
+    static const size_t LARGURA_SIMD = 4;   ///< Eixos projetados por instrução
+
+    std::vector<float> x, y;                ///< Vértices (numVertices)
+    std::vector<float> normalX, normalY;    ///< Normais das arestas (completadas)
+    size_t numVertices = 0;                 ///< Vértices distintos
+    size_t numNormais = 0;                  ///< Normais reais, antes de completar
+
+    /**
+     * @brief Define o polígono a partir de pontos (x, y) em sequência
+     *
+     * @param xy - Pontos em qualquer orientação (convexidade não é verificada;
+     *             pontos repetidos em sequência são descartados)
+     * @param n - Quantidade de pontos (mínimo 3)
+     */
+    void definir(const float* xy, size_t n);
+
+    /// Polígono regular de `lados` lados (primeiro vértice em cima, como PoligonoRegular)
+    void regular(float cx, float cy, int lados, float raio, float rotacao = 0.0f);
+
+    /// Retângulo centrado em (cx, cy) girado de `rotacao` radianos
+    void retangulo(float cx, float cy, float meiaLargura, float meiaAltura, float rotacao = 0.0f);
+
+    /// Eixos depois de completar até múltiplo de LARGURA_SIMD
+    size_t getNumEixos() const { return normalX.size(); }
+};
+
+/**
+ * @struct ResultadoSAT
+ * @brief Vetor mínimo de translação (MTV) de um par que colide
+ *
+ * Mover B por (normalX, normalY) × profundidade (ou A pelo oposto) separa os
+ * dois polígonos pelo menor caminho. O sentido vem do lado da sobreposição
+ * no eixo escolhido, não dos centros: vale também com um dentro do outro.
+ */
+struct ResultadoSAT {
+    float normalX = 0.0f;
+    float normalY = 0.0f;
+    float profundidade = 0.0f;
+};
+
+/**
+ * @brief Fase estreita SAT: os polígonos convexos se sobrepõem?
+ *
+ * Projeta os dois polígonos nas normais das arestas de ambos; se algum
+ * eixo separa as projeções, não há colisão (saída antecipada). Com SSE2
+ * quatro eixos são projetados de uma vez (cada vértice é difundido nas
+ * quatro pistas); sem SSE2 cai em colidirSATEscalar.
+ *
+ * Encostar (sobreposição 0) não conta como colisão.
+ *
+ * @param mtv - Recebe o vetor mínimo de translação se colidir (pode ser nullptr)
+ * @return bool - true se os interiores se sobrepõem
+ */
+bool colidirSAT(const PoligonoConvexo& a, const PoligonoConvexo& b, ResultadoSAT* mtv = nullptr);
+
+/**
+ * @brief Mesmo teste, um eixo por vez (referência do benchmark)
+ */
+bool colidirSATEscalar(const PoligonoConvexo& a, const PoligonoConvexo& b, ResultadoSAT* mtv = nullptr);
+
+#endif // COLISAO_SAT_HPP
@@ -0,0 +1,150 @@
+#include "MundoFisico.hpp"
+#include "../core/SistemaJobs.hpp"
+#include <cmath>
+
+// Corpos por job: pequeno demais vira overhead de fila, grande demais desbalanceia
+static const size_t LOTE_FISICA = 256;
+
+// ========== Construtor ==========
+
+MundoFisico::MundoFisico(float limiteX, float limiteY)
+    : limiteX(limiteX), limiteY(limiteY) {}
+
+size_t MundoFisico::adicionarCorpo(float x, float y, float vx, float vy, float r) {
+    posX.push_back(x);
+    posY.push_back(y);
+    velX.push_back(vx);
+    velY.push_back(vy);
+    raio.push_back(r);
+    ordem.push_back(static_cast<uint32_t>(ordem.size()));
+    return posX.size() - 1;
+}
+
+// ========== Simulação ==========
+
+void MundoFisico::passo(float dt, SistemaJobs* jobs, std::pmr::memory_resource* temporaria) {
+    if (!temporaria) {
+        temporaria = std::pmr::get_default_resource();
+    }
+
+    // 1. Integração: cada corpo é independente, então os lotes não conflitam
+    if (jobs) {
+        jobs->paraCadaIntervalo(posX.size(), LOTE_FISICA, [this, dt](size_t inicio, size_t fim) {
+            integrar(inicio, fim, dt);
+        });
+    } else {
+        integrar(0, posX.size(), dt);
+    }
+
+    // 2. Fase ampla
+    faseAmpla(jobs, temporaria);
+
+    // 3. Resposta: um corpo pode aparecer em vários pares, por isso é sequencial
+    resolverColisoes();
+}
+
+void MundoFisico::integrar(size_t inicio, size_t fim, float dt) {
+    for (size_t i = inicio; i < fim; i++) {
+        posX[i] += velX[i] * dt;
+        posY[i] += velY[i] * dt;
+
+        // Reflexão nas paredes (a posição volta para dentro do limite)
+        float r = raio[i];
+        if (posX[i] - r < -limiteX) { posX[i] = -limiteX + r; velX[i] = std::fabs(velX[i]); }
+        if (posX[i] + r >  limiteX) { posX[i] =  limiteX - r; velX[i] = -std::fabs(velX[i]); }
+        if (posY[i] - r < -limiteY) { posY[i] = -limiteY + r; velY[i] = std::fabs(velY[i]); }
+        if (posY[i] + r >  limiteY) { posY[i] =  limiteY - r; velY[i] = -std::fabs(velY[i]); }
+    }
+}
+
+void MundoFisico::ordenarEixoX() {
+    // Ordenação por inserção: de um passo para o outro os corpos se movem
+    // pouco, então a ordem anterior já está quase certa e isso fica ~O(n)
+    for (size_t i = 1; i < ordem.size(); i++) {
+        uint32_t atual = ordem[i];
+        float chave = posX[atual] - raio[atual];
+        size_t j = i;
+        while (j > 0 && posX[ordem[j - 1]] - raio[ordem[j - 1]] > chave) {
+            ordem[j] = ordem[j - 1];
+            j--;
+        }
+        ordem[j] = atual;
+    }
+}
+
+void MundoFisico::varrer(size_t inicio, size_t fim, std::pmr::vector<ParColisao>& saida) const {
+    // Para cada corpo, testa os seguintes na ordem enquanto os intervalos em x se cruzam
+    for (size_t k = inicio; k < fim; k++) {
+        uint32_t a = ordem[k];
+        float maxXa = posX[a] + raio[a];
+        for (size_t m = k + 1; m < ordem.size(); m++) {
+            uint32_t b = ordem[m];
+            if (posX[b] - raio[b] > maxXa) break;
+            if (std::fabs(posY[a] - posY[b]) <= raio[a] + raio[b]) {
+                saida.push_back(ParColisao{a, b});
+            }
+        }
+    }
+}
+
+void MundoFisico::faseAmpla(SistemaJobs* jobs, std::pmr::memory_resource* temporaria) {
+    ordenarEixoX();
+
+    // Um buffer de pares por lote, todos na memória temporária do passo
+    // (o alocador pmr do vetor externo é repassado para os internos)
+    size_t numLotes = (ordem.size() + LOTE_FISICA - 1) / LOTE_FISICA;
+    std::pmr::vector<std::pmr::vector<ParColisao>> paresPorLote(numLotes, temporaria);
+    for (auto& lote : paresPorLote) {
+        lote.reserve(LOTE_FISICA);
+    }
+
+    if (jobs) {
+        jobs->paraCadaIntervalo(ordem.size(), LOTE_FISICA, [this, &paresPorLote](size_t inicio, size_t fim) {
+            varrer(inicio, fim, paresPorLote[inicio / LOTE_FISICA]);
+        });
+    } else {
+        for (size_t inicio = 0; inicio < ordem.size(); inicio += LOTE_FISICA) {
+            size_t fim = inicio + LOTE_FISICA < ordem.size() ? inicio + LOTE_FISICA : ordem.size();
+            varrer(inicio, fim, paresPorLote[inicio / LOTE_FISICA]);
+        }
+    }
+
+    // Junta a saída de todos os lotes (a ordem é determinística);
+    // 'pares' é persistente e clear() mantém a capacidade
+    pares.clear();
+    for (const auto& lote : paresPorLote) {
+        pares.insert(pares.end(), lote.begin(), lote.end());
+    }
+}
+
+void MundoFisico::resolverColisoes() {
+    for (const ParColisao& p : pares) {
+        float dx = posX[p.b] - posX[p.a];
+        float dy = posY[p.b] - posY[p.a];
+        float soma = raio[p.a] + raio[p.b];
+        float dist2 = dx * dx + dy * dy;
+        if (dist2 >= soma * soma || dist2 == 0.0f) continue;
+
+        // Normal da colisão e quanto os círculos se sobrepõem
+        float dist = std::sqrt(dist2);
+        float nx = dx / dist;
+        float ny = dy / dist;
+        float sobreposicao = soma - dist;
+
+        // Separa metade para cada lado
+        posX[p.a] -= nx * sobreposicao * 0.5f;
+        posY[p.a] -= ny * sobreposicao * 0.5f;
+        posX[p.b] += nx * sobreposicao * 0.5f;
+        posY[p.b] += ny * sobreposicao * 0.5f;
+
+        // Massas iguais, colisão elástica: troca as componentes normais
+        float va = velX[p.a] * nx + velY[p.a] * ny;
+        float vb = velX[p.b] * nx + velY[p.b] * ny;
+        if (va - vb <= 0.0f) continue; // já estão se afastando
+        float troca = vb - va;
+        velX[p.a] += troca * nx;
+        velY[p.a] += troca * ny;
+        velX[p.b] -= troca * nx;
+        velY[p.b] -= troca * ny;
+    }
+}
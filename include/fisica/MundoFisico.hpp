@@ -0,0 +1,101 @@
+#ifndef MUNDO_FISICO_HPP
+#define MUNDO_FISICO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+class SistemaJobs;
+
+/// Par de corpos cujas caixas envolventes se sobrepõem (saída da fase ampla)
+struct ParColisao {
+    uint32_t a;
+    uint32_t b;
+};
+
+/**
+ * @class MundoFisico
+ * @brief Simulação simples de corpos circulares (bolinhas) que quicam
+ *
+ * Não depende de OpenGL: só guarda posições e velocidades. As formas
+ * (Circulo) leem as posições depois de cada passo.
+ *
+ * Os dados ficam em estrutura de arrays (SoA): um vetor para cada campo.
+ * Assim a integração percorre memória contígua e pode ser dividida em
+ * lotes entre as threads do SistemaJobs.
+ *
+ * Cada passo:
+ * 1. Integração (paralela): posição += velocidade × dt, reflexão nas paredes
+ * 2. Fase ampla (paralela): sweep and prune no eixo x gera pares candidatos
+ * 3. Resposta (sequencial): separa os pares que se tocam e troca as velocidades
+ *
+ * Os buffers intermediários da fase ampla vêm de um memory_resource
+ * temporário (normalmente a ArenaQuadro): nenhum malloc por passo.
+ */
+class MundoFisico {
+public:
+    // ========== Construtor ==========
+
+    /**
+     * @brief Cria um mundo vazio limitado por paredes
+     *
+     * @param limiteX - Paredes em x = ±limiteX
+     * @param limiteY - Paredes em y = ±limiteY
+     */
+    MundoFisico(float limiteX = 1.0f, float limiteY = 1.0f);
+
+    /**
+     * @brief Adiciona um corpo circular
+     *
+     * @return size_t - Índice do corpo (estável, nunca muda)
+     */
+    size_t adicionarCorpo(float x, float y, float vx, float vy, float raio);
+
+    // ========== Simulação ==========
+
+    /**
+     * @brief Avança a simulação
+     *
+     * @param dt - Intervalo de tempo em segundos
+     * @param jobs - Pool para as etapas paralelas (nullptr = tudo na thread atual)
+     * @param temporaria - Memória para os buffers do passo (nullptr = recurso padrão/heap)
+     */
+    void passo(float dt, SistemaJobs* jobs = nullptr,
+               std::pmr::memory_resource* temporaria = nullptr);
+
+    // ========== Getters ==========
+
+    size_t getNumCorpos() const { return posX.size(); }
+    float getX(size_t i) const { return posX[i]; }
+    float getY(size_t i) const { return posY[i]; }
+    float getRaio(size_t i) const { return raio[i]; }
+
+    /**
+     * @brief Pares candidatos encontrados pela última fase ampla
+     * @return const std::vector<ParColisao>& - Pares com caixas sobrepostas
+     */
+    const std::vector<ParColisao>& getPares() const { return pares; }
+
+private:
+    float limiteX;
+    float limiteY;
+
+    // SoA: um vetor por campo
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<float> velX;
+    std::vector<float> velY;
+    std::vector<float> raio;
+
+    std::vector<uint32_t> ordem;   ///< Índices ordenados pelo x mínimo
+    std::vector<ParColisao> pares;
+
+    void integrar(size_t inicio, size_t fim, float dt);
+    void ordenarEixoX();
+    void varrer(size_t inicio, size_t fim, std::pmr::vector<ParColisao>& saida) const;
+    void faseAmpla(SistemaJobs* jobs, std::pmr::memory_resource* temporaria);
+    void resolverColisoes();
+};
+
+#endif // MUNDO_FISICO_HPP
@@ -55,16 +55,23 @@ Circulo::Circulo(float x, float y, float raio, int segmentos, visual visualizaca
     // Cria um círculo totalmente customizado
     gerarVertices();
     inicializarRecursos();
+    setDeslocamento(x, y);
 }
 
 // ========== Implementação dos Métodos Virtuais ==========
 
 void Circulo::gerarVertices() {
+    // No modo SDF o círculo é uma caixa com raio do canto igual ao raio
+    if (vis.usaSDF()) {
+        gerarQuadSDF(raio, raio, raio);
+        return;
+    }
+    
     // Limpa vértices anteriores
     vertices.clear();
     
-    // Reserva espaço: segmentos triângulos × 3 vértices × 2 coordenadas
-    vertices.reserve(segmentos * 3 * 2);
+    // Reserva espaço: segmentos triângulos × 3 vértices × 2 coordenadas (5 com textura)
+    vertices.reserve(segmentos * 3 * getComponentesPorVertice());
     
     // Calcula o incremento angular entre cada segmento
     // 2π radianos (360°) dividido pelo número de segmentos
@@ -78,24 +85,36 @@ void Circulo::gerarVertices() {
         
         // ===== TRIÂNGULO: centro + dois pontos consecutivos na borda =====
         
-        // Vértice 1: Centro do círculo
-        vertices.push_back(centroX);
-        vertices.push_back(centroY);
+        // Vértice 1: Centro do círculo (origem local)
+        vertices.push_back(0.0f);
+        vertices.push_back(0.0f);
         
         // Vértice 2: Ponto na borda no ângulo1
         // Usa trigonometria para calcular a posição:
-        // x = centro_x + raio × cos(ângulo)
-        // y = centro_y + raio × sin(ângulo)
-        vertices.push_back(centroX + raio * std::cos(angulo1));
-        vertices.push_back(centroY + raio * std::sin(angulo1));
+        // x = raio × cos(ângulo)
+        // y = raio × sin(ângulo)
+        vertices.push_back(raio * std::cos(angulo1));
+        vertices.push_back(raio * std::sin(angulo1));
         
         // Vértice 3: Ponto na borda no ângulo2 (próximo ponto)
-        vertices.push_back(centroX + raio * std::cos(angulo2));
-        vertices.push_back(centroY + raio * std::sin(angulo2));
+        vertices.push_back(raio * std::cos(angulo2));
+        vertices.push_back(raio * std::sin(angulo2));
     }
     
     // Após este loop, temos um círculo completo formado por 'segmentos' triângulos
     // que se conectam como fatias de uma pizza
+    
+    // Coordenadas de textura a partir do canto inferior esquerdo do quadrado envolvente
+    aplicarUVs(-raio, -raio);
+}
+
+void Circulo::descreverMalha(ChaveMalha& chave) const {
+    // No modo SDF os segmentos não mudam o quad
+    chave.tipo = TipoMalha::circulo;
+    chave.parametros.push_back(raio);
+    if (!vis.usaSDF()) {
+        chave.parametros.push_back(static_cast<float>(segmentos));
+    }
 }
 
 // ========== Métodos de Transformação ==========
@@ -113,20 +132,22 @@ void Circulo::setRaio(float novoRaio) {
     // Regenera os vértices com o novo raio
     gerarVertices();
     
-    // Atualiza o buffer na GPU
-    atualizarBuffer();
+    // Troca a malha na GPU (compartilhada se outro círculo tiver o mesmo raio)
+    atualizarMalha();
 }
 
 void Circulo::setPosicao(float x, float y) {
+    // A posição vai no uniform: nada a reenviar
+    reposicionar(x, y);
+}
+
+void Circulo::reposicionar(float x, float y) {
     // Atualiza a posição do centro
     centroX = x;
     centroY = y;
     
-    // Regenera os vértices na nova posição
-    gerarVertices();
-    
-    // Atualiza o buffer na GPU
-    atualizarBuffer();
+    // Os vértices são locais: só o deslocamento do próximo desenho muda
+    setDeslocamento(x, y);
 }
 
 void Circulo::setSegmentos(int novosSegmentos) {
@@ -143,20 +164,7 @@ void Circulo::setSegmentos(int novosSegmentos) {
     // NOTA: Isso pode mudar significativamente a quantidade de memória usada
     gerarVertices();
     
-    // Atualiza o buffer na GPU
-    // Como o número de vértices mudou, precisamos reenviar tudo
-    atualizarBuffer();
-}
-
-void Circulo::atualizarBuffer() {
-    // Vincula o VBO desta forma
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    
-    // Envia os novos dados de vértices para a GPU
-    // GL_STATIC_DRAW é apropriado para transformações ocasionais
-    // Use GL_DYNAMIC_DRAW se as transformações forem muito frequentes
-    glBufferData(GL_ARRAY_BUFFER, 
-                 vertices.size() * sizeof(float), 
-                 vertices.data(), 
-                 GL_STATIC_DRAW);
+    // Troca a malha na GPU
+    // Como o número de vértices mudou, a chave (e a malha) também muda
+    atualizarMalha();
 }
@@ -34,6 +34,12 @@
  * - 32 segmentos: boa qualidade, performance razoável
  * - 64 segmentos: alta qualidade
  * - 16 segmentos: baixa qualidade, melhor performance
+ * 
+ * Modo SDF (visual::ativarSDF):
+ * - Desenhado como um único quad (4 vértices, GL_TRIANGLE_STRIP)
+ * - O fragment shader avalia a distância ao centro: borda suave em
+ *   qualquer resolução e contorno opcional
+ * - Os segmentos são ignorados
  */
 class Circulo : public Forma {
 public:
@@ -103,9 +109,9 @@ public:
      * @brief Gera os vértices do círculo
      * 
      * Implementa o método virtual puro de Forma.
-     * Cria vértices em um padrão circular usando trigonometria:
-     * - x = centro_x + raio × cos(ângulo)
-     * - y = centro_y + raio × sin(ângulo)
+     * Cria vértices em um padrão circular, em torno da origem local:
+     * - x = raio × cos(ângulo)
+     * - y = raio × sin(ângulo)
      * 
      * Para cada segmento, cria um triângulo com:
      * 1. Centro do círculo
@@ -117,19 +123,34 @@ public:
     /**
      * @brief Retorna o modo de desenho OpenGL para círculos
      * 
-     * @return GLenum - GL_TRIANGLES
+     * @return GLenum - GL_TRIANGLES (GL_TRIANGLE_STRIP no modo SDF)
      * 
      * O círculo é desenhado como múltiplos triângulos independentes.
      * Alternativa: GL_TRIANGLE_FAN (mais eficiente, mas requer ordem diferente de vértices)
      */
-    GLenum getModoDesenho() const override { return GL_TRIANGLES; }
+    GLenum getModoDesenho() const override { return vis.usaSDF() ? GL_TRIANGLE_STRIP : GL_TRIANGLES; }
     
     /**
      * @brief Retorna o número de vértices do círculo
      * 
-     * @return int - segmentos × 3 (cada triângulo tem 3 vértices)
+     * @return int - segmentos × 3 (cada triângulo tem 3 vértices), ou 4 no modo SDF
+     */
+    int getNumeroVertices() const override { return vis.usaSDF() ? 4 : segmentos * 3; }
+    
+    /**
+     * @brief O círculo pode ser desenhado como um quad SDF
+     * @return bool - true
+     */
+    bool suportaSDF() const override { return true; }
+    
+protected:
+    /**
+     * @brief Raio e segmentos (só o raio no modo SDF)
+     * @param chave - Chave da malha a preencher
      */
-    int getNumeroVertices() const override { return segmentos * 3; }
+    void descreverMalha(ChaveMalha& chave) const override;
+
+public:
 
     // ========== Métodos de Transformação ==========
     
@@ -149,10 +170,21 @@ public:
      * @param x - Nova coordenada x do centro
      * @param y - Nova coordenada y do centro
      * 
-     * Move o círculo para uma nova posição e regenera os vértices.
+     * Move o círculo para uma nova posição (os vértices não mudam).
      */
     void setPosicao(float x, float y);
     
+    /**
+     * @brief Move o círculo sem chamar OpenGL
+     * 
+     * @param x - Nova coordenada x do centro
+     * @param y - Nova coordenada y do centro
+     * 
+     * Só guarda a posição, enviada como uniform no próximo desenho. Pode ser
+     * chamado de threads de trabalho (cada forma só toca na própria posição).
+     */
+    void reposicionar(float x, float y);
+    
     /**
      * @brief Define o número de segmentos (qualidade)
      * 
@@ -208,14 +240,6 @@ private:
     float centroY;   ///< Coordenada y do centro do círculo
     float raio;      ///< Raio do círculo (distância do centro à borda)
     int segmentos;   ///< Número de triângulos usados para aproximar o círculo
-    
-    /**
-     * @brief Atualiza o buffer de vértices na GPU
-     * 
-     * Deve ser chamado após modificar os vértices para
-     * refletir as mudanças na renderização.
-     */
-    void atualizarBuffer();
 };
 
 #endif // CIRCULO_HPP
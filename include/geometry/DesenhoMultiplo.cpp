@@ -0,0 +1,214 @@
+#include "DesenhoMultiplo.hpp"
+#include "Forma.hpp"
+#include "RegistroMalhas.hpp"
+#include "../render/ListaComandos.hpp"
+#include <iostream>
+#include <utility>
+
+// ========== Criação ==========
+
+static GLuint compilarShader(GLenum tipo, const char* fonte) {
+    GLuint shader = glCreateShader(tipo);
+    glShaderSource(shader, 1, &fonte, NULL);
+    glCompileShader(shader);
+
+    int success;
+    char infoLog[512];
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        std::cerr << "ERRO: Falha na compilação do shader do desenho múltiplo\n" << infoLog << std::endl;
+    }
+    return shader;
+}
+
+bool DesenhoMultiplo::indiretoDisponivel() {
+    // A instância base é o que leva cada comando às suas posições
+    return GLEW_VERSION_4_3 || (GLEW_ARB_multi_draw_indirect && GLEW_ARB_base_instance);
+}
+
+DesenhoMultiplo::DesenhoMultiplo(const Forma& modelo)
+    : material(modelo.getVisual()),
+      componentes(modelo.getComponentesPorVertice()),
+      modo(modelo.getModoDesenho()),
+      textura(modelo.getTexturaMaterial())
+{
+    // Mesmo fragment shader das formas; o vertex shader lê posição e matriz por instância
+    std::string fonteVertex = material.geraVertexShaderPorInstancia();
+    GLuint vertexShader = compilarShader(GL_VERTEX_SHADER, fonteVertex.c_str());
+    GLuint fragmentShader = compilarShader(GL_FRAGMENT_SHADER, material.geraFragmentShader());
+    programa = glCreateProgram();
+    glAttachShader(programa, vertexShader);
+    glAttachShader(programa, fragmentShader);
+    glLinkProgram(programa);
+    int success;
+    char infoLog[512];
+    glGetProgramiv(programa, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(programa, 512, NULL, infoLog);
+        std::cerr << "ERRO: Falha ao linkar o programa do desenho múltiplo\n" << infoLog << std::endl;
+    }
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    glUseProgram(programa);
+    timeLoc = glGetUniformLocation(programa, "u_time");
+    if (textura) {
+        glUniform1i(glGetUniformLocation(programa, "u_texturas"), 0);
+    }
+
+    // VAO próprio: vértices do VBO do formato (ligado no primeiro quadro)
+    // e os atributos por instância, que avançam um por instância
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &bufferDados);
+    glGenBuffers(1, &bufferComandos);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, bufferDados);
+    glEnableVertexAttribArray(2);
+    glEnableVertexAttribArray(3);
+    glVertexAttribDivisor(2, 1);
+    glVertexAttribDivisor(3, 1);
+    configurarInstancias(0);
+    glBindVertexArray(0);
+
+    suportaIndireto = indiretoDisponivel();
+    caminho = suportaIndireto ? Caminho::indireto : Caminho::instanciado;
+    for (Quadro& quadro : quadros) {
+        quadro.dono = this;
+    }
+}
+
+DesenhoMultiplo::~DesenhoMultiplo() {
+    glDeleteVertexArrays(1, &VAO);
+    glDeleteBuffers(1, &bufferDados);
+    glDeleteBuffers(1, &bufferComandos);
+    glDeleteProgram(programa);
+}
+
+void DesenhoMultiplo::setCaminho(Caminho novo) {
+    if (novo == Caminho::indireto && !suportaIndireto) {
+        std::cerr << "AVISO: multi-draw indireto indisponível. Usando o caminho instanciado." << std::endl;
+        novo = Caminho::instanciado;
+    }
+    caminho = novo;
+}
+
+// ========== Montagem (thread do jogo) ==========
+
+bool DesenhoMultiplo::aceita(const Forma& forma) const {
+    return forma.getComponentesPorVertice() == componentes && forma.getModoDesenho() == modo &&
+           forma.getVisual().mesmoMaterial(material);
+}
+
+bool DesenhoMultiplo::acrescentar(const Forma& forma) {
+    if (!aceita(forma)) {
+        estatisticas.recusadas++;
+        return false;
+    }
+    acrescentar(forma.getPrimeiroVertice(), forma.getNumeroVertices(),
+                forma.getDeslocamentoX(), forma.getDeslocamentoY(), forma.getEscalaRotacao());
+    return true;
+}
+
+void DesenhoMultiplo::acrescentar(GLint primeiro, GLsizei numVertices, float x, float y, const float escalaRotacao[4]) {
+    GLuint base = static_cast<GLuint>(dados.size());
+    dados.push_back({ { x, y }, { escalaRotacao[0], escalaRotacao[1], escalaRotacao[2], escalaRotacao[3] } });
+
+    // Mesma malha do desenho anterior: mais uma instância do mesmo comando
+    if (!comandos.empty()) {
+        ComandoIndireto& anterior = comandos.back();
+        if (anterior.primeiro == static_cast<GLuint>(primeiro) && anterior.contagem == static_cast<GLuint>(numVertices)) {
+            anterior.instancias++;
+            return;
+        }
+    }
+    comandos.push_back({ static_cast<GLuint>(numVertices), 1, static_cast<GLuint>(primeiro), base });
+}
+
+void DesenhoMultiplo::registrar(ListaComandos& lista, float tempo) {
+    estatisticas.desenhos = dados.size();
+    estatisticas.comandos = comandos.size();
+    estatisticas.chamadasGL = comandos.empty() ? 0 : (caminho == Caminho::indireto ? 1 : comandos.size());
+    estatisticas.bytesEnviados = dados.size() * sizeof(DadosDesenho) +
+                                 (caminho == Caminho::indireto ? comandos.size() * sizeof(ComandoIndireto) : 0);
+    if (comandos.empty()) return;
+
+    // Conjunto da lista: só volta para a thread do jogo depois de executado.
+    // Troca com o quadro montado (swap, sem cópia); o conteúdo velho vira
+    // a memória do próximo quadro
+    int indice = quadros[0].lista == &lista ? 0 : (quadros[1].lista == &lista ? 1 : 1 - ultimo);
+    Quadro& quadro = quadros[indice];
+    quadro.lista = &lista;
+    quadro.dados.swap(dados);
+    quadro.comandos.swap(comandos);
+    quadro.tempo = tempo;
+    quadro.caminho = caminho;
+    quadro.vboFormato = RegistroMalhas::instancia().getVBO(componentes);
+    dados.clear();
+    comandos.clear();
+    ultimo = indice;
+
+    lista.chamar(&DesenhoMultiplo::executarQuadro, &quadro);
+}
+
+// ========== Execução (thread de render) ==========
+
+void DesenhoMultiplo::configurarInstancias(size_t base) const {
+    // Com o buffer de dados ligado em GL_ARRAY_BUFFER
+    GLsizei stride = sizeof(DadosDesenho);
+    size_t inicio = base * sizeof(DadosDesenho);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)inicio);
+    glVertexAttribPointer(3, 4, GL_FLOAT, GL_FALSE, stride, (void*)(inicio + 2 * sizeof(float)));
+}
+
+void DesenhoMultiplo::enviar(GLenum alvo, GLuint buffer, size_t& capacidade, const void* dados, size_t bytes) {
+    // Órfão a cada quadro: o driver não espera o quadro anterior terminar de ler
+    glBindBuffer(alvo, buffer);
+    if (bytes > capacidade) {
+        capacidade = bytes + bytes / 2;
+    }
+    glBufferData(alvo, static_cast<GLsizeiptr>(capacidade), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(alvo, 0, static_cast<GLsizeiptr>(bytes), dados);
+}
+
+void DesenhoMultiplo::executarQuadro(void* contexto) {
+    const Quadro& quadro = *static_cast<const Quadro*>(contexto);
+    DesenhoMultiplo& d = *quadro.dono;
+
+    glUseProgram(d.programa);
+    if (d.timeLoc != -1) {
+        glUniform1f(d.timeLoc, quadro.tempo);
+    }
+    if (d.textura) {
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, d.textura);
+    }
+    glBindVertexArray(d.VAO);
+
+    // O VBO do formato pode ter crescido (outro ID) desde o último quadro
+    if (quadro.vboFormato != d.vboLigado) {
+        glBindBuffer(GL_ARRAY_BUFFER, quadro.vboFormato);
+        RegistroMalhas::configurarAtributos(d.componentes);
+        d.vboLigado = quadro.vboFormato;
+    }
+
+    enviar(GL_ARRAY_BUFFER, d.bufferDados, d.capacidade[0], quadro.dados.data(),
+           quadro.dados.size() * sizeof(DadosDesenho));
+
+    if (quadro.caminho == Caminho::indireto) {
+        // A instância base de cada comando escolhe as suas posições: uma chamada só
+        d.configurarInstancias(0);
+        enviar(GL_DRAW_INDIRECT_BUFFER, d.bufferComandos, d.capacidade[1], quadro.comandos.data(),
+               quadro.comandos.size() * sizeof(ComandoIndireto));
+        glMultiDrawArraysIndirect(d.modo, nullptr, static_cast<GLsizei>(quadro.comandos.size()), 0);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    } else {
+        // Sem instância base: os atributos por instância começam na base do comando
+        for (const ComandoIndireto& comando : quadro.comandos) {
+            d.configurarInstancias(comando.instanciaBase);
+            glDrawArraysInstanced(d.modo, static_cast<GLint>(comando.primeiro),
+                                  static_cast<GLsizei>(comando.contagem), static_cast<GLsizei>(comando.instancias));
+        }
+    }
+    glBindVertexArray(0);
+}
@@ -0,0 +1,170 @@
+#ifndef DESENHO_MULTIPLO_HPP
+#define DESENHO_MULTIPLO_HPP
+
+#include <GL/glew.h>
+#include "../visual.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class Forma;
+class ListaComandos;
+
+/// O que o último registrar() enviou e quantas chamadas custou
+struct EstatisticasDesenhoMultiplo {
+    size_t desenhos = 0;              ///< Formas acrescentadas no quadro
+    size_t comandos = 0;              ///< Desenhos seguidos de mesma malha viram um comando instanciado
+    size_t chamadasGL = 0;            ///< 1 no caminho indireto; um glDrawArraysInstanced por comando no outro
+    size_t bytesEnviados = 0;         ///< Dados por desenho + comandos indiretos
+    size_t recusadas = 0;             ///< acrescentar() de formas de outro material (desde a criação)
+};
+
+/**
+ * @class DesenhoMultiplo
+ * @brief Muitas formas do mesmo material desenhadas sem trocar programa, VAO nem uniforms
+ *
+ * O laço de Forma::registrar() grava por forma um glUseProgram, os
+ * uniforms de posição e matriz e um glDrawArrays. Como as malhas de um
+ * formato de vértice moram todas no mesmo VBO (RegistroMalhas), basta um
+ * programa para o material: posição e matriz viram atributos por
+ * instância, lidos de um buffer com uma entrada por desenho.
+ *
+ * Dois caminhos, escolhidos na criação:
+ * - indireto (GL 4.3 ou ARB_multi_draw_indirect + ARB_base_instance):
+ *   a thread do jogo monta os comandos {contagem, instâncias, primeiro,
+ *   base} e o quadro inteiro sai em um glMultiDrawArraysIndirect;
+ * - instanciado (GL 3.3): os mesmos comandos, um glDrawArraysInstanced
+ *   cada, reapontando os atributos por instância para a base do comando.
+ *   glMultiDrawArrays não serve aqui: em 3.3 o shader não tem como saber
+ *   de qual desenho veio o vértice (sem gl_DrawID nem instância base).
+ *
+ * Em ambos, desenhos seguidos da mesma malha (as bolinhas, por exemplo)
+ * viram um comando só com várias instâncias.
+ *
+ * @code
+ * DesenhoMultiplo bolinhas(*modelo);            // com o contexto ativo
+ * // a cada quadro, no lugar de forma.registrar(lista, tempo):
+ * for (auto& b : formas) if (!bolinhas.acrescentar(*b)) b->registrar(lista, tempo);
+ * bolinhas.registrar(lista, tempo);
+ * @endcode
+ *
+ * Os dados do quadro ficam no objeto (um conjunto por lista da
+ * ThreadRender, que se alternam), não na área de dados da lista: 100 mil
+ * desenhos cabem sem estourar a lista. Trocar de conjunto é um swap de
+ * vetores; em regime permanente nada é alocado.
+ */
+class DesenhoMultiplo {
+public:
+    enum class Caminho : uint8_t {
+        indireto,       ///< glMultiDrawArraysIndirect: uma chamada por quadro
+        instanciado     ///< glDrawArraysInstanced por comando (GL 3.3)
+    };
+
+    /**
+     * @brief Cria o programa e os buffers do material de `modelo`
+     *
+     * Precisa do contexto OpenGL ativo. Material (visual), formato de
+     * vértice, modo de desenho e textura vêm do modelo.
+     */
+    explicit DesenhoMultiplo(const Forma& modelo);
+    ~DesenhoMultiplo();
+
+    DesenhoMultiplo(const DesenhoMultiplo&) = delete;
+    DesenhoMultiplo& operator=(const DesenhoMultiplo&) = delete;
+
+    /// true se o driver tem multi-draw indireto com instância base (precisa do contexto ativo)
+    static bool indiretoDisponivel();
+
+    /// Força um caminho (indireto sem suporte do driver fica no instanciado)
+    void setCaminho(Caminho caminho);
+    Caminho getCaminho() const { return caminho; }
+
+    /// true se a forma tem o material, o formato e o modo de desenho deste objeto
+    bool aceita(const Forma& forma) const;
+
+    /**
+     * @brief Acrescenta a forma ao quadro, com a posição e a matriz atuais
+     *
+     * @return bool - false se a forma é de outro material, formato ou modo
+     *         de desenho (nada é acrescentado; desenhe-a com registrar())
+     */
+    bool acrescentar(const Forma& forma);
+
+    /**
+     * @brief Acrescenta um desenho de uma faixa do VBO do formato
+     *
+     * @param primeiro - Primeiro vértice (MalhaGPU::primeiro)
+     * @param escalaRotacao - Matriz 2x2 por colunas
+     */
+    void acrescentar(GLint primeiro, GLsizei numVertices, float x, float y, const float escalaRotacao[4]);
+
+    /**
+     * @brief Grava na lista o envio dos dados e o desenho de tudo o que foi acrescentado
+     *
+     * Depois disso o próximo quadro começa vazio.
+     *
+     * @param tempo - Valor de u_time (cores animadas)
+     */
+    void registrar(ListaComandos& lista, float tempo);
+
+    const EstatisticasDesenhoMultiplo& getEstatisticas() const { return estatisticas; }
+    GLuint getPrograma() const { return programa; }
+    GLuint getVAO() const { return VAO; }
+    GLuint getTextura() const { return textura; }
+
+private:
+    /// Atributos por instância (locations 2 e 3)
+    struct DadosDesenho {
+        float deslocamento[2];
+        float escalaRotacao[4];
+    };
+
+    /// Mesmo layout de DrawArraysIndirectCommand
+    struct ComandoIndireto {
+        GLuint contagem;
+        GLuint instancias;
+        GLuint primeiro;
+        GLuint instanciaBase;
+    };
+
+    /// Desenhos de um quadro gravado: a thread de render lê enquanto a lista não volta
+    struct Quadro {
+        DesenhoMultiplo* dono = nullptr;
+        const ListaComandos* lista = nullptr;    ///< Lista a que este conjunto está ligado
+        std::vector<DadosDesenho> dados;
+        std::vector<ComandoIndireto> comandos;
+        float tempo = 0.0f;
+        Caminho caminho = Caminho::instanciado;
+        GLuint vboFormato = 0;                   ///< VBO do formato quando o quadro foi gravado
+    };
+
+    // Fixos depois do construtor
+    visual material;                             ///< Do modelo, só para comparar (acrescentar)
+    int componentes;
+    GLenum modo;
+    GLuint textura;
+    GLuint programa = 0;
+    GLint timeLoc = -1;
+    GLuint VAO = 0;
+    GLuint bufferDados = 0;
+    GLuint bufferComandos = 0;
+    bool suportaIndireto = false;
+
+    // Só a thread do jogo
+    Caminho caminho = Caminho::instanciado;
+    std::vector<DadosDesenho> dados;             ///< Quadro em montagem
+    std::vector<ComandoIndireto> comandos;
+    Quadro quadros[2];                           ///< Um por lista da ThreadRender
+    int ultimo = 1;                              ///< Conjunto gravado por último
+    EstatisticasDesenhoMultiplo estatisticas;
+
+    // Só a thread de render
+    GLuint vboLigado = 0;                        ///< VBO do formato para que o VAO aponta
+    size_t capacidade[2] = { 0, 0 };             ///< Bytes alocados em bufferDados/bufferComandos
+
+    void configurarInstancias(size_t base) const;
+    static void enviar(GLenum alvo, GLuint buffer, size_t& capacidade, const void* dados, size_t bytes);
+    static void executarQuadro(void* quadro);
+};
+
+#endif // DESENHO_MULTIPLO_HPP
@@ -0,0 +1,28 @@
+#include "Elipse.hpp"
+#include <cmath>
+
+// ========== Construtores ==========
+
+Elipse::Elipse(float raioX, float raioY, int segmentos, visual visualizacao)
+    : PoligonoRegular(0.0f, 0.0f, segmentos, raioX, raioY, 1.0f, visualizacao)
+{
+}
+
+Elipse::Elipse(float x, float y, float raioX, float raioY, int segmentos, visual visualizacao)
+    : PoligonoRegular(x, y, segmentos, raioX, raioY, 1.0f, visualizacao)
+{
+}
+
+// ========== Métodos de Transformação ==========
+
+void Elipse::setRaios(float novoRaioX, float novoRaioY) {
+    // Valida que os raios sejam positivos
+    if (novoRaioX <= 0.0f || novoRaioY <= 0.0f) {
+        std::cerr << "AVISO: Raios devem ser positivos. Usando valor absoluto." << std::endl;
+        novoRaioX = std::abs(novoRaioX);
+        novoRaioY = std::abs(novoRaioY);
+    }
+    raioX = novoRaioX;
+    raioY = novoRaioY;
+    aplicarTamanho();
+}
@@ -0,0 +1,54 @@
+#ifndef ELIPSE_HPP
+#define ELIPSE_HPP
+
+#include "PoligonoRegular.hpp"
+
+/**
+ * @class Elipse
+ * @brief Círculo achatado: polígono unitário de N segmentos com escala (raioX, raioY)
+ *
+ * Usa a mesma tesselação e a mesma malha de um PoligonoRegular com o mesmo
+ * número de lados: todas as elipses de 32 segmentos, de qualquer tamanho e
+ * achatamento, dividem um VBO.
+ */
+class Elipse : public PoligonoRegular {
+public:
+    /**
+     * @brief Elipse centralizada na origem
+     *
+     * @param raioX - Semi-eixo horizontal
+     * @param raioY - Semi-eixo vertical
+     * @param segmentos - Pontos da borda (mínimo: 3, 32 por padrão)
+     * @param visualizacao - Objeto visual que define cor e aparência
+     */
+    Elipse(float raioX, float raioY, int segmentos = 32, visual visualizacao = visual());
+
+    /**
+     * @brief Elipse em uma posição específica
+     *
+     * @param x - Coordenada x do centro
+     * @param y - Coordenada y do centro
+     * @param raioX - Semi-eixo horizontal
+     * @param raioY - Semi-eixo vertical
+     * @param segmentos - Pontos da borda (mínimo: 3)
+     * @param visualizacao - Objeto visual que define cor e aparência
+     */
+    Elipse(float x, float y, float raioX, float raioY, int segmentos, visual visualizacao = visual());
+
+    ~Elipse() override = default;
+
+    /**
+     * @brief Define os dois semi-eixos
+     *
+     * Sem textura só muda a escala: nenhum vértice é gerado ou enviado.
+     */
+    void setRaios(float novoRaioX, float novoRaioY);
+
+    /**
+     * @brief Calcula a área da elipse
+     * @return float - Área (π × raioX × raioY)
+     */
+    float calcularArea() const { return static_cast<float>(3.14159265358979323846 * raioX * raioY); }
+};
+
+#endif // ELIPSE_HPP
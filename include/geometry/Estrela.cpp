@@ -0,0 +1,18 @@
+#include "Estrela.hpp"
+
+// ========== Construtores ==========
+
+// Razões fora de (0, 1) viram 0.5: com 1 a estrela seria um polígono de 2N lados
+static float razaoValida(float razaoInterna) {
+    return razaoInterna > 0.0f && razaoInterna < 1.0f ? razaoInterna : 0.5f;
+}
+
+Estrela::Estrela(int pontas, float raio, float razaoInterna, visual visualizacao)
+    : PoligonoRegular(0.0f, 0.0f, pontas, raio, raio, razaoValida(razaoInterna), visualizacao)
+{
+}
+
+Estrela::Estrela(float x, float y, int pontas, float raio, float razaoInterna, visual visualizacao)
+    : PoligonoRegular(x, y, pontas, raio, raio, razaoValida(razaoInterna), visualizacao)
+{
+}
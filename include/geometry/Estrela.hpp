@@ -0,0 +1,58 @@
+#ifndef ESTRELA_HPP
+#define ESTRELA_HPP
+
+#include "PoligonoRegular.hpp"
+
+/**
+ * @class Estrela
+ * @brief Estrela de N pontas: pontos externos e internos alternados na borda
+ *
+ * Mesma família de PoligonoRegular: a tesselação unitária de (pontas,
+ * razão interna) é gerada uma vez e todas as estrelas desse formato
+ * dividem a malha, com o raio aplicado como escala no vertex shader.
+ *
+ * Estrutura dos vértices (leque a partir do centro, 2 × pontas + 2):
+ * - centro
+ * - ponta (raio externo), vale (raio externo × razão), ponta, ...
+ * - a primeira ponta de novo, fechando o leque
+ */
+class Estrela : public PoligonoRegular {
+public:
+    /**
+     * @brief Estrela centralizada na origem
+     *
+     * @param pontas - Número de pontas (mínimo: 3)
+     * @param raio - Raio externo (centro às pontas)
+     * @param razaoInterna - Raio interno / raio externo, entre 0 e 1 (0.5 por padrão)
+     * @param visualizacao - Objeto visual que define cor e aparência
+     */
+    Estrela(int pontas, float raio, float razaoInterna = 0.5f, visual visualizacao = visual());
+
+    /**
+     * @brief Estrela em uma posição específica
+     *
+     * @param x - Coordenada x do centro
+     * @param y - Coordenada y do centro
+     * @param pontas - Número de pontas (mínimo: 3)
+     * @param raio - Raio externo (centro às pontas)
+     * @param razaoInterna - Raio interno / raio externo, entre 0 e 1
+     * @param visualizacao - Objeto visual que define cor e aparência
+     */
+    Estrela(float x, float y, int pontas, float raio, float razaoInterna, visual visualizacao = visual());
+
+    ~Estrela() override = default;
+
+    /**
+     * @brief Obtém o número de pontas
+     * @return int - Pontas da estrela
+     */
+    int getPontas() const { return lados; }
+
+    /**
+     * @brief Obtém a razão entre o raio interno e o externo
+     * @return float - Entre 0 e 1
+     */
+    float getRazaoInterna() const { return razaoInterna; }
+};
+
+#endif // ESTRELA_HPP
@@ -0,0 +1,118 @@
+#include "FilaDesenho.hpp"
+#include "DesenhoMultiplo.hpp"
+#include "Forma.hpp"
+#include "../render/ListaComandos.hpp"
+#include <algorithm>
+
+// ========== Construtor e Destrutor ==========
+
+FilaDesenho::FilaDesenho() = default;
+
+// DesenhoMultiplo completo aqui: o unique_ptr precisa do destrutor
+FilaDesenho::~FilaDesenho() = default;
+
+// ========== Montagem ==========
+
+void FilaDesenho::prepararLote(const Forma& modelo) {
+    for (const auto& lote : lotes) {
+        if (lote->aceita(modelo)) return;
+    }
+    lotes.push_back(std::make_unique<DesenhoMultiplo>(modelo));
+    loteGravado.resize(lotes.size());
+}
+
+void FilaDesenho::acrescentar(Forma& forma, uint8_t camada, float profundidade) {
+    // Estáticas saem pela GeometriaEstatica
+    if (forma.isEstatica()) return;
+
+    Item item{ &forma, -1 };
+    for (size_t i = 0; i < lotes.size(); i++) {
+        if (lotes[i]->aceita(forma)) {
+            item.lote = static_cast<int>(i);
+            break;
+        }
+    }
+
+    // Material = o lote; sem lote, o programa da própria forma (bit alto
+    // ligado para não colidir com os índices dos lotes)
+    CamposChave campos;
+    campos.camada = camada;
+    campos.translucido = forma.getVisual().usaSDF();
+    campos.programa = item.lote >= 0 ? static_cast<uint16_t>(item.lote)
+                                     : static_cast<uint16_t>(0x8000u | (forma.getShaderProgram() & 0x7FFFu));
+    campos.textura = static_cast<uint16_t>(forma.getTexturaMaterial());
+    campos.profundidade = profundidade;
+
+    chaves.push_back({ montarChave(campos), static_cast<uint32_t>(itens.size()) });
+    itens.push_back(item);
+}
+
+// ========== Gravação ==========
+
+void FilaDesenho::contar(TrocasEstado& trocas, Estado& atual, const Estado& novo, size_t desenhos) {
+    // Textura 0 não liga nada: só conta quando uma textura diferente entra
+    trocas.programas += novo.programa != atual.programa;
+    trocas.texturas += novo.textura != 0 && novo.textura != atual.textura;
+    trocas.vaos += novo.vao != atual.vao;
+    trocas.desenhos += desenhos;
+    atual.programa = novo.programa;
+    atual.vao = novo.vao;
+    if (novo.textura) atual.textura = novo.textura;
+}
+
+void FilaDesenho::registrar(ListaComandos& lista, float tempo) {
+    size_t n = itens.size();
+    estatisticas = EstatisticasFila();
+    estatisticas.itens = n;
+
+    // Referência: cada item sozinho, na ordem em que chegou
+    Estado atual;
+    for (const Item& item : itens) {
+        contar(estatisticas.antes, atual,
+               { item.forma->getShaderProgram(), item.forma->getTexturaMaterial(), item.forma->getVAO() }, 1);
+    }
+
+    temporario.resize(n);
+    ordenarChaves(chaves.data(), temporario.data(), n);
+
+    // Sequências do mesmo lote viram um DesenhoMultiplo; o resto, forma a forma
+    std::fill(loteGravado.begin(), loteGravado.end(), 0);
+    atual = Estado();
+    for (size_t i = 0; i < n;) {
+        const Item& item = itens[chaves[i].indice];
+        if (item.lote >= 0 && !loteGravado[item.lote]) {
+            DesenhoMultiplo& lote = *lotes[item.lote];
+            size_t fim = i;
+            for (; fim < n && itens[chaves[fim].indice].lote == item.lote; fim++) {
+                lote.acrescentar(*itens[chaves[fim].indice].forma);
+            }
+            lote.registrar(lista, tempo);
+            loteGravado[item.lote] = 1;
+            contar(estatisticas.depois, atual, { lote.getPrograma(), lote.getTextura(), lote.getVAO() },
+                   lote.getEstatisticas().chamadasGL);
+            estatisticas.lotes++;
+            estatisticas.agrupados += fim - i;
+            i = fim;
+            continue;
+        }
+        item.forma->registrar(lista, tempo);
+        contar(estatisticas.depois, atual,
+               { item.forma->getShaderProgram(), item.forma->getTexturaMaterial(), item.forma->getVAO() }, 1);
+        i++;
+    }
+
+    itens.clear();
+    chaves.clear();
+}
+
+// ========== Relatório ==========
+
+void FilaDesenho::relatorio(std::ostream& saida) const {
+    const EstatisticasFila& e = estatisticas;
+    saida << "Fila de desenho: " << e.itens << " itens, " << e.agrupados << " em " << e.lotes
+          << " lote(s) multi-draw" << std::endl;
+    saida << "  na ordem de chegada: " << e.antes.programas << " trocas de programa, " << e.antes.texturas
+          << " de textura, " << e.antes.vaos << " de VAO, " << e.antes.desenhos << " chamadas de desenho" << std::endl;
+    saida << "  ordenada e agrupada: " << e.depois.programas << " trocas de programa, " << e.depois.texturas
+          << " de textura, " << e.depois.vaos << " de VAO, " << e.depois.desenhos << " chamadas de desenho" << std::endl;
+}
@@ -0,0 +1,114 @@
+#ifndef FILA_DESENHO_HPP
+#define FILA_DESENHO_HPP
+
+#include "../render/ChavesDesenho.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+class DesenhoMultiplo;
+class Forma;
+class ListaComandos;
+
+/// Mudanças de estado entre desenhos consecutivos (a primeira conta)
+struct TrocasEstado {
+    size_t programas = 0;
+    size_t texturas = 0;
+    size_t vaos = 0;
+    size_t desenhos = 0;              ///< Chamadas de desenho
+};
+
+/// O último quadro da fila: na ordem de chegada contra ordenado e agrupado
+struct EstatisticasFila {
+    size_t itens = 0;
+    size_t lotes = 0;                 ///< Sequências que saíram como um DesenhoMultiplo
+    size_t agrupados = 0;             ///< Itens dentro dessas sequências
+    TrocasEstado antes;               ///< Se cada item fosse desenhado na ordem de chegada
+    TrocasEstado depois;              ///< O que foi de fato gravado
+};
+
+/**
+ * @class FilaDesenho
+ * @brief Desenhos do quadro ordenados por chave de 64 bits antes de ir para a lista
+ *
+ * Cada forma acrescentada ganha uma chave (ChavesDesenho.hpp) com camada,
+ * translucidez, material, textura e profundidade; registrar() ordena as
+ * chaves (radix) e grava os desenhos nessa ordem. Formas cujo material
+ * tem um lote preparado (prepararLote) e que ficam adjacentes depois da
+ * ordenação saem juntas em um DesenhoMultiplo: um programa e uma chamada
+ * para a sequência inteira. As demais saem com Forma::registrar().
+ *
+ * Dentro de uma camada a ordem de chegada não é preservada: formas que
+ * precisam aparecer por cima de outras vão em uma camada maior. Translúcida
+ * = forma SDF (a borda usa a cobertura como alpha).
+ *
+ * @code
+ * FilaDesenho fila;
+ * fila.prepararLote(*bolinhas[0]);          // na carga, com o contexto ativo
+ * // a cada quadro:
+ * fila.acrescentar(estrela, 0);
+ * for (auto& b : bolinhas) fila.acrescentar(*b, 1);
+ * fila.registrar(lista, tempo);
+ * @endcode
+ *
+ * Um lote só é gravado uma vez por quadro (os dados dele são do quadro
+ * inteiro): se o mesmo material aparecer em duas sequências separadas
+ * (camadas diferentes), a segunda sai forma a forma.
+ */
+class FilaDesenho {
+public:
+    FilaDesenho();
+    ~FilaDesenho();
+
+    /**
+     * @brief Formas do material de `modelo` (mesmo formato e modo) passam a ser agrupadas
+     *
+     * Precisa do contexto OpenGL ativo (cria o programa e os buffers do lote).
+     */
+    void prepararLote(const Forma& modelo);
+
+    /**
+     * @brief Põe a forma na fila do quadro
+     *
+     * @param camada - Ordem do pintor: camadas maiores por cima
+     * @param profundidade - 0 (perto) a 1 (longe) dentro da camada e do material:
+     *                       a mais longe é desenhada antes
+     */
+    void acrescentar(Forma& forma, uint8_t camada, float profundidade = 0.0f);
+
+    /**
+     * @brief Ordena, agrupa e grava tudo o que foi acrescentado; a fila volta vazia
+     */
+    void registrar(ListaComandos& lista, float tempo);
+
+    /// Estatísticas do último registrar()
+    const EstatisticasFila& getEstatisticas() const { return estatisticas; }
+
+    /// Trocas de estado do último quadro, na ordem de chegada e depois de ordenar
+    void relatorio(std::ostream& saida) const;
+
+private:
+    struct Item {
+        Forma* forma;
+        int lote;                             ///< Índice em `lotes`, -1 = sem lote
+    };
+
+    std::vector<std::unique_ptr<DesenhoMultiplo>> lotes;
+    std::vector<Item> itens;
+    std::vector<ItemOrdenacao> chaves;
+    std::vector<ItemOrdenacao> temporario;
+    std::vector<uint8_t> loteGravado;         ///< Por lote, neste quadro
+    EstatisticasFila estatisticas;
+
+    /// Estado de um desenho, para contar as trocas
+    struct Estado {
+        unsigned int programa = 0;
+        unsigned int textura = 0;
+        unsigned int vao = 0;
+    };
+    static void contar(TrocasEstado& trocas, Estado& atual, const Estado& novo, size_t desenhos);
+};
+
+#endif // FILA_DESENHO_HPP
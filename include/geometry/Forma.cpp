@@ -1,27 +1,46 @@
 #include "Forma.hpp"
+#include "../render/ListaComandos.hpp"
+#include "../render/BancoTexturas.hpp"
+#include "../fisica/ColisaoSAT.hpp"
+#include "GeometriaEstatica.hpp"
+#include <cmath>
+
+// Repetições da textura por unidade NDC (uma a cada 0.5)
+static const float ESCALA_UV = 2.0f;
 
 // ========== Construtor e Destrutor ==========
 
 Forma::Forma(visual visualizacao) 
     : vis(visualizacao), 
-      VAO(0), 
-      VBO(0), 
+      malha(nullptr), 
       shaderProgram(0), 
       vertexShader(0), 
       fragmentShader(0),
-      timeLoc(-1)
+      timeLoc(-1),
+      deslocamentoLoc(-1),
+      deslocamentoX(0.0f),
+      deslocamentoY(0.0f),
+      escalaRotacaoLoc(-1),
+      escalaX(1.0f),
+      escalaY(1.0f),
+      rotacao(0.0f),
+      escalaRotacao{1.0f, 0.0f, 0.0f, 1.0f},
+      escalaRotacaoSuja(false),
+      texturaMaterial(0),
+      estatica(false)
 {
     // Construtor base - inicializa os atributos
     // As classes derivadas devem chamar gerarVertices() e inicializarRecursos()
 }
 
 Forma::~Forma() {
-    // Libera todos os recursos OpenGL alocados
-    if (VAO) {
-        glDeleteVertexArrays(1, &VAO);
+    // O lote estático não pode guardar um ponteiro para a forma destruída
+    if (estatica) {
+        GeometriaEstatica::instancia().remover(*this);
     }
-    if (VBO) {
-        glDeleteBuffers(1, &VBO);
+    // A malha é compartilhada: o registro só a apaga na última referência
+    if (malha) {
+        RegistroMalhas::instancia().liberar(chaveMalha);
     }
     if (shaderProgram) {
         glDeleteProgram(shaderProgram);
@@ -30,44 +49,160 @@ Forma::~Forma() {
 
 // ========== Métodos de Configuração OpenGL ==========
 
-void Forma::setVAO() {
-    // Gera um novo Vertex Array Object
-    glGenVertexArrays(1, &VAO);
-    // Vincula (bind) o VAO para torná-lo ativo
-    // Todas as configurações subsequentes serão armazenadas neste VAO
-    glBindVertexArray(VAO);
+void Forma::atualizarMalha() {
+    // Chave dos vértices atuais: a forma descreve tipo e parâmetros,
+    // o formato e o material completam
+    ChaveMalha nova;
+    nova.componentes = static_cast<uint8_t>(getComponentesPorVertice());
+    descreverMalha(nova);
+    if (vis.usaTextura()) {
+        nova.parametros.push_back(static_cast<float>(BancoTexturas::camada(vis.getTexture())));
+    }
+    
+    // Adquire antes de liberar: se a chave não mudou, a malha não é recriada
+    RegistroMalhas& registro = RegistroMalhas::instancia();
+    const MalhaGPU* anterior = malha;
+    malha = registro.adquirir(nova, vertices);
+    if (anterior) {
+        registro.liberar(chaveMalha);
+    }
+    chaveMalha = std::move(nova);
+    if (estatica) avisarGeometriaEstatica();
+}
+
+void Forma::setEscala(float x, float y) {
+    escalaX = x;
+    escalaY = y;
+    setRotacao(rotacao);
 }
 
-void Forma::setVBO() {
-    // Gera um novo Vertex Buffer Object
-    glGenBuffers(1, &VBO);
-    // Vincula o VBO ao target GL_ARRAY_BUFFER
-    // Este target é usado para dados de vértices
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+void Forma::setRotacao(float radianos) {
+    // Colunas da matriz: a rotação aplicada a (escalaX, 0) e a (0, escalaY)
+    rotacao = radianos;
+    float c = std::cos(radianos);
+    float s = std::sin(radianos);
+    escalaRotacao[0] = c * escalaX;
+    escalaRotacao[1] = s * escalaX;
+    escalaRotacao[2] = -s * escalaY;
+    escalaRotacao[3] = c * escalaY;
+    escalaRotacaoSuja = true;
+    if (estatica) avisarGeometriaEstatica();
+}
+
+// ========== Geometria Estática ==========
+
+void Forma::setEstatica(bool sim) {
+    if (sim == estatica) return;
+    if (sim && vis.usaSDF()) {
+        std::cerr << "AVISO: Formas SDF não são assadas. Desenhando individualmente." << std::endl;
+        return;
+    }
+    estatica = sim;
+    if (sim) {
+        GeometriaEstatica::instancia().adicionar(*this);
+    } else {
+        GeometriaEstatica::instancia().remover(*this);
+    }
+}
+
+void Forma::avisarGeometriaEstatica() {
+    GeometriaEstatica::instancia().marcarAlterada(*this);
+}
+
+void Forma::assarEm(std::vector<float>& saidaVertices, std::vector<uint32_t>& saidaIndices) const {
+    int componentes = getComponentesPorVertice();
+    int numVertices = getNumeroVertices();
+    uint32_t base = static_cast<uint32_t>(saidaVertices.size() / componentes);
+
+    // Vértices: a mesma conta do vertex shader; UVs e camada seguem iguais
+    for (int i = 0; i < numVertices; i++) {
+        const float* v = &vertices[i * componentes];
+        saidaVertices.push_back(escalaRotacao[0] * v[0] + escalaRotacao[2] * v[1] + deslocamentoX);
+        saidaVertices.push_back(escalaRotacao[1] * v[0] + escalaRotacao[3] * v[1] + deslocamentoY);
+        saidaVertices.insert(saidaVertices.end(), v + 2, v + componentes);
+    }
+
+    // Índices: tudo vira GL_TRIANGLES para caber em uma chamada só
+    GLenum modo = getModoDesenho();
+    for (int i = 0; i + 2 < numVertices; i += (modo == GL_TRIANGLES ? 3 : 1)) {
+        uint32_t a, b, c;
+        if (modo == GL_TRIANGLE_FAN) {
+            a = 0; b = i + 1; c = i + 2;
+        } else if (modo == GL_TRIANGLE_STRIP) {
+            // Faixa: a ordem alterna para manter a orientação
+            a = (i % 2 == 0) ? i : i + 1;
+            b = (i % 2 == 0) ? i + 1 : i;
+            c = i + 2;
+        } else {
+            a = i; b = i + 1; c = i + 2;
+        }
+        saidaIndices.push_back(base + a);
+        saidaIndices.push_back(base + b);
+        saidaIndices.push_back(base + c);
+    }
+}
+
+bool Forma::transformarContorno(const float* xy, size_t n, PoligonoConvexo& saida) const {
+    // Contorno maior que o buffer da pilha: cortar daria outro polígono
+    if (n > 64) return false;
+
+    // Mesma conta do vertex shader: u_escalaRotacao * local + u_deslocamento
+    float mundo[2 * 64];
+    for (size_t i = 0; i < n; i++) {
+        float x = xy[i * 2];
+        float y = xy[i * 2 + 1];
+        mundo[i * 2] = escalaRotacao[0] * x + escalaRotacao[2] * y + deslocamentoX;
+        mundo[i * 2 + 1] = escalaRotacao[1] * x + escalaRotacao[3] * y + deslocamentoY;
+    }
+    saida.definir(mundo, n);
+    return true;
 }
 
-void Forma::configVertices() {
-    // Calcula o tamanho total dos dados em bytes
-    size_t tamanhoBytes = vertices.size() * sizeof(float);
+void Forma::gerarQuadSDF(float meiaLargura, float meiaAltura, float raioCanto) {
+    vertices.clear();
+    vertices.reserve(4 * 5);
     
-    // Envia os dados dos vértices para o buffer na GPU
-    // GL_STATIC_DRAW indica que os dados não mudarão frequentemente
-    // Use GL_DYNAMIC_DRAW se os vértices forem animados/modificados
-    glBufferData(GL_ARRAY_BUFFER, tamanhoBytes, vertices.data(), GL_STATIC_DRAW);
+    // O raio não pode passar da menor meia dimensão
+    float limite = meiaLargura < meiaAltura ? meiaLargura : meiaAltura;
+    if (raioCanto > limite) raioCanto = limite;
+    if (raioCanto < 0.0f) raioCanto = 0.0f;
     
-    // Configura como o OpenGL deve interpretar os dados
-    // Parâmetros:
-    //   0: location do atributo (deve corresponder ao 'layout(location = 0)' no shader)
-    //   2: número de componentes por vértice (x, y) - 2D
-    //   GL_FLOAT: tipo de dado
-    //   GL_FALSE: não normalizar os dados
-    //   2 * sizeof(float): stride - distância entre vértices consecutivos
-    //   (void*)0: offset - começar do início do buffer
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    // Folga para a borda suavizada (alguns pixels numa janela 800x600)
+    const float margem = 0.01f;
+    float mx = meiaLargura + margem;
+    float my = meiaAltura + margem;
     
-    // Ativa o atributo de vértice no location 0
-    // O vertex shader poderá acessar este atributo
-    glEnableVertexAttribArray(0);
+    // Ordem do GL_TRIANGLE_STRIP: inferior esquerdo, inferior direito,
+    // superior esquerdo, superior direito
+    const float cantos[4][2] = { {-mx, -my}, {mx, -my}, {-mx, my}, {mx, my} };
+    for (const auto& c : cantos) {
+        vertices.push_back(c[0]);
+        vertices.push_back(c[1]);
+        vertices.push_back(meiaLargura);
+        vertices.push_back(meiaAltura);
+        vertices.push_back(raioCanto);
+    }
+}
+
+void Forma::aplicarUVs(float origemX, float origemY) {
+    if (!vis.usaTextura()) return;
+    
+    float camada = static_cast<float>(BancoTexturas::camada(vis.getTexture()));
+    
+    // Expande de 2 para 5 floats por vértice no próprio vetor, de trás para
+    // frente para não sobrescrever posições ainda não lidas
+    size_t numVertices = vertices.size() / 2;
+    vertices.resize(numVertices * 5);
+    for (size_t i = numVertices; i-- > 0;) {
+        float x = vertices[i * 2];
+        float y = vertices[i * 2 + 1];
+        float* v = &vertices[i * 5];
+        v[0] = x;
+        v[1] = y;
+        v[2] = (x - origemX) * ESCALA_UV;
+        v[3] = (y - origemY) * ESCALA_UV;
+        v[4] = camada;
+    }
 }
 
 void Forma::setVertexShader() {
@@ -173,20 +308,34 @@ void Forma::inicializarRecursos() {
     // Sequência de inicialização dos recursos OpenGL
     // A ordem é importante!
     
-    // 1. Criar e vincular o VAO
-    setVAO();
-    
-    // 2. Criar e vincular o VBO
-    setVBO();
+    // 0. Formas sem SDF voltam para triângulos (regerando os vértices: com
+    //    textura, o formato passa a incluir as coordenadas de textura)
+    if (vis.usaSDF() && !suportaSDF()) {
+        std::cerr << "AVISO: Forma não suporta SDF. Desenhando com triângulos." << std::endl;
+        vis.desativarSDF();
+        gerarVertices();
+    }
     
-    // 3. Configurar os atributos de vértice e enviar dados
-    configVertices();
+    // 1. Malha do registro (faixa do VBO do formato): nova ou compartilhada com outra forma igual
+    atualizarMalha();
     
-    // 4. Compilar e linkar os shaders
+    // 2. Compilar e linkar os shaders
     setShaderProgram();
     
-    // 5. Obter a localização das variáveis uniform
+    // 3. Obter a localização das variáveis uniform
     setTimeLoc();
+    deslocamentoLoc = glGetUniformLocation(shaderProgram, "u_deslocamento");
+    
+    // O programa é só desta forma: a matriz fica nele até mudar de novo
+    escalaRotacaoLoc = glGetUniformLocation(shaderProgram, "u_escalaRotacao");
+    glUniformMatrix2fv(escalaRotacaoLoc, 1, GL_FALSE, escalaRotacao);
+    escalaRotacaoSuja = false;
+    
+    // 4. Material: o array de texturas é compartilhado por todas as formas
+    if (vis.usaTextura()) {
+        texturaMaterial = BancoTexturas::instancia().getTextura();
+        glUniform1i(glGetUniformLocation(shaderProgram, "u_texturas"), 0);
+    }
 }
 
 // ========== Métodos Públicos de Renderização ==========
@@ -199,14 +348,47 @@ void Forma::usar(float timeValue) {
     if (timeLoc != -1) {
         glUniform1f(timeLoc, timeValue);
     }
+    
+    // Posição da forma (os vértices são locais)
+    glUniform2f(deslocamentoLoc, deslocamentoX, deslocamentoY);
+    glUniformMatrix2fv(escalaRotacaoLoc, 1, GL_FALSE, escalaRotacao);
+    
+    // Formas texturizadas leem o array de texturas da unidade 0
+    if (texturaMaterial) {
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texturaMaterial);
+    }
 }
 
 void Forma::desenhar() {
-    // Vincula o VAO desta forma
+    if (estatica) return;
+    
+    // Vincula o VAO do formato de vértice (o mesmo para todas as malhas dele)
     // Isso restaura todas as configurações de atributos de vértice
-    glBindVertexArray(VAO);
+    glBindVertexArray(malha->VAO);
     
-    // Desenha a forma usando os vértices configurados
+    // Desenha a faixa desta malha dentro do VBO compartilhado
     // glDrawArrays(modo, primeiro vértice, número de vértices)
-    glDrawArrays(getModoDesenho(), 0, getNumeroVertices());
+    glDrawArrays(getModoDesenho(), malha->primeiro, getNumeroVertices());
+}
+
+void Forma::registrar(ListaComandos& lista, float timeValue) {
+    // Estática: desenhada no lote do material pela GeometriaEstatica
+    if (estatica) return;
+    
+    // Mesmo fluxo de usar() + desenhar(), mas gravado para outra thread executar
+    lista.usarPrograma(shaderProgram);
+    if (timeLoc != -1) {
+        lista.uniformFloat(timeLoc, timeValue);
+    }
+    lista.uniformVec2(deslocamentoLoc, deslocamentoX, deslocamentoY);
+    if (escalaRotacaoSuja && lista.uniformMat2(escalaRotacaoLoc, escalaRotacao)) {
+        // Só limpa se o comando entrou: descartado, a matriz vai no próximo quadro
+        escalaRotacaoSuja = false;
+    }
+    if (texturaMaterial) {
+        lista.ligarTextura(GL_TEXTURE_2D_ARRAY, texturaMaterial, 0);
+    }
+    
+    lista.desenhar(malha->VAO, getModoDesenho(), malha->primeiro, getNumeroVertices());
 }
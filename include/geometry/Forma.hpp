@@ -6,15 +6,24 @@
 #include <vector>
 #include <iostream>
 #include "../visual.hpp"
+#include "RegistroMalhas.hpp"
+
+class ListaComandos;
+struct PoligonoConvexo;
 
 /**
  * @class Forma
  * @brief Classe abstrata que serve como interface para todas as formas geométricas
  * 
  * Esta classe define a interface comum que todas as formas geométricas devem implementar.
- * Ela gerencia os recursos do OpenGL (VAO, VBO, shaders) e fornece métodos virtuais puros
+ * Ela gerencia os recursos do OpenGL (malha, shaders) e fornece métodos virtuais puros
  * que cada forma derivada deve implementar para gerar seus vértices específicos.
  * 
+ * Os vértices ficam em espaço local (centro da forma na origem) e a posição
+ * vai no uniform u_deslocamento (escala e rotação em u_escalaRotacao): formas
+ * com os mesmos parâmetros usam a mesma malha do RegistroMalhas, e mover ou
+ * girar uma forma não reenvia vértices.
+ * 
  * Padrão de Design: Template Method + Strategy
  * - Template Method: O fluxo de inicialização é definido aqui
  * - Strategy: Cada forma implementa sua própria estratégia de geração de vértices
@@ -22,42 +31,65 @@
 class Forma {
 protected:
     // ========== Atributos de Dados Geométricos ==========
-    std::vector<float> vertices;  ///< Vetor dinâmico contendo as coordenadas dos vértices (x, y)
+    std::vector<float> vertices;  ///< Vetor dinâmico contendo as coordenadas locais dos vértices (x, y)
     visual vis;                    ///< Objeto que controla a aparência visual (cor, textura, shaders)
     
     // ========== Recursos OpenGL ==========
-    unsigned int VAO;              ///< Vertex Array Object - guarda o estado das configurações de atributos
-    unsigned int VBO;              ///< Vertex Buffer Object - armazena vértices na memória da GPU
+    const MalhaGPU* malha;         ///< Faixa no VBO do formato, do RegistroMalhas
+    ChaveMalha chaveMalha;         ///< Chave com que a malha foi adquirida (para liberar)
     unsigned int shaderProgram;    ///< Programa shader compilado e linkado
     unsigned int vertexShader;     ///< Shader de vértices compilado
     unsigned int fragmentShader;   ///< Shader de fragmentos compilado
     GLint timeLoc;                 ///< Localização da variável uniform u_time nos shaders
+    GLint deslocamentoLoc;         ///< Localização do uniform u_deslocamento (posição da forma)
+    float deslocamentoX;           ///< Posição da origem local em NDC
+    float deslocamentoY;
+    GLint escalaRotacaoLoc;        ///< Localização do uniform u_escalaRotacao (mat2)
+    float escalaX;                 ///< Escala dos vértices locais (1 nas formas com tamanho na malha)
+    float escalaY;
+    float rotacao;                 ///< Radianos, anti-horário, em torno da origem local
+    float escalaRotacao[4];        ///< Matriz 2x2 (colunas) = rotação * escala
+    bool escalaRotacaoSuja;        ///< Mudou desde a última gravação em uma lista
+    unsigned int texturaMaterial;  ///< Array de texturas do BancoTexturas (0 se sem textura)
+    bool estatica;                 ///< Desenhada pela GeometriaEstatica, não por registrar()
 
     // ========== Métodos Privados de Configuração OpenGL ==========
     
     /**
-     * @brief Cria e configura o Vertex Array Object (VAO)
+     * @brief Descreve a malha atual para o RegistroMalhas
+     * 
+     * @param chave - Recebe o tipo e os parâmetros que mudam os vértices locais
      * 
-     * O VAO armazena o estado de configuração dos atributos de vértice,
-     * permitindo trocar entre diferentes configurações rapidamente.
+     * Cada forma informa seu tipo e os parâmetros de gerarVertices() (tamanhos,
+     * segmentos, raio do canto). A posição não entra; os componentes por vértice
+     * e a camada da textura são acrescentados por Forma.
      */
-    void setVAO();
+    virtual void descreverMalha(ChaveMalha& chave) const = 0;
     
     /**
-     * @brief Cria e configura o Vertex Buffer Object (VBO)
+     * @brief Move a forma sem tocar nos vértices
      * 
-     * O VBO aloca memória na GPU e armazena os dados dos vértices
-     * para renderização eficiente.
+     * @param x - Posição da origem local em NDC
+     * @param y - Posição da origem local em NDC
+     * 
+     * Só muda o valor enviado ao uniform u_deslocamento no próximo desenho.
      */
-    void setVBO();
+    void setDeslocamento(float x, float y) {
+        deslocamentoX = x;
+        deslocamentoY = y;
+        if (estatica) avisarGeometriaEstatica();
+    }
+    
+    /// Forma estática mudou de lugar ou de malha: o material dela é reassado
+    void avisarGeometriaEstatica();
     
     /**
-     * @brief Configura como o OpenGL deve interpretar os dados dos vértices
+     * @brief Escala aplicada aos vértices locais no vertex shader
      * 
-     * Define o layout dos atributos de vértice (posição, normal, etc.)
-     * e envia os dados do vetor vertices para o buffer na GPU.
+     * Formas com malha unitária (PoligonoRegular e derivadas) passam o tamanho
+     * por aqui, e todas as instâncias de mesmo formato dividem a malha.
      */
-    void configVertices();
+    void setEscala(float x, float y);
     
     /**
      * @brief Compila o vertex shader a partir do código GLSL
@@ -107,6 +139,43 @@ protected:
      */
     void inicializarRecursos();
 
+    /**
+     * @brief Gera um único quad (4 vértices, GL_TRIANGLE_STRIP) para o modo SDF
+     * 
+     * @param meiaLargura - Metade da largura da forma
+     * @param meiaAltura - Metade da altura da forma
+     * @param raioCanto - Raio dos cantos (meiaLargura == meiaAltura == raio gera um círculo)
+     * 
+     * Cada vértice leva 5 floats: posição local (x, y), que também é o ponto
+     * avaliado pela distância, e os parâmetros da forma (meia largura, meia
+     * altura, raio). O quad é um pouco maior que a forma para a borda
+     * suavizada não ser cortada.
+     */
+    void gerarQuadSDF(float meiaLargura, float meiaAltura, float raioCanto);
+
+    /**
+     * @brief Acrescenta (u, v, camada) a cada vértice quando a forma tem textura
+     * 
+     * @param origemX - x local do canto inferior esquerdo da forma (u = 0)
+     * @param origemY - y local do canto inferior esquerdo da forma (v = 0)
+     * 
+     * Chamado no fim de gerarVertices() com os vértices em (x, y). O mapeamento
+     * é planar com densidade fixa (uma repetição a cada 0.5 unidade NDC), então
+     * formas de tamanhos diferentes têm o mesmo tamanho de veio/grão. Sem
+     * textura não faz nada.
+     */
+    void aplicarUVs(float origemX, float origemY);
+
+    /**
+     * @brief Leva pontos locais para o mundo (escala, rotação e deslocamento atuais)
+     * 
+     * @param xy - Pontos (x, y) locais em sequência
+     * @param n - Quantidade de pontos (até 64)
+     * @param saida - Polígono de colisão a definir
+     * @return bool - false (e saida intacta) se n passar de 64
+     */
+    bool transformarContorno(const float* xy, size_t n, PoligonoConvexo& saida) const;
+
 public:
     // ========== Métodos Virtuais Puros (Devem ser implementados pelas classes derivadas) ==========
     
@@ -139,6 +208,16 @@ public:
      */
     virtual int getNumeroVertices() const = 0;
 
+    /**
+     * @brief Indica se a forma sabe se desenhar no modo SDF
+     * 
+     * @return bool - false por padrão; formas que implementam gerarQuadSDF retornam true
+     * 
+     * Se a visualização pedir SDF e a forma não suportar, inicializarRecursos()
+     * avisa e volta para o modo de triângulos.
+     */
+    virtual bool suportaSDF() const { return false; }
+
     // ========== Construtores e Destrutor ==========
     
     /**
@@ -155,7 +234,7 @@ public:
     /**
      * @brief Destrutor virtual
      * 
-     * Libera todos os recursos OpenGL alocados (VAO, VBO, shaders).
+     * Libera o programa shader e a referência à malha compartilhada.
      * Sendo virtual, garante que o destrutor da classe derivada
      * seja chamado corretamente.
      */
@@ -180,20 +259,122 @@ public:
      * para renderizar a forma geométrica.
      */
     void desenhar();
+    
+    /**
+     * @brief Grava em uma lista de comandos o equivalente a usar() + desenhar()
+     * 
+     * @param lista - Lista do quadro atual (executada pela ThreadRender)
+     * @param timeValue - Tempo atual para animações
+     * 
+     * Não chama OpenGL: pode ser usado fora da thread do contexto. A posição
+     * atual (reposicionar) vai na lista como valor do uniform.
+     */
+    void registrar(ListaComandos& lista, float timeValue);
+    
+    /**
+     * @brief Gira a forma em torno da sua origem local
+     * 
+     * @param radianos - Ângulo anti-horário
+     * 
+     * Como a posição, vai em um uniform: os vértices e a malha não mudam.
+     * Triângulos com vértices customizados giram em torno de (0, 0).
+     */
+    void setRotacao(float radianos);
+    
+    /**
+     * @brief Obtém a rotação atual
+     * @return float - Radianos, anti-horário
+     */
+    float getRotacao() const { return rotacao; }
+    
+    // ========== Geometria Estática ==========
+    
+    /**
+     * @brief Marca a forma como estática (parede, decoração, linha da rede)
+     * 
+     * @param sim - true: a forma entra na GeometriaEstatica, que a desenha
+     *        junto com as outras do mesmo material em uma chamada só, e
+     *        registrar() passa a não gravar nada; false: volta a ser desenhada
+     *        sozinha
+     * 
+     * A primeira forma de um material novo cria o programa e os buffers do
+     * lote: precisa do contexto OpenGL ativo. Formas SDF não são assadas (a
+     * distância é calculada nas coordenadas locais) e continuam individuais.
+     * Mover ou girar uma forma estática funciona, mas reassa o material
+     * inteiro: para formas que se mexem, deixe o flag desligado.
+     */
+    void setEstatica(bool sim);
+    
+    bool isEstatica() const { return estatica; }
+    
+    /**
+     * @brief Acrescenta a forma já transformada (posição, escala e rotação) a um lote
+     * 
+     * @param saidaVertices - Recebe getComponentesPorVertice() floats por vértice, (x, y) no mundo
+     * @param saidaIndices - Recebe 3 índices por triângulo (leque e faixa viram triângulos),
+     *        já deslocados para os vértices acrescentados
+     */
+    void assarEm(std::vector<float>& saidaVertices, std::vector<uint32_t>& saidaIndices) const;
+    
+    // ========== Colisão ==========
+    
+    /**
+     * @brief Contorno convexo da forma no mundo, para a fase estreita SAT
+     * 
+     * @param saida - Polígono a definir (reutilizável entre quadros)
+     * @return bool - false se a forma não é um polígono convexo (círculo,
+     *         estrela, polígono qualquer): use outro teste para ela
+     * 
+     * @see colidirSAT
+     */
+    virtual bool contornoConvexo(PoligonoConvexo& saida) const {
+        (void)saida;
+        return false;
+    }
+    
+    // ========== Sincronização CPU → GPU ==========
+    
+    /**
+     * @brief Troca a malha da forma pela dos vértices atuais
+     * 
+     * Deve ser chamado após mudar um parâmetro que altera os vértices
+     * (tamanho, segmentos, raio do canto). A malha antiga é liberada no
+     * registro e a nova é reaproveitada se outra forma já tiver a mesma
+     * chave. Precisa do contexto OpenGL ativo.
+     */
+    void atualizarMalha();
 
     // ========== Getters ==========
     
     /**
-     * @brief Obtém o Vertex Array Object
+     * @brief Obtém o Vertex Array Object (compartilhado com todas as formas do mesmo formato de vértice)
      * @return unsigned int - ID do VAO
      */
-    unsigned int getVAO() const { return VAO; }
+    unsigned int getVAO() const { return malha ? malha->VAO : 0; }
+    
+    /**
+     * @brief Obtém o Vertex Buffer Object (compartilhado com todas as formas do mesmo formato de vértice)
+     * @return unsigned int - ID do VBO (a malha começa no vértice getPrimeiroVertice())
+     */
+    unsigned int getVBO() const { return malha ? RegistroMalhas::instancia().getVBO(chaveMalha.componentes) : 0; }
+    
+    /**
+     * @brief Obtém o primeiro vértice da malha no VBO do formato
+     * @return int - O `first` do glDrawArrays
+     */
+    int getPrimeiroVertice() const { return malha ? malha->primeiro : 0; }
+    
+    /**
+     * @brief Obtém a posição (o valor de u_deslocamento)
+     */
+    float getDeslocamentoX() const { return deslocamentoX; }
+    float getDeslocamentoY() const { return deslocamentoY; }
     
     /**
-     * @brief Obtém o Vertex Buffer Object
-     * @return unsigned int - ID do VBO
+     * @brief Obtém a matriz de escala e rotação (o valor de u_escalaRotacao)
+     * @return const float* - 4 floats, por colunas
      */
-    unsigned int getVBO() const { return VBO; }
+    const float* getEscalaRotacao() const { return escalaRotacao; }
     
     /**
      * @brief Obtém o programa shader
@@ -206,6 +387,25 @@ public:
      * @return const std::vector<float>& - Referência constante ao vetor de vértices
      */
     const std::vector<float>& getVertices() const { return vertices; }
+    
+    /**
+     * @brief Obtém a aparência (os shaders saem dela)
+     * @return const visual& - Referência constante ao visual da forma
+     */
+    const visual& getVisual() const { return vis; }
+    
+    /**
+     * @brief Obtém o array de texturas do material
+     * @return unsigned int - 0 se a forma não tem textura
+     */
+    unsigned int getTexturaMaterial() const { return texturaMaterial; }
+    
+    /**
+     * @brief Obtém o número de floats por vértice
+     * @return int - 2 (x, y) no modo de triângulos, 5 com textura (+ u, v, camada) ou no modo SDF
+     *         (+ meia largura, meia altura, raio)
+     */
+    int getComponentesPorVertice() const { return vis.usaSDF() || vis.usaTextura() ? 5 : 2; }
 };
 
 #endif // FORMA_HPP
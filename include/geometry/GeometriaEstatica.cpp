@@ -0,0 +1,284 @@
+#include "GeometriaEstatica.hpp"
+#include "Forma.hpp"
+#include "RegistroMalhas.hpp"
+#include "../render/ListaComandos.hpp"
+#include <algorithm>
+#include <cstring>
+
+// ========== Acesso ==========
+
+GeometriaEstatica& GeometriaEstatica::instancia() {
+    static GeometriaEstatica geometria;
+    return geometria;
+}
+
+// ========== Lotes ==========
+
+static GLuint compilarShader(GLenum tipo, const char* fonte) {
+    GLuint shader = glCreateShader(tipo);
+    glShaderSource(shader, 1, &fonte, NULL);
+    glCompileShader(shader);
+
+    int success;
+    char infoLog[512];
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        std::cerr << "ERRO: Falha na compilação do shader do lote estático\n" << infoLog << std::endl;
+    }
+    return shader;
+}
+
+GeometriaEstatica::Lote& GeometriaEstatica::criarLote(const Forma& forma, const std::string& chave) {
+    std::unique_ptr<Lote> lote(new Lote());
+    lote->chave = chave;
+    lote->componentes = forma.getComponentesPorVertice();
+    lote->textura = forma.getTexturaMaterial();
+
+    // Mesmos shaders das formas do material; os vértices já vêm no mundo
+    const visual& vis = forma.getVisual();
+    GLuint vertexShader = compilarShader(GL_VERTEX_SHADER, vis.geraVertexShader());
+    GLuint fragmentShader = compilarShader(GL_FRAGMENT_SHADER, vis.geraFragmentShader());
+    lote->programa = glCreateProgram();
+    glAttachShader(lote->programa, vertexShader);
+    glAttachShader(lote->programa, fragmentShader);
+    glLinkProgram(lote->programa);
+    int success;
+    char infoLog[512];
+    glGetProgramiv(lote->programa, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(lote->programa, 512, NULL, infoLog);
+        std::cerr << "ERRO: Falha ao linkar o programa do lote estático\n" << infoLog << std::endl;
+    }
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    // Transformação identidade: fica no programa para sempre
+    const float identidade[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+    glUseProgram(lote->programa);
+    glUniform2f(glGetUniformLocation(lote->programa, "u_deslocamento"), 0.0f, 0.0f);
+    glUniformMatrix2fv(glGetUniformLocation(lote->programa, "u_escalaRotacao"), 1, GL_FALSE, identidade);
+    if (lote->textura) {
+        glUniform1i(glGetUniformLocation(lote->programa, "u_texturas"), 0);
+    }
+    lote->timeLoc = glGetUniformLocation(lote->programa, "u_time");
+
+    // VAO com o mesmo layout das malhas; o EBO fica guardado nele
+    glGenVertexArrays(1, &lote->VAO);
+    glBindVertexArray(lote->VAO);
+    glGenBuffers(2, lote->buffers);
+    glBindBuffer(GL_ARRAY_BUFFER, lote->buffers[0]);
+    RegistroMalhas::configurarAtributos(lote->componentes);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, lote->buffers[1]);
+    glBindVertexArray(0);
+
+    lotes.push_back(std::move(lote));
+    lotePorChave[chave] = lotes.back().get();
+    return *lotes.back();
+}
+
+void GeometriaEstatica::adicionar(Forma& forma) {
+    if (loteDaForma.count(&forma)) return;
+
+    // Material = par de shaders (cor, textura e modo estão no código gerado)
+    const visual& vis = forma.getVisual();
+    std::string chave = std::string(vis.geraVertexShader()) + '\n' + vis.geraFragmentShader();
+    auto existente = lotePorChave.find(chave);
+    Lote& lote = existente != lotePorChave.end() ? *existente->second : criarLote(forma, chave);
+
+    // Vai para o fim: no próximo envio só ela é transformada
+    lote.formas.push_back(&forma);
+    loteDaForma[&forma] = &lote;
+}
+
+void GeometriaEstatica::remover(Forma& forma) {
+    auto existente = loteDaForma.find(&forma);
+    if (existente == loteDaForma.end()) return;
+
+    Lote& lote = *existente->second;
+    lote.formas.erase(std::find(lote.formas.begin(), lote.formas.end(), &forma));
+    lote.reconstruir = true;
+    loteDaForma.erase(existente);
+}
+
+void GeometriaEstatica::marcarAlterada(const Forma& forma) {
+    auto existente = loteDaForma.find(&forma);
+    if (existente != loteDaForma.end()) {
+        existente->second->reconstruir = true;
+    }
+}
+
+void GeometriaEstatica::liberar() {
+    for (const auto& lote : lotes) {
+        glDeleteBuffers(2, lote->buffers);
+        glDeleteVertexArrays(1, &lote->VAO);
+        glDeleteProgram(lote->programa);
+    }
+    lotes.clear();
+    lotePorChave.clear();
+    loteDaForma.clear();
+}
+
+bool GeometriaEstatica::temPendencias() const {
+    for (const auto& lote : lotes) {
+        if (lote->reconstruir || lote->formasMontadas < lote->formas.size()) return true;
+    }
+    return false;
+}
+
+// ========== Envio ==========
+
+bool GeometriaEstatica::montarEnvio(Lote& lote) {
+    if (!lote.reconstruir && lote.formasMontadas == lote.formas.size()) return false;
+
+    // Reconstrução começa do zero; acréscimo só transforma as formas novas
+    size_t desde[2] = { lote.enviados[0], lote.enviados[1] };
+    if (lote.reconstruir) {
+        lote.vertices.clear();
+        lote.indices.clear();
+        lote.formasMontadas = 0;
+        desde[0] = desde[1] = 0;
+        contadores.reconstrucoes++;
+    } else {
+        contadores.acrescimos++;
+    }
+    for (size_t i = lote.formasMontadas; i < lote.formas.size(); i++) {
+        lote.formas[i]->assarEm(lote.vertices, lote.indices);
+    }
+    lote.formasMontadas = lote.formas.size();
+    lote.reconstruir = false;
+
+    // Cabe no buffer: só o trecho novo; não cabe: realoca com folga e envia tudo
+    const unsigned char* origem[2] = {
+        reinterpret_cast<const unsigned char*>(lote.vertices.data()),
+        reinterpret_cast<const unsigned char*>(lote.indices.data())
+    };
+    size_t total[2] = { lote.vertices.size() * sizeof(float), lote.indices.size() * sizeof(uint32_t) };
+    Envio envio;
+    for (int k = 0; k < 2; k++) {
+        envio.buffers[k] = lote.buffers[k];
+        if (total[k] > lote.capacidade[k]) {
+            lote.capacidade[k] = std::max(total[k], lote.capacidade[k] + lote.capacidade[k] / 2);
+            envio.capacidade[k] = lote.capacidade[k];
+            desde[k] = 0;
+        } else {
+            envio.capacidade[k] = 0;
+        }
+        envio.offset[k] = desde[k];
+        envio.bytes[k] = total[k] - desde[k];
+        lote.enviados[k] = total[k];
+    }
+    lote.numIndices = static_cast<GLsizei>(lote.indices.size());
+
+    pacote.resize(sizeof(Envio) + envio.bytes[0] + envio.bytes[1]);
+    std::memcpy(pacote.data(), &envio, sizeof(Envio));
+    unsigned char* destino = pacote.data() + sizeof(Envio);
+    for (int k = 0; k < 2; k++) {
+        if (envio.bytes[k]) std::memcpy(destino, origem[k] + envio.offset[k], envio.bytes[k]);
+        destino += envio.bytes[k];
+    }
+    contadores.bytesEnviados += envio.bytes[0] + envio.bytes[1];
+    return true;
+}
+
+void GeometriaEstatica::aplicarEnvio(const unsigned char* dados) {
+    Envio envio;
+    std::memcpy(&envio, dados, sizeof(Envio));
+    dados += sizeof(Envio);
+
+    // GL_ARRAY_BUFFER para os dois: o alvo só importa no envio, e o EBO
+    // continua ligado ao VAO
+    for (int k = 0; k < 2; k++) {
+        glBindBuffer(GL_ARRAY_BUFFER, envio.buffers[k]);
+        if (envio.capacidade[k]) {
+            glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(envio.capacidade[k]), nullptr, GL_STATIC_DRAW);
+        }
+        if (envio.bytes[k]) {
+            glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(envio.offset[k]),
+                            static_cast<GLsizeiptr>(envio.bytes[k]), dados);
+        }
+        dados += envio.bytes[k];
+    }
+}
+
+void GeometriaEstatica::aplicarEnvioLista(void*, const void* dados) {
+    aplicarEnvio(static_cast<const unsigned char*>(dados));
+}
+
+void GeometriaEstatica::aplicarEnvioDireto(void* contexto) {
+    aplicarEnvio(static_cast<const std::vector<unsigned char>*>(contexto)->data());
+}
+
+void GeometriaEstatica::assar() {
+    for (const auto& lote : lotes) {
+        if (montarEnvio(*lote)) {
+            aplicarEnvio(pacote.data());
+        }
+    }
+}
+
+// ========== Desenho ==========
+
+void GeometriaEstatica::registrar(ListaComandos& lista, float tempo) {
+    for (const auto& ptr : lotes) {
+        Lote& lote = *ptr;
+
+        // Envio copiado para a lista: a thread do jogo pode reassar de novo
+        // no quadro seguinte sem esperar a de render
+        if (montarEnvio(lote)) {
+            if (lista.getBytesUsados() + pacote.size() + alignof(std::max_align_t) <= lista.getCapacidadeBytes()) {
+                lista.chamarComDados(&GeometriaEstatica::aplicarEnvioLista, nullptr, pacote.data(), pacote.size());
+            } else {
+                // Não cabe: o pacote fica no lote, na vaga desta lista. Gravar
+                // nela de novo significa que a execução anterior já terminou
+                int vaga = lote.listaDireto[0] == &lista ? 0
+                         : lote.listaDireto[1] == &lista ? 1
+                         : 1 - lote.ultimoDireto;
+                lote.listaDireto[vaga] = &lista;
+                lote.ultimoDireto = vaga;
+                lote.pacoteDireto[vaga].swap(pacote);
+                lista.chamar(&GeometriaEstatica::aplicarEnvioDireto, &lote.pacoteDireto[vaga]);
+                if (!avisouEnvioDireto) {
+                    std::cerr << "AVISO: lote estático de " << lote.pacoteDireto[vaga].size()
+                              << " bytes não cabe na lista; enviado fora dela (assar() na carga evita)." << std::endl;
+                    avisouEnvioDireto = true;
+                }
+            }
+        }
+        if (lote.numIndices == 0) continue;
+
+        // Um material, uma chamada
+        lista.usarPrograma(lote.programa);
+        if (lote.timeLoc != -1) {
+            lista.uniformFloat(lote.timeLoc, tempo);
+        }
+        if (lote.textura) {
+            lista.ligarTextura(GL_TEXTURE_2D_ARRAY, lote.textura, 0);
+        }
+        lista.desenharIndices(lote.VAO, GL_TRIANGLES, lote.numIndices);
+    }
+}
+
+// ========== Relatório ==========
+
+EstatisticasEstaticas GeometriaEstatica::getEstatisticas() const {
+    EstatisticasEstaticas e = contadores;
+    e.formas = loteDaForma.size();
+    e.materiais = lotes.size();
+    e.vertices = e.indices = e.bytesGPU = 0;
+    for (const auto& lote : lotes) {
+        e.vertices += lote->vertices.size() / lote->componentes;
+        e.indices += lote->indices.size();
+        e.bytesGPU += lote->capacidade[0] + lote->capacidade[1];
+    }
+    return e;
+}
+
+void GeometriaEstatica::relatorio(std::ostream& saida) const {
+    EstatisticasEstaticas e = getEstatisticas();
+    saida << "Geometria estática: " << e.formas << " formas em " << e.materiais << " lotes ("
+          << e.materiais << " chamadas de desenho em vez de " << e.formas << "), " << e.vertices
+          << " vértices, " << e.indices << " índices, " << e.bytesGPU << " bytes na GPU ("
+          << e.reconstrucoes << " reconstruções, " << e.acrescimos << " acréscimos, "
+          << e.bytesEnviados << " bytes enviados)" << std::endl;
+}
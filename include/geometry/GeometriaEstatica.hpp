@@ -0,0 +1,161 @@
+#ifndef GEOMETRIA_ESTATICA_HPP
+#define GEOMETRIA_ESTATICA_HPP
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class Forma;
+class ListaComandos;
+
+/// Tamanho dos lotes estáticos e quanto trabalho os reassamentos deram
+struct EstatisticasEstaticas {
+    size_t formas = 0;                ///< Formas estáticas em algum lote
+    size_t materiais = 0;             ///< Lotes (uma chamada de desenho cada)
+    size_t vertices = 0;              ///< Vértices já transformados nos lotes
+    size_t indices = 0;
+    size_t bytesGPU = 0;              ///< Capacidade dos VBOs + EBOs dos lotes
+    size_t reconstrucoes = 0;         ///< Lotes retransformados do zero (remoção ou forma alterada)
+    size_t acrescimos = 0;            ///< Lotes em que só as formas novas foram transformadas
+    size_t bytesEnviados = 0;         ///< Total enviado à GPU pelos reassamentos
+};
+
+/**
+ * @class GeometriaEstatica
+ * @brief Formas que não se mexem, agrupadas por material e desenhadas em uma chamada por grupo
+ *
+ * Paredes, decorações e a linha da rede ficam paradas a partida inteira,
+ * mas cada forma custa um glUseProgram, uniforms e um draw call. Com
+ * Forma::setEstatica(true), a forma entra no lote do seu material (mesmos
+ * shaders: mesma cor, mesma textura e mesmo modo); os vértices já saem
+ * transformados para o mundo, os leques e faixas viram triângulos
+ * indexados, e o lote inteiro é um glDrawElements.
+ *
+ * Reassar é incremental: acrescentar formas a um lote só transforma e
+ * envia as novas (glBufferSubData no fim do buffer, se couber); remover ou
+ * alterar uma forma reconstrói só o lote dela. Lotes intocados não são
+ * enviados de novo.
+ *
+ * @code
+ * parede.setEstatica(true);                    // na carga, com o contexto ativo
+ * GeometriaEstatica::instancia().assar();      // envia já, sem passar pela lista
+ * // a cada quadro:
+ * GeometriaEstatica::instancia().registrar(lista, tempo);
+ * // no encerramento, com o contexto de volta na thread principal:
+ * GeometriaEstatica::instancia().liberar();
+ * @endcode
+ *
+ * Os lotes são desenhados na ordem em que os materiais apareceram, e dentro
+ * do lote na ordem em que as formas foram marcadas. Só a thread do jogo
+ * mexe no objeto; os envios vão copiados na lista de comandos. Um envio
+ * maior que o espaço livre da lista fica guardado no lote, um por lista
+ * (as duas da ThreadRender), e a lista só leva a chamada que o aplica.
+ */
+class GeometriaEstatica {
+public:
+    /// A geometria estática da aplicação
+    static GeometriaEstatica& instancia();
+
+    /**
+     * @brief Coloca a forma no lote do seu material (chamado por Forma::setEstatica)
+     *
+     * Criar o lote de um material novo precisa do contexto OpenGL ativo.
+     */
+    void adicionar(Forma& forma);
+
+    /// Tira a forma do seu lote (o lote é reconstruído no próximo envio)
+    void remover(Forma& forma);
+
+    /// A forma mudou de posição ou de malha: o lote dela é reconstruído
+    void marcarAlterada(const Forma& forma);
+
+    /**
+     * @brief Envia direto à GPU os lotes pendentes
+     *
+     * Para a carga, antes de a ThreadRender assumir o contexto: precisa do
+     * contexto ativo na thread que chama. Depois disso, registrar() faz o
+     * mesmo através da lista.
+     */
+    void assar();
+
+    /**
+     * @brief Grava os envios pendentes e uma chamada de desenho por lote
+     *
+     * @param lista - Lista do quadro atual
+     * @param tempo - Valor de u_time (cores animadas)
+     */
+    void registrar(ListaComandos& lista, float tempo);
+
+    /// true se algum lote tem formas ainda não enviadas
+    bool temPendencias() const;
+
+    /**
+     * @brief Apaga os programas, VAOs e buffers dos lotes e esvazia tudo
+     *
+     * Chamar antes de destruir o contexto, com ele ativo: como no
+     * BancoTexturas, o objeto é estático e não chama OpenGL no destrutor.
+     * As formas destruídas depois disso não encontram mais o seu lote.
+     */
+    void liberar();
+
+    EstatisticasEstaticas getEstatisticas() const;
+
+    /// Formas, lotes, vértices e quanto foi reassado
+    void relatorio(std::ostream& saida) const;
+
+private:
+    GeometriaEstatica() = default;
+
+    struct Lote {
+        std::string chave;                  ///< Fontes dos shaders: define o material
+        GLuint programa = 0;
+        GLuint VAO = 0;
+        GLuint buffers[2] = { 0, 0 };       ///< VBO e EBO
+        GLint timeLoc = -1;
+        GLuint textura = 0;
+        int componentes = 2;
+
+        std::vector<Forma*> formas;         ///< Na ordem de desenho
+        size_t formasMontadas = 0;          ///< Prefixo de `formas` já em `vertices`/`indices`
+        bool reconstruir = false;           ///< Remoção ou alteração: retransforma tudo
+
+        std::vector<float> vertices;        ///< Cópia na CPU do que está (ou vai) na GPU
+        std::vector<uint32_t> indices;
+        size_t enviados[2] = { 0, 0 };      ///< Bytes de vertices/indices já na GPU
+        size_t capacidade[2] = { 0, 0 };    ///< Bytes alocados no VBO/EBO
+        GLsizei numIndices = 0;             ///< Índices desenhados (os já enviados)
+
+        /// Envios que não couberam na lista: válidos até a mesma lista ser regravada
+        std::vector<unsigned char> pacoteDireto[2];
+        const ListaComandos* listaDireto[2] = { nullptr, nullptr };
+        int ultimoDireto = 1;
+    };
+
+    /// Cabeçalho dos envios: o que alocar e qual trecho escrever em cada buffer
+    struct Envio {
+        GLuint buffers[2];
+        size_t capacidade[2];               ///< Bytes a alocar (0 = mantém o buffer)
+        size_t offset[2];
+        size_t bytes[2];                    ///< Trechos logo depois do cabeçalho, vértices e índices
+    };
+
+    std::vector<std::unique_ptr<Lote>> lotes;
+    std::unordered_map<std::string, Lote*> lotePorChave;
+    std::unordered_map<const Forma*, Lote*> loteDaForma;
+    std::vector<unsigned char> pacote;      ///< Envio + trechos, montado na thread do jogo
+    EstatisticasEstaticas contadores;
+    bool avisouEnvioDireto = false;
+
+    Lote& criarLote(const Forma& forma, const std::string& chave);
+    bool montarEnvio(Lote& lote);
+    static void aplicarEnvio(const unsigned char* pacote);
+    static void aplicarEnvioLista(void* contexto, const void* dados);
+    static void aplicarEnvioDireto(void* contexto);
+};
+
+#endif // GEOMETRIA_ESTATICA_HPP
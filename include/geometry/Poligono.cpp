@@ -0,0 +1,71 @@
+#include "Poligono.hpp"
+
+// ========== Construtores ==========
+
+Poligono::Poligono(const std::vector<float>& contorno, visual visualizacao)
+    : Poligono(0.0f, 0.0f, contorno, visualizacao)
+{
+}
+
+Poligono::Poligono(float x, float y, const std::vector<float>& contorno, visual visualizacao)
+    : Forma(visualizacao),
+      posX(x),
+      posY(y),
+      triangulacao(nullptr)
+{
+    // Triangulação do cache, vértices e malha do registro
+    triangular(contorno);
+    gerarVertices();
+    inicializarRecursos();
+    setDeslocamento(x, y);
+}
+
+// ========== Triangulação ==========
+
+void Poligono::triangular(const std::vector<float>& contorno) {
+    // Mínimo de 3 pontos; um float sobrando no fim é ignorado
+    size_t numPontos = contorno.size() / 2;
+    if (numPontos < 3) {
+        std::cerr << "AVISO: Polígono precisa de pelo menos 3 pontos." << std::endl;
+    }
+
+    triangulacao = &CacheTriangulacoes::instancia().obter(contorno.data(), numPontos);
+    if (numPontos >= 3 && !triangulacao->completa) {
+        std::cerr << "AVISO: Contorno de " << numPontos
+                  << " pontos não é um polígono simples; triangulação parcial." << std::endl;
+    }
+}
+
+// ========== Implementação dos Métodos Virtuais ==========
+
+void Poligono::gerarVertices() {
+    // Só cópia: os triângulos já estão prontos no cache
+    vertices.assign(triangulacao->triangulos.begin(), triangulacao->triangulos.end());
+
+    // Textura a partir do canto da caixa envolvente do contorno
+    aplicarUVs(triangulacao->minX, triangulacao->minY);
+}
+
+void Poligono::descreverMalha(ChaveMalha& chave) const {
+    // Um id por contorno distinto: mesmo contorno, mesma malha
+    chave.tipo = TipoMalha::poligono;
+    chave.parametros.push_back(static_cast<float>(triangulacao->id));
+}
+
+// ========== Métodos de Transformação ==========
+
+void Poligono::setContorno(const std::vector<float>& contorno) {
+    triangular(contorno);
+
+    // Outro contorno: outros vértices e outra malha
+    gerarVertices();
+    atualizarMalha();
+}
+
+void Poligono::reposicionar(float x, float y) {
+    posX = x;
+    posY = y;
+
+    // Os vértices são locais: só o deslocamento do próximo desenho muda
+    setDeslocamento(x, y);
+}
@@ -0,0 +1,113 @@
+#ifndef POLIGONO_HPP
+#define POLIGONO_HPP
+
+#include "Forma.hpp"
+#include "Triangulacao.hpp"
+#include <vector>
+
+/**
+ * @class Poligono
+ * @brief Polígono simples qualquer (côncavo inclusive): contornos de fase, obstáculos
+ *
+ * O contorno é triangulado pelo Triangulador (partes monótonas, O(n log n)) e o resultado
+ * fica no CacheTriangulacoes, indexado pelo hash do contorno: o mesmo
+ * contorno usado por várias formas, ou recriado a cada fase, é triangulado
+ * uma única vez e divide a malha no RegistroMalhas.
+ *
+ * Características:
+ * - Contorno em coordenadas locais, em qualquer orientação, sem repetir o
+ *   primeiro ponto no fim
+ * - numPontos - 2 triângulos, GL_TRIANGLES
+ * - Contornos com autointerseção geram aviso e desenham o que foi possível
+ */
+class Poligono : public Forma {
+public:
+    // ========== Construtores ==========
+
+    /**
+     * @brief Polígono com o contorno em torno da origem
+     *
+     * @param contorno - Pontos (x, y) em sequência (mínimo: 3 pontos)
+     * @param visualizacao - Objeto visual que define cor e aparência
+     */
+    Poligono(const std::vector<float>& contorno, visual visualizacao = visual());
+
+    /**
+     * @brief Polígono em uma posição específica
+     *
+     * @param x - Deslocamento x aplicado ao contorno
+     * @param y - Deslocamento y aplicado ao contorno
+     * @param contorno - Pontos (x, y) locais em sequência (mínimo: 3 pontos)
+     * @param visualizacao - Objeto visual que define cor e aparência
+     */
+    Poligono(float x, float y, const std::vector<float>& contorno, visual visualizacao = visual());
+
+    ~Poligono() override = default;
+
+    // ========== Implementação dos Métodos Virtuais Puros ==========
+
+    /**
+     * @brief Copia os triângulos do cache (e acrescenta as UVs com textura)
+     */
+    void gerarVertices() override;
+
+    /**
+     * @brief Modo de desenho: triângulos soltos
+     * @return GLenum - GL_TRIANGLES
+     */
+    GLenum getModoDesenho() const override { return GL_TRIANGLES; }
+
+    /**
+     * @brief Três vértices por triângulo
+     * @return int - 3 × (pontos - 2) em um polígono simples
+     */
+    int getNumeroVertices() const override {
+        return static_cast<int>(triangulacao->triangulos.size() / 2);
+    }
+
+    // ========== Métodos de Transformação ==========
+
+    /**
+     * @brief Troca o contorno (triangula só se o contorno for novo no cache)
+     * @param contorno - Pontos (x, y) locais em sequência (mínimo: 3 pontos)
+     */
+    void setContorno(const std::vector<float>& contorno);
+
+    /**
+     * @brief Move o polígono (só o uniform de deslocamento)
+     */
+    void setPosicao(float x, float y) { reposicionar(x, y); }
+
+    /**
+     * @brief Move o polígono sem chamar OpenGL (pode rodar em threads de trabalho)
+     */
+    void reposicionar(float x, float y);
+
+    void getPosicao(float& outX, float& outY) const {
+        outX = posX;
+        outY = posY;
+    }
+
+    /// Contorno como recebido
+    const std::vector<float>& getContorno() const { return triangulacao->contorno; }
+
+    /// false se o contorno tinha autointerseção (triangulação parcial)
+    bool isCompleto() const { return triangulacao->completa; }
+
+protected:
+    /**
+     * @brief Identificador do contorno no cache de triangulações
+     * @param chave - Chave da malha a preencher
+     */
+    void descreverMalha(ChaveMalha& chave) const override;
+
+private:
+    /// Busca (ou calcula) a triangulação do contorno e avisa se estiver incompleta
+    void triangular(const std::vector<float>& contorno);
+
+    float posX;                                   ///< Deslocamento x do contorno
+    float posY;                                   ///< Deslocamento y do contorno
+    const TriangulacaoCache* triangulacao;        ///< Entrada do cache (vale até o fim do programa)
+};
+
+#endif // POLIGONO_HPP
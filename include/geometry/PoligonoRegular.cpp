@@ -0,0 +1,178 @@
+#include "PoligonoRegular.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+// Define M_PI caso não esteja definido
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// ========== Cache de Tesselações ==========
+
+static std::unordered_map<uint64_t, std::vector<float>>& cacheTesselacoes() {
+    static std::unordered_map<uint64_t, std::vector<float>> cache;
+    return cache;
+}
+
+const std::vector<float>& PoligonoRegular::tesselacaoUnitaria(int lados, float razaoInterna) {
+    // Chave: lados nos 32 bits altos, bits da razão nos baixos
+    uint32_t bitsRazao;
+    std::memcpy(&bitsRazao, &razaoInterna, sizeof(bitsRazao));
+    uint64_t chave = (static_cast<uint64_t>(static_cast<uint32_t>(lados)) << 32) | bitsRazao;
+
+    auto& cache = cacheTesselacoes();
+    auto existente = cache.find(chave);
+    if (existente != cache.end()) {
+        return existente->second;
+    }
+
+    // Estrela: pontos externos (raio 1) e internos (razão) alternados
+    bool estrela = razaoInterna < 1.0f;
+    int pontos = estrela ? 2 * lados : lados;
+    std::vector<float> leque;
+    leque.reserve((pontos + 2) * 2);
+
+    // Centro do leque
+    leque.push_back(0.0f);
+    leque.push_back(0.0f);
+
+    // Borda a partir do topo, no sentido anti-horário; o último ponto
+    // repete o primeiro (índice módulo pontos) para fechar o leque
+    for (int i = 0; i <= pontos; i++) {
+        int indice = i % pontos;
+        float angulo = static_cast<float>(M_PI / 2.0 + 2.0 * M_PI * indice / pontos);
+        float raio = (estrela && (indice % 2 == 1)) ? razaoInterna : 1.0f;
+        leque.push_back(raio * std::cos(angulo));
+        leque.push_back(raio * std::sin(angulo));
+    }
+
+    return cache.emplace(chave, std::move(leque)).first->second;
+}
+
+size_t PoligonoRegular::getNumTesselacoes() {
+    return cacheTesselacoes().size();
+}
+
+// ========== Construtores ==========
+
+PoligonoRegular::PoligonoRegular(int lados, float raio, visual visualizacao)
+    : PoligonoRegular(0.0f, 0.0f, lados, raio, raio, 1.0f, visualizacao)
+{
+}
+
+PoligonoRegular::PoligonoRegular(float x, float y, int lados, float raio, visual visualizacao)
+    : PoligonoRegular(x, y, lados, raio, raio, 1.0f, visualizacao)
+{
+}
+
+PoligonoRegular::PoligonoRegular(float x, float y, int lados, float raioX, float raioY,
+                                 float razaoInterna, visual visualizacao)
+    : Forma(visualizacao),
+      centroX(x),
+      centroY(y),
+      lados(lados < 3 ? 3 : lados),               // Mínimo de 3 lados
+      raioX(raioX),
+      raioY(raioY),
+      razaoInterna(razaoInterna > 0.0f && razaoInterna < 1.0f ? razaoInterna : 1.0f)
+{
+    // Vértices do cache e malha do registro: a trigonometria roda uma vez por formato
+    gerarVertices();
+    inicializarRecursos();
+    setDeslocamento(x, y);
+}
+
+// ========== Implementação dos Métodos Virtuais ==========
+
+void PoligonoRegular::gerarVertices() {
+    // Só cópia: a tesselação unitária já está pronta no cache
+    const std::vector<float>& unitaria = tesselacaoUnitaria(lados, razaoInterna);
+    vertices.assign(unitaria.begin(), unitaria.end());
+
+    // Sem textura o tamanho vai na escala e a malha fica unitária
+    if (!vis.usaTextura()) {
+        setEscala(raioX, raioY);
+        return;
+    }
+
+    // Com textura o tamanho entra nos vértices para as UVs terem densidade fixa
+    for (size_t i = 0; i < vertices.size(); i += 2) {
+        vertices[i] *= raioX;
+        vertices[i + 1] *= raioY;
+    }
+    setEscala(1.0f, 1.0f);
+    aplicarUVs(-raioX, -raioY);
+}
+
+void PoligonoRegular::descreverMalha(ChaveMalha& chave) const {
+    // Estrela e polígono de mesmos lados têm malhas diferentes
+    chave.tipo = razaoInterna < 1.0f ? TipoMalha::estrela : TipoMalha::poligonoRegular;
+    chave.parametros.push_back(static_cast<float>(lados));
+    chave.parametros.push_back(razaoInterna);
+    if (vis.usaTextura()) {
+        chave.parametros.push_back(raioX);
+        chave.parametros.push_back(raioY);
+    }
+}
+
+bool PoligonoRegular::contornoConvexo(PoligonoConvexo& saida) const {
+    if (razaoInterna < 1.0f || pontosBorda() > 64) return false;
+
+    // Borda do leque unitário (sem o centro e sem o ponto repetido no fim)
+    const std::vector<float>& unitaria = tesselacaoUnitaria(lados, razaoInterna);
+    float borda[2 * 64];
+    float sx = vis.usaTextura() ? raioX : 1.0f;   // com textura o tamanho não está na escala
+    float sy = vis.usaTextura() ? raioY : 1.0f;
+    for (int i = 0; i < pontosBorda(); i++) {
+        borda[i * 2] = unitaria[2 + i * 2] * sx;
+        borda[i * 2 + 1] = unitaria[3 + i * 2] * sy;
+    }
+    return transformarContorno(borda, static_cast<size_t>(pontosBorda()), saida);
+}
+
+// ========== Métodos de Transformação ==========
+
+void PoligonoRegular::aplicarTamanho() {
+    if (vis.usaTextura()) {
+        // O tamanho está nos vértices: regenera e troca a malha
+        gerarVertices();
+        atualizarMalha();
+    } else {
+        // Malha unitária: basta a escala
+        setEscala(raioX, raioY);
+    }
+}
+
+void PoligonoRegular::setRaio(float novoRaio) {
+    // Valida que o raio seja positivo
+    if (novoRaio <= 0.0f) {
+        std::cerr << "AVISO: Raio deve ser positivo. Usando valor absoluto." << std::endl;
+        novoRaio = std::abs(novoRaio);
+    }
+    raioX = novoRaio;
+    raioY = novoRaio;
+    aplicarTamanho();
+}
+
+void PoligonoRegular::setLados(int novosLados) {
+    // Valida o número mínimo de lados
+    if (novosLados < 3) {
+        std::cerr << "AVISO: Número mínimo de lados é 3. Ajustando..." << std::endl;
+        novosLados = 3;
+    }
+    lados = novosLados;
+
+    // Outro formato: outra tesselação e outra malha
+    gerarVertices();
+    atualizarMalha();
+}
+
+void PoligonoRegular::reposicionar(float x, float y) {
+    // Atualiza a posição do centro
+    centroX = x;
+    centroY = y;
+
+    // Os vértices são locais: só o deslocamento do próximo desenho muda
+    setDeslocamento(x, y);
+}
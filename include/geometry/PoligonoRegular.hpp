@@ -0,0 +1,156 @@
+#ifndef POLIGONO_REGULAR_HPP
+#define POLIGONO_REGULAR_HPP
+
+#include "Forma.hpp"
+#include <vector>
+
+/**
+ * @class PoligonoRegular
+ * @brief Polígono regular de N lados (pentágono, hexágono, losango...)
+ *
+ * Base da família de formas com malha unitária: a tesselação de raio 1 é
+ * gerada uma vez por (lados, razão interna) e guardada em cache; cada
+ * instância só copia os vértices prontos (sem trigonometria) e o raio vai
+ * como escala no uniform u_escalaRotacao. Mil hexágonos de tamanhos
+ * diferentes dividem um único VBO do RegistroMalhas.
+ *
+ * Características:
+ * - Leque a partir do centro: lados + 2 vértices, GL_TRIANGLE_FAN
+ * - Primeiro vértice para cima (pentágono "em pé", 4 lados = losango)
+ * - Derivadas: Estrela (raios alternados) e Elipse (raios x e y diferentes)
+ *
+ * Com textura o tamanho entra na malha (escala 1): a densidade da textura
+ * fica igual à das outras formas, ao custo de uma malha por tamanho.
+ */
+class PoligonoRegular : public Forma {
+public:
+    // ========== Construtores ==========
+
+    /**
+     * @brief Polígono centralizado na origem
+     *
+     * @param lados - Número de lados (mínimo: 3)
+     * @param raio - Distância do centro aos vértices
+     * @param visualizacao - Objeto visual que define cor e aparência
+     */
+    PoligonoRegular(int lados, float raio, visual visualizacao = visual());
+
+    /**
+     * @brief Polígono em uma posição específica
+     *
+     * @param x - Coordenada x do centro
+     * @param y - Coordenada y do centro
+     * @param lados - Número de lados (mínimo: 3)
+     * @param raio - Distância do centro aos vértices
+     * @param visualizacao - Objeto visual que define cor e aparência
+     */
+    PoligonoRegular(float x, float y, int lados, float raio, visual visualizacao = visual());
+
+    ~PoligonoRegular() override = default;
+
+    // ========== Implementação dos Métodos Virtuais Puros ==========
+
+    /**
+     * @brief Copia a tesselação unitária do cache (e aplica o tamanho com textura)
+     */
+    void gerarVertices() override;
+
+    /**
+     * @brief Modo de desenho: leque a partir do centro
+     * @return GLenum - GL_TRIANGLE_FAN
+     */
+    GLenum getModoDesenho() const override { return GL_TRIANGLE_FAN; }
+
+    /**
+     * @brief Centro + pontos da borda + o primeiro ponto repetido
+     * @return int - pontosBorda() + 2
+     */
+    int getNumeroVertices() const override { return pontosBorda() + 2; }
+
+    // ========== Métodos de Transformação ==========
+
+    /**
+     * @brief Define o raio (os dois raios, em Elipse)
+     *
+     * Sem textura só muda a escala: nenhum vértice é gerado ou enviado.
+     */
+    void setRaio(float novoRaio);
+
+    /**
+     * @brief Define o número de lados (troca de malha)
+     * @param novosLados - Mínimo: 3
+     */
+    void setLados(int novosLados);
+
+    /**
+     * @brief Move o polígono (só o uniform de deslocamento)
+     */
+    void setPosicao(float x, float y) { reposicionar(x, y); }
+
+    /**
+     * @brief Move o polígono sem chamar OpenGL (pode rodar em threads de trabalho)
+     */
+    void reposicionar(float x, float y);
+
+    int getLados() const { return lados; }
+    float getRaioX() const { return raioX; }
+    float getRaioY() const { return raioY; }
+
+    void getPosicao(float& outX, float& outY) const {
+        outX = centroX;
+        outY = centroY;
+    }
+
+    /**
+     * @brief Os pontos da borda no mundo
+     * @return bool - false na estrela (côncava) e acima de 64 pontos (use um círculo)
+     */
+    bool contornoConvexo(PoligonoConvexo& saida) const override;
+
+    // ========== Cache de Tesselações ==========
+
+    /**
+     * @brief Leque unitário de (lados, razão interna), gerado na primeira chamada
+     *
+     * @param lados - Pontos externos da borda
+     * @param razaoInterna - Raio dos pontos internos (estrela); 1 = sem pontos internos
+     * @return const std::vector<float>& - (x, y) por vértice; a referência vale
+     *         enquanto o programa rodar
+     *
+     * Só a thread do contexto constrói formas, então o cache não tem trava.
+     */
+    static const std::vector<float>& tesselacaoUnitaria(int lados, float razaoInterna);
+
+    /// Quantas tesselações diferentes já foram geradas
+    static size_t getNumTesselacoes();
+
+protected:
+    /**
+     * @brief Construtor da família: dois raios e razão interna
+     *
+     * Usado por Estrela (razaoInterna < 1) e Elipse (raioX != raioY).
+     */
+    PoligonoRegular(float x, float y, int lados, float raioX, float raioY, float razaoInterna,
+                    visual visualizacao);
+
+    /**
+     * @brief Lados e razão interna (mais o tamanho, com textura)
+     * @param chave - Chave da malha a preencher
+     */
+    void descreverMalha(ChaveMalha& chave) const override;
+
+    /// Pontos na borda: lados, ou o dobro na estrela
+    int pontosBorda() const { return razaoInterna < 1.0f ? 2 * lados : lados; }
+
+    /// Ajusta a escala (sem textura) ou regenera a malha (com textura)
+    void aplicarTamanho();
+
+    float centroX;        ///< Coordenada x do centro
+    float centroY;        ///< Coordenada y do centro
+    int lados;            ///< Lados (pontas, na estrela)
+    float raioX;          ///< Raio horizontal
+    float raioY;          ///< Raio vertical
+    float razaoInterna;   ///< Raio dos pontos internos / raio externo (1 = polígono)
+};
+
+#endif // POLIGONO_REGULAR_HPP
@@ -3,7 +3,7 @@
 // ========== Construtores ==========
 
 Quadrado::Quadrado(visual visualizacao) 
-    : Forma(visualizacao), centroX(0.0f), centroY(0.0f), lado(1.0f)
+    : Forma(visualizacao), centroX(0.0f), centroY(0.0f), lado(1.0f), raioCanto(0.0f)
 {
     // Cria um quadrado padrão centralizado na origem
     // com lado = 1.0 (de -0.5 a 0.5 em ambos os eixos)
@@ -12,7 +12,7 @@ Quadrado::Quadrado(visual visualizacao)
 }
 
 Quadrado::Quadrado(float lado, visual visualizacao) 
-    : Forma(visualizacao), centroX(0.0f), centroY(0.0f), lado(lado)
+    : Forma(visualizacao), centroX(0.0f), centroY(0.0f), lado(lado), raioCanto(0.0f)
 {
     // Cria um quadrado centralizado com tamanho customizado
     gerarVertices();
@@ -20,30 +20,37 @@ Quadrado::Quadrado(float lado, visual visualizacao)
 }
 
 Quadrado::Quadrado(float x, float y, float lado, visual visualizacao) 
-    : Forma(visualizacao), centroX(x), centroY(y), lado(lado)
+    : Forma(visualizacao), centroX(x), centroY(y), lado(lado), raioCanto(0.0f)
 {
     // Cria um quadrado em posição e tamanho customizados
     gerarVertices();
     inicializarRecursos();
+    setDeslocamento(x, y);
 }
 
 // ========== Implementação dos Métodos Virtuais ==========
 
 void Quadrado::gerarVertices() {
+    // No modo SDF basta um quad com os parâmetros da caixa
+    if (vis.usaSDF()) {
+        gerarQuadSDF(lado / 2.0f, lado / 2.0f, raioCanto);
+        return;
+    }
+    
     // Limpa vértices anteriores
     vertices.clear();
     
-    // Reserva espaço para 6 vértices × 2 coordenadas = 12 floats
-    vertices.reserve(12);
+    // Reserva espaço para 6 vértices (2 coordenadas, ou 5 com textura)
+    vertices.reserve(6 * getComponentesPorVertice());
     
     // Calcula a metade do lado para posicionar os cantos
     float meiLado = lado / 2.0f;
     
-    // Calcula as coordenadas dos 4 cantos do quadrado
-    float esquerda = centroX - meiLado;  // x mínimo
-    float direita = centroX + meiLado;   // x máximo
-    float baixo = centroY - meiLado;     // y mínimo
-    float cima = centroY + meiLado;      // y máximo
+    // Calcula as coordenadas locais dos 4 cantos do quadrado
+    float esquerda = -meiLado;  // x mínimo
+    float direita = meiLado;    // x máximo
+    float baixo = -meiLado;     // y mínimo
+    float cima = meiLado;       // y máximo
     
     // ===== PRIMEIRO TRIÂNGULO (inferior direito) =====
     // Vértice 1: canto inferior esquerdo
@@ -70,6 +77,24 @@ void Quadrado::gerarVertices() {
     // Vértice 4: canto superior esquerdo
     vertices.push_back(esquerda);
     vertices.push_back(cima);
+    
+    // Coordenadas de textura a partir do canto inferior esquerdo
+    aplicarUVs(esquerda, baixo);
+}
+
+void Quadrado::descreverMalha(ChaveMalha& chave) const {
+    // O raio do canto só existe nos vértices do modo SDF
+    chave.tipo = TipoMalha::quadrado;
+    chave.parametros.push_back(lado);
+    if (vis.usaSDF()) {
+        chave.parametros.push_back(raioCanto);
+    }
+}
+
+bool Quadrado::contornoConvexo(PoligonoConvexo& saida) const {
+    float m = lado / 2.0f;
+    const float cantos[8] = { -m, -m, m, -m, m, m, -m, m };
+    return transformarContorno(cantos, 4, saida);
 }
 
 // ========== Métodos de Transformação ==========
@@ -81,31 +106,31 @@ void Quadrado::setTamanho(float novoLado) {
     // Regenera os vértices com o novo tamanho
     gerarVertices();
     
-    // Atualiza o buffer na GPU
-    atualizarBuffer();
+    // Troca a malha na GPU
+    atualizarMalha();
 }
 
-void Quadrado::setPosicao(float x, float y) {
-    // Atualiza a posição do centro
-    centroX = x;
-    centroY = y;
+void Quadrado::setRaioCanto(float novoRaio) {
+    // Atualiza o raio dos cantos (gerarQuadSDF limita ao tamanho da forma)
+    raioCanto = novoRaio;
     
-    // Regenera os vértices na nova posição
+    // Regenera os vértices (o raio viaja junto com cada vértice)
     gerarVertices();
     
-    // Atualiza o buffer na GPU
-    atualizarBuffer();
+    // Troca a malha na GPU
+    atualizarMalha();
+}
+
+void Quadrado::setPosicao(float x, float y) {
+    // A posição vai no uniform: nada a reenviar
+    reposicionar(x, y);
 }
 
-void Quadrado::atualizarBuffer() {
-    // Vincula o VBO desta forma
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    
-    // Envia os novos dados de vértices para a GPU
-    // GL_STATIC_DRAW ainda é apropriado mesmo para dados que mudam ocasionalmente
-    // Use GL_DYNAMIC_DRAW se as transformações forem muito frequentes
-    glBufferData(GL_ARRAY_BUFFER, 
-                 vertices.size() * sizeof(float), 
-                 vertices.data(), 
-                 GL_STATIC_DRAW);
+void Quadrado::reposicionar(float x, float y) {
+    // Atualiza a posição do centro
+    centroX = x;
+    centroY = y;
+    
+    // Os vértices são locais: só o deslocamento do próximo desenho muda
+    setDeslocamento(x, y);
 }
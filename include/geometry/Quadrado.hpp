@@ -26,6 +26,10 @@
  * 
  * Triângulo 1: v1, v2, v3
  * Triângulo 2: v1, v3, v4
+ * 
+ * Modo SDF (visual::ativarSDF):
+ * - Um único quad (4 vértices, GL_TRIANGLE_STRIP)
+ * - Cantos arredondados opcionais (setRaioCanto) e contorno suavizado
  */
 class Quadrado : public Forma {
 public:
@@ -85,14 +89,35 @@ public:
      * 
      * O quadrado é desenhado como 2 triângulos adjacentes.
      */
-    GLenum getModoDesenho() const override { return GL_TRIANGLES; }
+    GLenum getModoDesenho() const override { return vis.usaSDF() ? GL_TRIANGLE_STRIP : GL_TRIANGLES; }
     
     /**
      * @brief Retorna o número de vértices do quadrado
      * 
-     * @return int - 6 (2 triângulos × 3 vértices cada)
+     * @return int - 6 (2 triângulos × 3 vértices cada), ou 4 no modo SDF
+     */
+    int getNumeroVertices() const override { return vis.usaSDF() ? 4 : 6; }
+    
+    /**
+     * @brief O quadrado pode ser desenhado como um quad SDF
+     * @return bool - true
+     */
+    bool suportaSDF() const override { return true; }
+    
+    /**
+     * @brief Os 4 cantos no mundo, com a rotação atual
+     * @return bool - true (no modo SDF o canto arredondado vira canto vivo)
+     */
+    bool contornoConvexo(PoligonoConvexo& saida) const override;
+    
+protected:
+    /**
+     * @brief Lado (mais o raio do canto no modo SDF)
+     * @param chave - Chave da malha a preencher
      */
-    int getNumeroVertices() const override { return 6; }
+    void descreverMalha(ChaveMalha& chave) const override;
+
+public:
 
     // ========== Métodos de Transformação ==========
     
@@ -105,16 +130,42 @@ public:
      */
     void setTamanho(float novoLado);
     
+    /**
+     * @brief Define o raio dos cantos arredondados
+     * 
+     * @param novoRaio - Raio dos cantos (limitado à metade da menor dimensão)
+     * 
+     * Só tem efeito no modo SDF; no modo de triângulos os cantos continuam retos.
+     */
+    void setRaioCanto(float novoRaio);
+    
+    /**
+     * @brief Obtém o raio dos cantos arredondados
+     * @return float - Raio atual dos cantos
+     */
+    float getRaioCanto() const { return raioCanto; }
+    
     /**
      * @brief Define a posição do centro do quadrado
      * 
      * @param x - Nova coordenada x do centro
      * @param y - Nova coordenada y do centro
      * 
-     * Move o quadrado para uma nova posição e regenera os vértices.
+     * Move o quadrado para uma nova posição (os vértices não mudam).
      */
     void setPosicao(float x, float y);
     
+    /**
+     * @brief Move o quadrado sem chamar OpenGL
+     * 
+     * @param x - Nova coordenada x do centro
+     * @param y - Nova coordenada y do centro
+     * 
+     * Só guarda a posição, enviada como uniform no próximo desenho. Pode ser
+     * chamado de threads de trabalho (cada forma só toca na própria posição).
+     */
+    void reposicionar(float x, float y);
+    
     /**
      * @brief Obtém o tamanho do lado do quadrado
      * @return float - Comprimento do lado
@@ -135,14 +186,7 @@ private:
     float centroX;  ///< Coordenada x do centro do quadrado
     float centroY;  ///< Coordenada y do centro do quadrado
     float lado;     ///< Comprimento do lado do quadrado
-    
-    /**
-     * @brief Atualiza o buffer de vértices na GPU
-     * 
-     * Deve ser chamado após modificar os vértices para
-     * refletir as mudanças na renderização.
-     */
-    void atualizarBuffer();
+    float raioCanto; ///< Raio dos cantos arredondados (apenas no modo SDF)
 };
 
 #endif // QUADRADO_HPP
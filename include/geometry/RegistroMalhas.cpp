@@ -0,0 +1,179 @@
+#include "RegistroMalhas.hpp"
+#include <cstring>
+
+// ========== Chave ==========
+
+bool ChaveMalha::operator==(const ChaveMalha& outra) const {
+    // Bit a bit: a mesma comparação que o hash usa
+    return tipo == outra.tipo && componentes == outra.componentes &&
+           parametros.size() == outra.parametros.size() &&
+           (parametros.empty() ||
+            std::memcmp(parametros.data(), outra.parametros.data(), parametros.size() * sizeof(float)) == 0);
+}
+
+size_t RegistroMalhas::HashChave::operator()(const ChaveMalha& chave) const {
+    // FNV-1a de 64 bits sobre tipo, componentes e os bits de cada parâmetro
+    uint64_t hash = 1469598103934665603ull;
+    auto misturar = [&hash](uint32_t valor) {
+        for (int i = 0; i < 4; i++) {
+            hash ^= (valor >> (8 * i)) & 0xFFu;
+            hash *= 1099511628211ull;
+        }
+    };
+    misturar(static_cast<uint32_t>(chave.tipo) << 8 | chave.componentes);
+    for (float p : chave.parametros) {
+        uint32_t bits;
+        std::memcpy(&bits, &p, sizeof(bits));
+        misturar(bits);
+    }
+    return static_cast<size_t>(hash);
+}
+
+// ========== Acesso ==========
+
+RegistroMalhas& RegistroMalhas::instancia() {
+    static RegistroMalhas registro;
+    return registro;
+}
+
+// ========== Atributos ==========
+
+void RegistroMalhas::configurarAtributos(int componentes) {
+    // Distância entre vértices consecutivos (2 floats, ou 5 com textura/SDF)
+    GLsizei stride = componentes * sizeof(float);
+
+    // location 0: posição local (x, y), deslocada pelo uniform no vertex shader
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+    glEnableVertexAttribArray(0);
+
+    // location 1: (u, v, camada) com textura ou (meia largura, meia altura, raio) no SDF
+    if (componentes == 5) {
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (void*)(2 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+    }
+}
+
+// ========== Formatos ==========
+
+RegistroMalhas::FormatoVertices& RegistroMalhas::formato(int componentes) {
+    auto existente = formatos.find(componentes);
+    if (existente != formatos.end()) return existente->second;
+
+    // Primeiro uso do formato: um VAO e um VBO para todas as malhas dele
+    FormatoVertices& novo = formatos[componentes];
+    novo.componentes = componentes;
+    glGenVertexArrays(1, &novo.VAO);
+    estatisticas.formatos++;
+    crescer(novo, VERTICES_INICIAIS);
+    return novo;
+}
+
+void RegistroMalhas::crescer(FormatoVertices& formato, uint32_t verticesMinimos) {
+    uint32_t antiga = formato.faixas.getCapacidade();
+    uint32_t nova = antiga ? antiga : VERTICES_INICIAIS;
+    while (nova < verticesMinimos) nova *= 2;
+    GLsizeiptr stride = formato.componentes * sizeof(float);
+
+    // VBO maior com o conteúdo do antigo: as faixas continuam nos mesmos offsets
+    GLuint vbo;
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glBufferData(GL_ARRAY_BUFFER, nova * stride, nullptr, GL_STATIC_DRAW);
+    if (formato.VBO) {
+        glBindBuffer(GL_COPY_READ_BUFFER, formato.VBO);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_ARRAY_BUFFER, 0, 0, antiga * stride);
+        glDeleteBuffers(1, &formato.VBO);
+        estatisticas.crescimentos++;
+    }
+    formato.VBO = vbo;
+
+    // O VAO passa a apontar para o VBO novo (o ID do VAO não muda)
+    glBindVertexArray(formato.VAO);
+    configurarAtributos(formato.componentes);
+    glBindVertexArray(0);
+
+    formato.faixas.crescer(nova);
+    estatisticas.bytesReservados += static_cast<size_t>(nova - antiga) * stride;
+}
+
+GLuint RegistroMalhas::getVBO(int componentes) const {
+    auto existente = formatos.find(componentes);
+    return existente != formatos.end() ? existente->second.VBO : 0;
+}
+
+// ========== Malhas ==========
+
+const MalhaGPU* RegistroMalhas::adquirir(const ChaveMalha& chave, const std::vector<float>& vertices) {
+    size_t bytes = vertices.size() * sizeof(float);
+    auto existente = malhas.find(chave);
+    if (existente != malhas.end()) {
+        MalhaGPU& malha = existente->second;
+        malha.referencias++;
+        estatisticas.referencias++;
+        estatisticas.bytesSemRegistro += malha.bytes;
+        estatisticas.acertos++;
+        return &malha;
+    }
+
+    MalhaGPU malha;
+    malha.numVertices = static_cast<GLsizei>(vertices.size() / chave.componentes);
+    malha.bytes = bytes;
+    malha.referencias = 1;
+
+    // Faixa no VBO do formato; sem espaço, o VBO cresce e a busca se repete
+    FormatoVertices& destino = formato(chave.componentes);
+    uint32_t numVertices = static_cast<uint32_t>(malha.numVertices);
+    malha.faixa = destino.faixas.alocar(numVertices);
+    if (!malha.faixa.valida()) {
+        crescer(destino, destino.faixas.getCapacidade() + numVertices);
+        malha.faixa = destino.faixas.alocar(numVertices);
+    }
+    malha.VAO = destino.VAO;
+    malha.primeiro = static_cast<GLint>(malha.faixa.offset);
+
+    // Os vértices são enviados uma única vez, no trecho da faixa
+    glBindBuffer(GL_ARRAY_BUFFER, destino.VBO);
+    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(malha.faixa.offset) * chave.componentes * sizeof(float),
+                    static_cast<GLsizeiptr>(bytes), vertices.data());
+
+    estatisticas.malhas++;
+    estatisticas.referencias++;
+    estatisticas.bytesGPU += bytes;
+    estatisticas.bytesSemRegistro += bytes;
+    estatisticas.criadas++;
+    return &malhas.emplace(chave, malha).first->second;
+}
+
+void RegistroMalhas::liberar(const ChaveMalha& chave) {
+    auto existente = malhas.find(chave);
+    if (existente == malhas.end()) return;
+
+    MalhaGPU& malha = existente->second;
+    estatisticas.referencias--;
+    estatisticas.bytesSemRegistro -= malha.bytes;
+    if (--malha.referencias > 0) return;
+
+    // A faixa volta ao formato; VAO e VBO ficam para as próximas malhas
+    formato(chave.componentes).faixas.liberar(malha.faixa);
+    estatisticas.malhas--;
+    estatisticas.bytesGPU -= malha.bytes;
+    malhas.erase(existente);
+}
+
+// ========== Relatório ==========
+
+void RegistroMalhas::relatorio(std::ostream& saida) const {
+    const EstatisticasMalhas& e = estatisticas;
+    saida << "Malhas: " << e.malhas << " distintas para " << e.referencias << " formas, "
+          << e.bytesGPU << " bytes na GPU (" << e.bytesSemRegistro << " com um VBO por forma, "
+          << e.bytesEconomizados() << " economizados; " << e.acertos << " reaproveitadas, "
+          << e.criadas << " criadas)" << std::endl;
+    for (const auto& par : formatos) {
+        const FormatoVertices& f = par.second;
+        saida << "  formato de " << f.componentes << " floats: " << f.faixas.getUsado() << " de "
+              << f.faixas.getCapacidade() << " vértices em " << f.faixas.getNumFaixas() << " faixas, "
+              << f.faixas.getNumLivres() << " trecho(s) livre(s), 1 VAO e 1 VBO" << std::endl;
+    }
+    saida << "  " << e.formatos << " VAO(s) e VBO(s) no lugar de " << e.malhas << ", "
+          << e.bytesReservados << " bytes reservados, " << e.crescimentos << " crescimento(s)" << std::endl;
+}
@@ -0,0 +1,154 @@
+#ifndef REGISTRO_MALHAS_HPP
+#define REGISTRO_MALHAS_HPP
+
+#include <GL/glew.h>
+#include "../core/AlocadorFaixas.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+/// Tipo da forma dona da malha (primeira parte da chave)
+enum class TipoMalha : uint8_t {
+    triangulo = 0,
+    quadrado,
+    retangulo,
+    circulo,
+    poligonoRegular,   ///< Também Elipse (polígono unitário escalado)
+    estrela,
+    poligono           ///< Contorno qualquer (id do CacheTriangulacoes)
+};
+
+/**
+ * @struct ChaveMalha
+ * @brief Tudo o que determina os vértices de uma malha em espaço local
+ *
+ * A posição não entra: as formas geram os vértices em torno da origem e o
+ * deslocamento vai em um uniform. Os parâmetros são comparados bit a bit
+ * (0.3f e 0.3f iguais, -0.0f e 0.0f diferentes), então duas formas só
+ * compartilham a malha se gerariam exatamente os mesmos floats.
+ */
+struct ChaveMalha {
+    TipoMalha tipo = TipoMalha::triangulo;
+    uint8_t componentes = 2;          ///< Floats por vértice (2, ou 5 com textura/SDF): define os atributos
+    std::vector<float> parametros;    ///< Tamanhos, segmentos, raio do canto, camada da textura...
+
+    bool operator==(const ChaveMalha& outra) const;
+};
+
+/**
+ * @struct MalhaGPU
+ * @brief Faixa de uma malha compartilhada dentro do VBO do seu formato
+ *
+ * O VAO é o do formato (um para todas as malhas de mesmos componentes);
+ * desenhar é glDrawArrays(modo, primeiro, numVertices) com ele ligado.
+ */
+struct MalhaGPU {
+    GLuint VAO = 0;                   ///< VAO do formato de vértice
+    GLint primeiro = 0;               ///< Primeiro vértice no VBO do formato
+    GLsizei numVertices = 0;
+    size_t bytes = 0;                 ///< Tamanho da faixa
+    int referencias = 0;              ///< Formas usando esta malha
+    AlocadorFaixas::Faixa faixa;      ///< Para devolver ao formato
+};
+
+/// Uso de memória das malhas: quanto a GPU guarda e quanto guardaria sem o registro
+struct EstatisticasMalhas {
+    size_t malhas = 0;                ///< Malhas distintas na GPU
+    size_t referencias = 0;           ///< Formas com malha (soma das referências)
+    size_t bytesGPU = 0;              ///< Soma das faixas ocupadas
+    size_t bytesSemRegistro = 0;      ///< Um VBO por forma, como antes do registro
+    size_t acertos = 0;               ///< adquirir() que reaproveitou uma malha
+    size_t criadas = 0;               ///< adquirir() que enviou uma malha nova
+    size_t formatos = 0;              ///< VAOs/VBOs existentes (um por formato de vértice)
+    size_t bytesReservados = 0;       ///< Capacidade dos VBOs dos formatos
+    size_t crescimentos = 0;          ///< VBOs de formato realocados por falta de espaço
+
+    size_t bytesEconomizados() const { return bytesSemRegistro - bytesGPU; }
+};
+
+/**
+ * @class RegistroMalhas
+ * @brief Malhas de formas idênticas enviadas uma vez e compartilhadas
+ *
+ * Dois Quadrado(0.3f) ou dois Circulo(0.2f, 48) geram os mesmos vértices
+ * locais; o registro entrega às duas formas a mesma malha e conta as
+ * referências. A malha é liberada quando a última forma a libera.
+ *
+ * As malhas não têm VAO/VBO próprios: cada formato de vértice (2 ou 5
+ * componentes) tem um VBO grande e um VAO, e a malha é só uma faixa dele,
+ * escolhida por um AlocadorFaixas (TLSF). Sem o VBO cheio, criar e apagar
+ * malhas não cria nem apaga objetos OpenGL; cheio, o VBO dobra e o
+ * conteúdo é copiado na GPU (glCopyBufferSubData), sem mudar as faixas.
+ * Como todas as malhas de um formato estão no mesmo VAO, uma sequência de
+ * formas pode ser desenhada sem trocá-lo (e, mais à frente, em uma única
+ * chamada multi-draw).
+ *
+ * @code
+ * const MalhaGPU* malha = RegistroMalhas::instancia().adquirir(chave, vertices);
+ * // ... glBindVertexArray(malha->VAO); glDrawArrays(modo, malha->primeiro, malha->numVertices)
+ * RegistroMalhas::instancia().liberar(chave);
+ * @endcode
+ *
+ * Só a thread com o contexto OpenGL ativo usa o registro (as formas o
+ * chamam na construção, nos setters de tamanho e no destrutor).
+ */
+class RegistroMalhas {
+public:
+    /// O registro da aplicação
+    static RegistroMalhas& instancia();
+
+    /**
+     * @brief Malha da chave: a existente (+1 referência) ou uma nova com `vertices`
+     *
+     * @param chave - Descrição da malha (componentes define o layout dos atributos)
+     * @param vertices - Vértices locais, usados só se a malha ainda não existir
+     * @return const MalhaGPU* - Válido até a referência ser liberada
+     */
+    const MalhaGPU* adquirir(const ChaveMalha& chave, const std::vector<float>& vertices);
+
+    /// Devolve uma referência; a última devolve a faixa ao VBO do formato
+    void liberar(const ChaveMalha& chave);
+
+    /// VBO do formato de `componentes` floats por vértice (0 se ainda não existe)
+    GLuint getVBO(int componentes) const;
+
+    EstatisticasMalhas getEstatisticas() const { return estatisticas; }
+
+    /// Malhas, referências e bytes na GPU contra um VBO por forma, e ocupação dos formatos
+    void relatorio(std::ostream& saida) const;
+
+    /**
+     * @brief Layout dos atributos no VAO ligado: posição na location 0 e,
+     *        com 5 componentes, (u, v, camada) ou os parâmetros SDF na location 1
+     */
+    static void configurarAtributos(int componentes);
+
+private:
+    RegistroMalhas() = default;
+
+    struct HashChave {
+        size_t operator()(const ChaveMalha& chave) const;
+    };
+
+    /// VAO + VBO de um formato de vértice e as faixas ocupadas nele
+    struct FormatoVertices {
+        GLuint VAO = 0;
+        GLuint VBO = 0;
+        int componentes = 2;
+        AlocadorFaixas faixas;        ///< Em vértices (o offset é o `primeiro` do glDrawArrays)
+    };
+
+    /// Vértices reservados no primeiro VBO de cada formato
+    static const uint32_t VERTICES_INICIAIS = 4096;
+
+    std::unordered_map<ChaveMalha, MalhaGPU, HashChave> malhas;
+    std::unordered_map<int, FormatoVertices> formatos;
+    EstatisticasMalhas estatisticas;
+
+    FormatoVertices& formato(int componentes);
+    void crescer(FormatoVertices& formato, uint32_t verticesMinimos);
+};
+
+#endif // REGISTRO_MALHAS_HPP
@@ -7,7 +7,8 @@ Retangulo::Retangulo(visual visualizacao)
       centroX(0.0f), 
       centroY(0.0f), 
       largura(1.0f), 
-      altura(0.6f)
+      altura(0.6f),
+      raioCanto(0.0f)
 {
     // Cria um retângulo padrão centralizado na origem
     // com proporção largura:altura = 5:3 (similar ao formato 16:10)
@@ -20,7 +21,8 @@ Retangulo::Retangulo(float largura, float altura, visual visualizacao)
       centroX(0.0f), 
       centroY(0.0f), 
       largura(largura), 
-      altura(altura)
+      altura(altura),
+      raioCanto(0.0f)
 {
     // Cria um retângulo centralizado com dimensões customizadas
     gerarVertices();
@@ -32,31 +34,39 @@ Retangulo::Retangulo(float x, float y, float largura, float altura, visual visua
       centroX(x), 
       centroY(y), 
       largura(largura), 
-      altura(altura)
+      altura(altura),
+      raioCanto(0.0f)
 {
     // Cria um retângulo em posição e dimensões customizadas
     gerarVertices();
     inicializarRecursos();
+    setDeslocamento(x, y);
 }
 
 // ========== Implementação dos Métodos Virtuais ==========
 
 void Retangulo::gerarVertices() {
+    // No modo SDF basta um quad com os parâmetros da caixa
+    if (vis.usaSDF()) {
+        gerarQuadSDF(largura / 2.0f, altura / 2.0f, raioCanto);
+        return;
+    }
+    
     // Limpa vértices anteriores
     vertices.clear();
     
-    // Reserva espaço para 6 vértices × 2 coordenadas = 12 floats
-    vertices.reserve(12);
+    // Reserva espaço para 6 vértices (2 coordenadas, ou 5 com textura)
+    vertices.reserve(6 * getComponentesPorVertice());
     
     // Calcula a metade das dimensões para posicionar os cantos
     float meiaLargura = largura / 2.0f;
     float meiaAltura = altura / 2.0f;
     
-    // Calcula as coordenadas dos 4 cantos do retângulo
-    float esquerda = centroX - meiaLargura;  // x mínimo
-    float direita = centroX + meiaLargura;   // x máximo
-    float baixo = centroY - meiaAltura;      // y mínimo
-    float cima = centroY + meiaAltura;       // y máximo
+    // Calcula as coordenadas locais dos 4 cantos do retângulo
+    float esquerda = -meiaLargura;  // x mínimo
+    float direita = meiaLargura;    // x máximo
+    float baixo = -meiaAltura;      // y mínimo
+    float cima = meiaAltura;        // y máximo
     
     // ===== PRIMEIRO TRIÂNGULO (inferior direito) =====
     // Vértice 1: canto inferior esquerdo
@@ -83,6 +93,26 @@ void Retangulo::gerarVertices() {
     // Vértice 4: canto superior esquerdo
     vertices.push_back(esquerda);
     vertices.push_back(cima);
+    
+    // Coordenadas de textura a partir do canto inferior esquerdo
+    aplicarUVs(esquerda, baixo);
+}
+
+void Retangulo::descreverMalha(ChaveMalha& chave) const {
+    // O raio do canto só existe nos vértices do modo SDF
+    chave.tipo = TipoMalha::retangulo;
+    chave.parametros.push_back(largura);
+    chave.parametros.push_back(altura);
+    if (vis.usaSDF()) {
+        chave.parametros.push_back(raioCanto);
+    }
+}
+
+bool Retangulo::contornoConvexo(PoligonoConvexo& saida) const {
+    float mx = largura / 2.0f;
+    float my = altura / 2.0f;
+    const float cantos[8] = { -mx, -my, mx, -my, mx, my, -mx, my };
+    return transformarContorno(cantos, 4, saida);
 }
 
 // ========== Métodos de Transformação ==========
@@ -95,8 +125,8 @@ void Retangulo::setDimensoes(float novaLargura, float novaAltura) {
     // Regenera os vértices com as novas dimensões
     gerarVertices();
     
-    // Atualiza o buffer na GPU
-    atualizarBuffer();
+    // Troca a malha na GPU
+    atualizarMalha();
 }
 
 void Retangulo::setLargura(float novaLargura) {
@@ -106,8 +136,8 @@ void Retangulo::setLargura(float novaLargura) {
     // Regenera os vértices
     gerarVertices();
     
-    // Atualiza o buffer na GPU
-    atualizarBuffer();
+    // Troca a malha na GPU
+    atualizarMalha();
 }
 
 void Retangulo::setAltura(float novaAltura) {
@@ -117,31 +147,31 @@ void Retangulo::setAltura(float novaAltura) {
     // Regenera os vértices
     gerarVertices();
     
-    // Atualiza o buffer na GPU
-    atualizarBuffer();
+    // Troca a malha na GPU
+    atualizarMalha();
 }
 
-void Retangulo::setPosicao(float x, float y) {
-    // Atualiza a posição do centro
-    centroX = x;
-    centroY = y;
+void Retangulo::setRaioCanto(float novoRaio) {
+    // Atualiza o raio dos cantos (gerarQuadSDF limita ao tamanho da forma)
+    raioCanto = novoRaio;
     
-    // Regenera os vértices na nova posição
+    // Regenera os vértices (o raio viaja junto com cada vértice)
     gerarVertices();
     
-    // Atualiza o buffer na GPU
-    atualizarBuffer();
+    // Troca a malha na GPU
+    atualizarMalha();
+}
+
+void Retangulo::setPosicao(float x, float y) {
+    // A posição vai no uniform: nada a reenviar
+    reposicionar(x, y);
 }
 
-void Retangulo::atualizarBuffer() {
-    // Vincula o VBO desta forma
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    
-    // Envia os novos dados de vértices para a GPU
-    // GL_STATIC_DRAW é apropriado para transformações ocasionais
-    // Use GL_DYNAMIC_DRAW se as transformações forem muito frequentes (animações)
-    glBufferData(GL_ARRAY_BUFFER, 
-                 vertices.size() * sizeof(float), 
-                 vertices.data(), 
-                 GL_STATIC_DRAW);
+void Retangulo::reposicionar(float x, float y) {
+    // Atualiza a posição do centro
+    centroX = x;
+    centroY = y;
+    
+    // Os vértices são locais: só o deslocamento do próximo desenho muda
+    setDeslocamento(x, y);
 }
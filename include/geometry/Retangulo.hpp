@@ -31,6 +31,10 @@
  * 
  * Triângulo 1: v1, v2, v3
  * Triângulo 2: v1, v3, v4
+ * 
+ * Modo SDF (visual::ativarSDF):
+ * - Um único quad (4 vértices, GL_TRIANGLE_STRIP)
+ * - Cantos arredondados opcionais (setRaioCanto) e contorno suavizado
  */
 class Retangulo : public Forma {
 public:
@@ -93,14 +97,35 @@ public:
      * 
      * O retângulo é desenhado como 2 triângulos adjacentes.
      */
-    GLenum getModoDesenho() const override { return GL_TRIANGLES; }
+    GLenum getModoDesenho() const override { return vis.usaSDF() ? GL_TRIANGLE_STRIP : GL_TRIANGLES; }
     
     /**
      * @brief Retorna o número de vértices do retângulo
      * 
-     * @return int - 6 (2 triângulos × 3 vértices cada)
+     * @return int - 6 (2 triângulos × 3 vértices cada), ou 4 no modo SDF
+     */
+    int getNumeroVertices() const override { return vis.usaSDF() ? 4 : 6; }
+    
+    /**
+     * @brief O retângulo pode ser desenhado como um quad SDF
+     * @return bool - true
+     */
+    bool suportaSDF() const override { return true; }
+    
+    /**
+     * @brief Os 4 cantos no mundo, com a rotação atual
+     * @return bool - true (no modo SDF o canto arredondado vira canto vivo)
+     */
+    bool contornoConvexo(PoligonoConvexo& saida) const override;
+    
+protected:
+    /**
+     * @brief Largura e altura (mais o raio do canto no modo SDF)
+     * @param chave - Chave da malha a preencher
      */
-    int getNumeroVertices() const override { return 6; }
+    void descreverMalha(ChaveMalha& chave) const override;
+
+public:
 
     // ========== Métodos de Transformação ==========
     
@@ -128,16 +153,42 @@ public:
      */
     void setAltura(float novaAltura);
     
+    /**
+     * @brief Define o raio dos cantos arredondados
+     * 
+     * @param novoRaio - Raio dos cantos (limitado à metade da menor dimensão)
+     * 
+     * Só tem efeito no modo SDF; no modo de triângulos os cantos continuam retos.
+     */
+    void setRaioCanto(float novoRaio);
+    
+    /**
+     * @brief Obtém o raio dos cantos arredondados
+     * @return float - Raio atual dos cantos
+     */
+    float getRaioCanto() const { return raioCanto; }
+    
     /**
      * @brief Define a posição do centro do retângulo
      * 
      * @param x - Nova coordenada x do centro
      * @param y - Nova coordenada y do centro
      * 
-     * Move o retângulo para uma nova posição e regenera os vértices.
+     * Move o retângulo para uma nova posição (os vértices não mudam).
      */
     void setPosicao(float x, float y);
     
+    /**
+     * @brief Move o retângulo sem chamar OpenGL
+     * 
+     * @param x - Nova coordenada x do centro
+     * @param y - Nova coordenada y do centro
+     * 
+     * Só guarda a posição, enviada como uniform no próximo desenho. Pode ser
+     * chamado de threads de trabalho (cada forma só toca na própria posição).
+     */
+    void reposicionar(float x, float y);
+    
     /**
      * @brief Obtém a largura do retângulo
      * @return float - Largura atual
@@ -177,14 +228,7 @@ private:
     float centroY;   ///< Coordenada y do centro do retângulo
     float largura;   ///< Largura (extensão horizontal) do retângulo
     float altura;    ///< Altura (extensão vertical) do retângulo
-    
-    /**
-     * @brief Atualiza o buffer de vértices na GPU
-     * 
-     * Deve ser chamado após modificar os vértices para
-     * refletir as mudanças na renderização.
-     */
-    void atualizarBuffer();
+    float raioCanto; ///< Raio dos cantos arredondados (apenas no modo SDF)
 };
 
 #endif // RETANGULO_HPP
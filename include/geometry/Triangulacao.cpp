@@ -0,0 +1,929 @@
+#include "Triangulacao.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// ========== Lista Ligada ==========
+
+int32_t Triangulador::inserir(uint32_t indice, double x, double y, int32_t ultimo) {
+    int32_t p = static_cast<int32_t>(nos.size());
+    nos.push_back(No{indice, x, y, 0, p, p, -1, -1});
+    if (ultimo >= 0) {
+        No& novo = nos[p];
+        novo.proximo = nos[ultimo].proximo;
+        novo.anterior = ultimo;
+        nos[nos[ultimo].proximo].anterior = p;
+        nos[ultimo].proximo = p;
+    }
+    return p;
+}
+
+void Triangulador::remover(int32_t p) {
+    No& n = nos[p];
+    nos[n.proximo].anterior = n.anterior;
+    nos[n.anterior].proximo = n.proximo;
+    if (n.anteriorZ >= 0) nos[n.anteriorZ].proximoZ = n.proximoZ;
+    if (n.proximoZ >= 0) nos[n.proximoZ].anteriorZ = n.anteriorZ;
+}
+
+// ========== Predicados Geométricos ==========
+
+double Triangulador::area(int32_t p, int32_t q, int32_t r) const {
+    // Dobro da área com sinal: negativa nos vértices convexos da orientação usada
+    const No& a = nos[p];
+    const No& b = nos[q];
+    const No& c = nos[r];
+    return (b.y - a.y) * (c.x - b.x) - (b.x - a.x) * (c.y - b.y);
+}
+
+bool Triangulador::iguais(int32_t a, int32_t b) const {
+    return nos[a].x == nos[b].x && nos[a].y == nos[b].y;
+}
+
+static bool pontoNoTriangulo(double ax, double ay, double bx, double by, double cx, double cy,
+                             double px, double py) {
+    return (cx - px) * (ay - py) >= (ax - px) * (cy - py) &&
+           (ax - px) * (by - py) >= (bx - px) * (ay - py) &&
+           (bx - px) * (cy - py) >= (cx - px) * (by - py);
+}
+
+static int sinal(double v) {
+    return v > 0.0 ? 1 : (v < 0.0 ? -1 : 0);
+}
+
+bool Triangulador::seCruzam(int32_t p1, int32_t q1, int32_t p2, int32_t q2) const {
+    // q colinear com p e r e dentro da caixa do segmento pr
+    auto noSegmento = [this](int32_t p, int32_t q, int32_t r) {
+        return nos[q].x <= std::max(nos[p].x, nos[r].x) && nos[q].x >= std::min(nos[p].x, nos[r].x) &&
+               nos[q].y <= std::max(nos[p].y, nos[r].y) && nos[q].y >= std::min(nos[p].y, nos[r].y);
+    };
+    int o1 = sinal(area(p1, q1, p2));
+    int o2 = sinal(area(p1, q1, q2));
+    int o3 = sinal(area(p2, q2, p1));
+    int o4 = sinal(area(p2, q2, q1));
+    if (o1 != o2 && o3 != o4) return true;
+    if (o1 == 0 && noSegmento(p1, p2, q1)) return true;
+    if (o2 == 0 && noSegmento(p1, q2, q1)) return true;
+    if (o3 == 0 && noSegmento(p2, p1, q2)) return true;
+    if (o4 == 0 && noSegmento(p2, q1, q2)) return true;
+    return false;
+}
+
+bool Triangulador::cruzaPoligono(int32_t a, int32_t b) const {
+    int32_t p = a;
+    do {
+        int32_t q = nos[p].proximo;
+        if (nos[p].indice != nos[a].indice && nos[q].indice != nos[a].indice &&
+            nos[p].indice != nos[b].indice && nos[q].indice != nos[b].indice && seCruzam(p, q, a, b)) {
+            return true;
+        }
+        p = q;
+    } while (p != a);
+    return false;
+}
+
+bool Triangulador::localmenteDentro(int32_t a, int32_t b) const {
+    const No& n = nos[a];
+    return area(n.anterior, a, n.proximo) < 0.0
+        ? area(a, b, n.proximo) >= 0.0 && area(a, n.anterior, b) >= 0.0
+        : area(a, b, n.anterior) < 0.0 || area(a, n.proximo, b) < 0.0;
+}
+
+bool Triangulador::meioDentro(int32_t a, int32_t b) const {
+    // Paridade de cruzamentos de um raio horizontal saindo do meio da diagonal
+    double px = (nos[a].x + nos[b].x) / 2.0;
+    double py = (nos[a].y + nos[b].y) / 2.0;
+    bool dentro = false;
+    int32_t p = a;
+    do {
+        const No& n = nos[p];
+        const No& m = nos[n.proximo];
+        if (((n.y > py) != (m.y > py)) && m.y != n.y && (px < (m.x - n.x) * (py - n.y) / (m.y - n.y) + n.x)) {
+            dentro = !dentro;
+        }
+        p = n.proximo;
+    } while (p != a);
+    return dentro;
+}
+
+bool Triangulador::diagonalValida(int32_t a, int32_t b) const {
+    const No& na = nos[a];
+    const No& nb = nos[b];
+    if (nos[na.proximo].indice == nb.indice || nos[na.anterior].indice == nb.indice || cruzaPoligono(a, b)) {
+        return false;
+    }
+    bool visivel = localmenteDentro(a, b) && localmenteDentro(b, a) && meioDentro(a, b) &&
+                   (area(na.anterior, a, nb.anterior) != 0.0 || area(a, nb.anterior, b) != 0.0);
+    bool pontoRepetido = iguais(a, b) && area(na.anterior, a, na.proximo) > 0.0 &&
+                         area(nb.anterior, b, nb.proximo) > 0.0;
+    return visivel || pontoRepetido;
+}
+
+// ========== Curva Z ==========
+
+uint32_t Triangulador::codigoZ(double x, double y) const {
+    // Coordenadas em 15 bits dentro da caixa, bits intercalados (Morton)
+    uint32_t ix = static_cast<uint32_t>((x - minX) * escalaZ);
+    uint32_t iy = static_cast<uint32_t>((y - minY) * escalaZ);
+    ix = (ix | (ix << 8)) & 0x00FF00FFu;
+    ix = (ix | (ix << 4)) & 0x0F0F0F0Fu;
+    ix = (ix | (ix << 2)) & 0x33333333u;
+    ix = (ix | (ix << 1)) & 0x55555555u;
+    iy = (iy | (iy << 8)) & 0x00FF00FFu;
+    iy = (iy | (iy << 4)) & 0x0F0F0F0Fu;
+    iy = (iy | (iy << 2)) & 0x33333333u;
+    iy = (iy | (iy << 1)) & 0x55555555u;
+    return ix | (iy << 1);
+}
+
+void Triangulador::indexarCurvaZ(int32_t inicio) {
+    // A lista Z começa como cópia da lista do contorno e é ordenada pelo código
+    int32_t p = inicio;
+    do {
+        No& n = nos[p];
+        if (n.z == 0) n.z = codigoZ(n.x, n.y);
+        n.anteriorZ = n.anterior;
+        n.proximoZ = n.proximo;
+        p = n.proximo;
+    } while (p != inicio);
+    nos[nos[p].anteriorZ].proximoZ = -1;
+    nos[p].anteriorZ = -1;
+    ordenarPorZ(p);
+}
+
+int32_t Triangulador::ordenarPorZ(int32_t lista) {
+    // Merge sort de baixo para cima na lista ligada: O(n log n) sem memória extra
+    int tamanhoBloco = 1;
+    int fusoes;
+    do {
+        int32_t p = lista;
+        lista = -1;
+        int32_t cauda = -1;
+        fusoes = 0;
+        while (p >= 0) {
+            fusoes++;
+            int32_t q = p;
+            int tamanhoP = 0;
+            for (int i = 0; i < tamanhoBloco; i++) {
+                tamanhoP++;
+                q = nos[q].proximoZ;
+                if (q < 0) break;
+            }
+            int tamanhoQ = tamanhoBloco;
+            while (tamanhoP > 0 || (tamanhoQ > 0 && q >= 0)) {
+                int32_t e;
+                if (tamanhoP != 0 && (tamanhoQ == 0 || q < 0 || nos[p].z <= nos[q].z)) {
+                    e = p;
+                    p = nos[p].proximoZ;
+                    tamanhoP--;
+                } else {
+                    e = q;
+                    q = nos[q].proximoZ;
+                    tamanhoQ--;
+                }
+                if (cauda >= 0) nos[cauda].proximoZ = e;
+                else lista = e;
+                nos[e].anteriorZ = cauda;
+                cauda = e;
+            }
+            p = q;
+        }
+        nos[cauda].proximoZ = -1;
+        tamanhoBloco *= 2;
+    } while (fusoes > 1);
+    return lista;
+}
+
+// ========== Orelhas ==========
+
+bool Triangulador::ehOrelha(int32_t orelha) const {
+    int32_t a = nos[orelha].anterior;
+    int32_t c = nos[orelha].proximo;
+    if (area(a, orelha, c) >= 0.0) return false;   // reflexo: não é orelha
+
+    const No& na = nos[a];
+    const No& nb = nos[orelha];
+    const No& nc = nos[c];
+    double x0 = std::min(na.x, std::min(nb.x, nc.x)), y0 = std::min(na.y, std::min(nb.y, nc.y));
+    double x1 = std::max(na.x, std::max(nb.x, nc.x)), y1 = std::max(na.y, std::max(nb.y, nc.y));
+
+    // Nenhum outro vértice reflexo pode estar dentro do triângulo
+    for (int32_t p = nc.proximo; p != a; p = nos[p].proximo) {
+        const No& n = nos[p];
+        if (n.x >= x0 && n.x <= x1 && n.y >= y0 && n.y <= y1 &&
+            pontoNoTriangulo(na.x, na.y, nb.x, nb.y, nc.x, nc.y, n.x, n.y) &&
+            area(n.anterior, p, n.proximo) >= 0.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Triangulador::ehOrelhaZ(int32_t orelha) const {
+    int32_t a = nos[orelha].anterior;
+    int32_t c = nos[orelha].proximo;
+    if (area(a, orelha, c) >= 0.0) return false;
+
+    const No& na = nos[a];
+    const No& nb = nos[orelha];
+    const No& nc = nos[c];
+    double x0 = std::min(na.x, std::min(nb.x, nc.x)), y0 = std::min(na.y, std::min(nb.y, nc.y));
+    double x1 = std::max(na.x, std::max(nb.x, nc.x)), y1 = std::max(na.y, std::max(nb.y, nc.y));
+
+    // Só os vértices com código Z entre os dos cantos da caixa podem estar nela
+    uint32_t zMin = codigoZ(x0, y0);
+    uint32_t zMax = codigoZ(x1, y1);
+    auto bloqueia = [&](int32_t p) {
+        const No& n = nos[p];
+        return p != a && p != c && n.x >= x0 && n.x <= x1 && n.y >= y0 && n.y <= y1 &&
+               pontoNoTriangulo(na.x, na.y, nb.x, nb.y, nc.x, nc.y, n.x, n.y) &&
+               area(n.anterior, p, n.proximo) >= 0.0;
+    };
+
+    // Anda nas duas direções da lista Z ao mesmo tempo
+    int32_t p = nb.anteriorZ;
+    int32_t n = nb.proximoZ;
+    while (p >= 0 && nos[p].z >= zMin && n >= 0 && nos[n].z <= zMax) {
+        if (bloqueia(p)) return false;
+        p = nos[p].anteriorZ;
+        if (bloqueia(n)) return false;
+        n = nos[n].proximoZ;
+    }
+    for (; p >= 0 && nos[p].z >= zMin; p = nos[p].anteriorZ) {
+        if (bloqueia(p)) return false;
+    }
+    for (; n >= 0 && nos[n].z <= zMax; n = nos[n].proximoZ) {
+        if (bloqueia(n)) return false;
+    }
+    return true;
+}
+
+int32_t Triangulador::limparPontos(int32_t inicio, int32_t fim) {
+    // Remove pontos repetidos e colineares (que travariam o corte de orelhas)
+    if (inicio < 0) return inicio;
+    if (fim < 0) fim = inicio;
+    int32_t p = inicio;
+    bool denovo;
+    do {
+        denovo = false;
+        if (iguais(p, nos[p].proximo) || area(nos[p].anterior, p, nos[p].proximo) == 0.0) {
+            remover(p);
+            p = fim = nos[p].anterior;
+            if (p == nos[p].proximo) break;
+            denovo = true;
+        } else {
+            p = nos[p].proximo;
+        }
+    } while (denovo || p != fim);
+    return fim;
+}
+
+void Triangulador::cortarOrelhas(int32_t orelha, int passada) {
+    if (orelha < 0) return;
+    if (passada == 0 && escalaZ != 0.0) indexarCurvaZ(orelha);
+
+    int32_t parada = orelha;
+    while (nos[orelha].anterior != nos[orelha].proximo) {
+        int32_t anterior = nos[orelha].anterior;
+        int32_t proximo = nos[orelha].proximo;
+
+        if (escalaZ != 0.0 ? ehOrelhaZ(orelha) : ehOrelha(orelha)) {
+            saida->push_back(nos[anterior].indice);
+            saida->push_back(nos[orelha].indice);
+            saida->push_back(nos[proximo].indice);
+            remover(orelha);
+
+            // Pular o vizinho dá triângulos menos finos
+            orelha = nos[proximo].proximo;
+            parada = orelha;
+            continue;
+        }
+
+        orelha = proximo;
+
+        // Uma volta inteira sem orelha: tenta limpar, curar ou dividir
+        if (orelha == parada) {
+            if (passada == 0) {
+                cortarOrelhas(limparPontos(orelha), 1);
+            } else if (passada == 1) {
+                cortarOrelhas(curarIntersecoesLocais(limparPontos(orelha)), 2);
+            } else {
+                dividirECortar(orelha);
+            }
+            break;
+        }
+    }
+}
+
+int32_t Triangulador::curarIntersecoesLocais(int32_t inicio) {
+    // a-p-p.proximo-b com a-p e p.proximo-b se cruzando: o triângulo (a, p, b) resolve
+    int32_t p = inicio;
+    do {
+        int32_t a = nos[p].anterior;
+        int32_t b = nos[nos[p].proximo].proximo;
+        if (!iguais(a, b) && seCruzam(a, p, nos[p].proximo, b) && localmenteDentro(a, b) && localmenteDentro(b, a)) {
+            saida->push_back(nos[a].indice);
+            saida->push_back(nos[p].indice);
+            saida->push_back(nos[b].indice);
+            remover(nos[p].proximo);
+            remover(p);
+            p = inicio = b;
+        }
+        p = nos[p].proximo;
+    } while (p != inicio);
+    return limparPontos(p);
+}
+
+int32_t Triangulador::dividirPoligono(int32_t a, int32_t b) {
+    // Liga a e b por uma diagonal: dois anéis, cada um com cópias de a e b
+    int32_t a2 = static_cast<int32_t>(nos.size());
+    nos.push_back(No{nos[a].indice, nos[a].x, nos[a].y, 0, -1, -1, -1, -1});
+    int32_t b2 = static_cast<int32_t>(nos.size());
+    nos.push_back(No{nos[b].indice, nos[b].x, nos[b].y, 0, -1, -1, -1, -1});
+    int32_t an = nos[a].proximo;
+    int32_t bp = nos[b].anterior;
+
+    nos[a].proximo = b;
+    nos[b].anterior = a;
+    nos[a2].proximo = an;
+    nos[an].anterior = a2;
+    nos[a2].anterior = b2;
+    nos[b2].proximo = a2;
+    nos[b2].anterior = bp;
+    nos[bp].proximo = b2;
+    return b2;
+}
+
+void Triangulador::dividirECortar(int32_t inicio) {
+    // Último recurso: procura uma diagonal válida e triangula as duas metades.
+    // Cada teste percorre o anel (O(n)); o orçamento impede a busca de virar O(n³)
+    size_t tamanhoAnel = 0;
+    int32_t p = inicio;
+    do {
+        tamanhoAnel++;
+        p = nos[p].proximo;
+    } while (p != inicio);
+
+    int32_t a = inicio;
+    do {
+        int32_t b = nos[nos[a].proximo].proximo;
+        while (b != nos[a].anterior) {
+            if (orcamentoDivisao < tamanhoAnel) return;   // desiste: o resto fica sem triângulos
+            orcamentoDivisao -= tamanhoAnel;
+            if (nos[a].indice != nos[b].indice && diagonalValida(a, b)) {
+                int32_t c = dividirPoligono(a, b);
+                a = limparPontos(a, nos[a].proximo);
+                c = limparPontos(c, nos[c].proximo);
+                cortarOrelhas(a, 0);
+                cortarOrelhas(c, 0);
+                return;
+            }
+            b = nos[b].proximo;
+        }
+        a = nos[a].proximo;
+    } while (a != inicio);
+}
+
+// ========== Varredura (partes monótonas) ==========
+
+static double giro(double ax, double ay, double bx, double by, double cx, double cy) {
+    // Positivo quando a -> b -> c vira à esquerda
+    return (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
+}
+
+bool Triangulador::acima(int32_t a, int32_t b) const {
+    // Mesma altura: o da esquerda vem antes (a linha de varredura fica levemente inclinada)
+    const Vertice& p = vertices[a];
+    const Vertice& q = vertices[b];
+    return p.y > q.y || (p.y == q.y && p.x < q.x);
+}
+
+bool Triangulador::ehJuncao(int32_t v) const {
+    int32_t m = static_cast<int32_t>(vertices.size());
+    int32_t anterior = (v + m - 1) % m;
+    int32_t proximo = (v + 1) % m;
+    const Vertice& a = vertices[anterior];
+    const Vertice& b = vertices[v];
+    const Vertice& c = vertices[proximo];
+    return acima(anterior, v) && acima(proximo, v) && giro(a.x, a.y, b.x, b.y, c.x, c.y) <= 0.0;
+}
+
+double Triangulador::xNaVarredura(int32_t no, double y) const {
+    const NoStatus& n = status[no];
+    return n.x0 + (y - n.y0) * n.dxdy;
+}
+
+int32_t Triangulador::arestaAEsquerda(int32_t v) const {
+    // A aresta ativa mais à direita que ainda passa à esquerda de v
+    const Vertice& p = vertices[v];
+    int32_t no = raizStatus;
+    int32_t melhor = -1;
+    while (no >= 0) {
+        if (xNaVarredura(no, p.y) < p.x) {
+            melhor = status[no].aresta;
+            no = status[no].direita;
+        } else {
+            no = status[no].esquerda;
+        }
+    }
+    return melhor;
+}
+
+void Triangulador::girarParaCima(int32_t no) {
+    int32_t pai = status[no].pai;
+    int32_t avo = status[pai].pai;
+    if (status[pai].esquerda == no) {
+        int32_t filho = status[no].direita;
+        status[pai].esquerda = filho;
+        if (filho >= 0) status[filho].pai = pai;
+        status[no].direita = pai;
+    } else {
+        int32_t filho = status[no].esquerda;
+        status[pai].direita = filho;
+        if (filho >= 0) status[filho].pai = pai;
+        status[no].esquerda = pai;
+    }
+    status[pai].pai = no;
+    status[no].pai = avo;
+    if (avo < 0) raizStatus = no;
+    else if (status[avo].esquerda == pai) status[avo].esquerda = no;
+    else status[avo].direita = no;
+}
+
+void Triangulador::inserirStatus(int32_t aresta) {
+    // Prioridades de um xorshift: a treap fica balanceada em média, sem alocar
+    sementeStatus ^= sementeStatus << 13;
+    sementeStatus ^= sementeStatus >> 17;
+    sementeStatus ^= sementeStatus << 5;
+    // A reta da aresta vai no nó: descer a árvore não consulta os vértices.
+    // Horizontal: fica na ponta da direita (a última vista na linha inclinada)
+    int32_t m = static_cast<int32_t>(vertices.size());
+    int32_t cima = acima(aresta, (aresta + 1) % m) ? aresta : (aresta + 1) % m;
+    int32_t baixo = cima == aresta ? (aresta + 1) % m : aresta;
+    const Vertice& v = vertices[cima];
+    const Vertice& w = vertices[baixo];
+    int32_t novo = static_cast<int32_t>(status.size());
+    if (v.y == w.y) {
+        status.push_back(NoStatus{-1, -1, -1, sementeStatus, aresta, w.x, w.y, 0.0});
+    } else {
+        status.push_back(NoStatus{-1, -1, -1, sementeStatus, aresta, v.x, v.y, (w.x - v.x) / (w.y - v.y)});
+    }
+    noDaAresta[aresta] = novo;
+
+    // Empate (outra aresta passa pelo vértice de cima) se resolve pelo de baixo
+    int32_t no = raizStatus;
+    int32_t pai = -1;
+    bool aEsquerda = false;
+    while (no >= 0) {
+        pai = no;
+        double x = xNaVarredura(no, v.y);
+        aEsquerda = x > v.x || (x == v.x && xNaVarredura(no, w.y) > w.x);
+        no = aEsquerda ? status[no].esquerda : status[no].direita;
+    }
+    status[novo].pai = pai;
+    if (pai < 0) {
+        raizStatus = novo;
+        return;
+    }
+    if (aEsquerda) status[pai].esquerda = novo;
+    else status[pai].direita = novo;
+    while (status[novo].pai >= 0 && status[status[novo].pai].prioridade < status[novo].prioridade) {
+        girarParaCima(novo);
+    }
+}
+
+bool Triangulador::removerStatus(int32_t aresta) {
+    int32_t no = noDaAresta[aresta];
+    if (no < 0) return false;
+    noDaAresta[aresta] = -1;
+
+    // Desce girando até ter no máximo um filho e sai da árvore
+    while (status[no].esquerda >= 0 && status[no].direita >= 0) {
+        int32_t e = status[no].esquerda;
+        int32_t d = status[no].direita;
+        girarParaCima(status[e].prioridade > status[d].prioridade ? e : d);
+    }
+    int32_t filho = status[no].esquerda >= 0 ? status[no].esquerda : status[no].direita;
+    int32_t pai = status[no].pai;
+    if (filho >= 0) status[filho].pai = pai;
+    if (pai < 0) raizStatus = filho;
+    else if (status[pai].esquerda == no) status[pai].esquerda = filho;
+    else status[pai].direita = filho;
+    return true;
+}
+
+bool Triangulador::fecharAresta(int32_t aresta, int32_t v) {
+    // A aresta termina em v: se o ajudante dela era uma junção, liga v a ele
+    if (noDaAresta[aresta] < 0) return false;
+    if (ehJuncao(ajudante[aresta])) {
+        diagonais.push_back(v);
+        diagonais.push_back(ajudante[aresta]);
+    }
+    return removerStatus(aresta);
+}
+
+bool Triangulador::decomporMonotonos() {
+    // Diagonais que deixam todas as partes y-monótonas (de Berg et al., cap. 3)
+    int32_t m = static_cast<int32_t>(vertices.size());
+    // Coordenadas copiadas para o evento: a ordenação não salta pelos vértices
+    eventos.resize(m);
+    for (int32_t i = 0; i < m; i++) eventos[i] = Evento{ vertices[i].y, vertices[i].x, i };
+    std::sort(eventos.begin(), eventos.end(), [](const Evento& a, const Evento& b) {
+        return a.y > b.y || (a.y == b.y && a.x < b.x);
+    });
+    ajudante.assign(m, -1);
+    noDaAresta.assign(m, -1);
+    status.clear();
+    raizStatus = -1;
+    sementeStatus = 2463534242u;
+    diagonais.clear();
+
+    for (const Evento& evento : eventos) {
+        int32_t v = evento.vertice;
+        int32_t anterior = (v + m - 1) % m;
+        int32_t proximo = (v + 1) % m;
+        const Vertice& a = vertices[anterior];
+        const Vertice& b = vertices[v];
+        const Vertice& c = vertices[proximo];
+        bool anteriorAcima = acima(anterior, v);
+        bool proximoAcima = acima(proximo, v);
+        bool convexo = giro(a.x, a.y, b.x, b.y, c.x, c.y) > 0.0;
+
+        if (!anteriorAcima && !proximoAcima) {
+            if (!convexo) {
+                // Divisão: liga ao ajudante da aresta à esquerda, qualquer que seja
+                int32_t e = arestaAEsquerda(v);
+                if (e < 0) return false;
+                diagonais.push_back(v);
+                diagonais.push_back(ajudante[e]);
+                ajudante[e] = v;
+            }
+            // Início (ou divisão): a aresta que desce de v fica ativa
+            inserirStatus(v);
+            ajudante[v] = v;
+        } else if (anteriorAcima && proximoAcima) {
+            // Fim (ou junção): a aresta que chega em v sai
+            if (!fecharAresta(anterior, v)) return false;
+            if (!convexo) {
+                int32_t e = arestaAEsquerda(v);
+                if (e < 0) return false;
+                if (ehJuncao(ajudante[e])) {
+                    diagonais.push_back(v);
+                    diagonais.push_back(ajudante[e]);
+                }
+                ajudante[e] = v;
+            }
+        } else if (anteriorAcima) {
+            // Cadeia da esquerda (interior à direita): troca a aresta ativa
+            if (!fecharAresta(anterior, v)) return false;
+            inserirStatus(v);
+            ajudante[v] = v;
+        } else {
+            // Cadeia da direita: v vira o ajudante da aresta à esquerda
+            int32_t e = arestaAEsquerda(v);
+            if (e < 0) return false;
+            if (ehJuncao(ajudante[e])) {
+                diagonais.push_back(v);
+                diagonais.push_back(ajudante[e]);
+            }
+            ajudante[e] = v;
+        }
+    }
+    return raizStatus < 0;
+}
+
+int32_t Triangulador::proximaSemiaresta(int32_t semi) const {
+    // Chegando em v por u -> v, a face à esquerda segue pela primeira
+    // semiaresta de v no sentido horário a partir da direção v -> u. As de v
+    // estão em ordem anti-horária a partir da aresta do contorno, e as
+    // diagonais ficam todas dentro do ângulo interno: chegando pelo contorno
+    // é a última; por uma diagonal, a anterior à volta dela
+    int32_t m = static_cast<int32_t>(vertices.size());
+    int32_t v = semiDestino[semi];
+    if (semi < m) return semiOrdenadas[inicioGrupo[v + 1] - 1];
+    int32_t volta = m + ((semi - m) ^ 1);
+    return semiOrdenadas[semiPosicao[volta] - 1];
+}
+
+bool Triangulador::triangularPartes() {
+    // Anel + diagonais nos dois sentidos; cada face à esquerda é uma parte monótona
+    int32_t m = static_cast<int32_t>(vertices.size());
+    int32_t numDiagonais = static_cast<int32_t>(diagonais.size() / 2);
+    int32_t total = m + 2 * numDiagonais;
+    semiOrigem.resize(total);
+    semiDestino.resize(total);
+    for (int32_t i = 0; i < m; i++) {
+        semiOrigem[i] = i;
+        semiDestino[i] = (i + 1) % m;
+    }
+    for (int32_t i = 0; i < numDiagonais; i++) {
+        int32_t a = diagonais[i * 2];
+        int32_t b = diagonais[i * 2 + 1];
+        if (a == b) return false;
+        semiOrigem[m + i * 2] = a;
+        semiDestino[m + i * 2] = b;
+        semiOrigem[m + i * 2 + 1] = b;
+        semiDestino[m + i * 2 + 1] = a;
+    }
+
+    // Semiarestas agrupadas por origem: a do contorno primeiro, depois as
+    // diagonais pelo ângulo anti-horário a partir dela
+    semiAngulo.resize(total);
+    semiOrdenadas.resize(total);
+    semiPosicao.resize(total);
+    inicioGrupo.assign(m + 1, 0);
+    for (int32_t s = 0; s < total; s++) {
+        int32_t o = semiOrigem[s];
+        if (s >= m) {
+            const Vertice& a = vertices[o];
+            const Vertice& b = vertices[semiDestino[s]];
+            const Vertice& c = vertices[(o + 1) % m];
+            double angulo = std::atan2(b.y - a.y, b.x - a.x) - std::atan2(c.y - a.y, c.x - a.x);
+            semiAngulo[s] = angulo < 0.0 ? angulo + 6.283185307179586 : angulo;
+        } else {
+            semiAngulo[s] = 0.0;
+        }
+        inicioGrupo[o + 1]++;
+    }
+    for (int32_t v = 0; v < m; v++) inicioGrupo[v + 1] += inicioGrupo[v];
+    for (int32_t s = 0; s < total; s++) {
+        semiOrdenadas[inicioGrupo[semiOrigem[s]]++] = s;
+    }
+    // Cada início andou até o início do grupo seguinte: volta uma casa
+    for (int32_t v = m; v > 0; v--) inicioGrupo[v] = inicioGrupo[v - 1];
+    inicioGrupo[0] = 0;
+    for (int32_t v = 0; v < m; v++) {
+        if (inicioGrupo[v + 1] - inicioGrupo[v] > 2) {
+            std::sort(semiOrdenadas.begin() + inicioGrupo[v] + 1, semiOrdenadas.begin() + inicioGrupo[v + 1],
+                      [this](int32_t a, int32_t b) { return semiAngulo[a] < semiAngulo[b]; });
+        }
+        for (int32_t i = inicioGrupo[v]; i < inicioGrupo[v + 1]; i++) {
+            semiPosicao[semiOrdenadas[i]] = i;
+        }
+    }
+
+    semiVisitada.assign(total, 0);
+    for (int32_t s = 0; s < total; s++) {
+        if (semiVisitada[s]) continue;
+        face.clear();
+        int32_t atual = s;
+        do {
+            if (semiVisitada[atual] || static_cast<int32_t>(face.size()) >= m) return false;
+            semiVisitada[atual] = 1;
+            face.push_back(semiOrigem[atual]);
+            atual = proximaSemiaresta(atual);
+        } while (atual != s);
+        if (!triangularMonotono()) return false;
+    }
+    return true;
+}
+
+void Triangulador::emitir(int32_t a, int32_t b, int32_t c) {
+    // Sempre anti-horário
+    const Vertice& va = vertices[a];
+    const Vertice& vb = vertices[b];
+    const Vertice& vc = vertices[c];
+    if (giro(va.x, va.y, vb.x, vb.y, vc.x, vc.y) < 0.0) std::swap(b, c);
+    saida->push_back(vertices[a].indice);
+    saida->push_back(vertices[b].indice);
+    saida->push_back(vertices[c].indice);
+}
+
+bool Triangulador::triangularMonotono() {
+    int32_t k = static_cast<int32_t>(face.size());
+    if (k < 3) return false;
+    if (k == 3) {
+        emitir(face[0], face[1], face[2]);
+        return true;
+    }
+
+    // As duas cadeias, do topo ao fundo, intercaladas de cima para baixo
+    int32_t topo = 0;
+    int32_t fundo = 0;
+    for (int32_t i = 1; i < k; i++) {
+        if (acima(face[i], face[topo])) topo = i;
+        if (acima(face[fundo], face[i])) fundo = i;
+    }
+    ordemFace.clear();
+    ladoFace.clear();
+    ordemFace.push_back(face[topo]);
+    ladoFace.push_back(0);
+    int32_t e = (topo + 1) % k;              // anti-horário a partir do topo: cadeia da esquerda
+    int32_t d = (topo + k - 1) % k;
+    int32_t ultimoE = face[topo];
+    int32_t ultimoD = face[topo];
+    while (e != fundo || d != fundo) {
+        if (e != fundo && (d == fundo || acima(face[e], face[d]))) {
+            if (!acima(ultimoE, face[e])) return false;   // não é monótona
+            ultimoE = face[e];
+            ordemFace.push_back(face[e]);
+            ladoFace.push_back(0);
+            e = (e + 1) % k;
+        } else {
+            if (!acima(ultimoD, face[d])) return false;
+            ultimoD = face[d];
+            ordemFace.push_back(face[d]);
+            ladoFace.push_back(1);
+            d = (d + k - 1) % k;
+        }
+    }
+    ordemFace.push_back(face[fundo]);
+    ladoFace.push_back(0);
+
+    // Pilha com a cadeia reflexa ainda sem triângulos
+    pilha.clear();
+    pilha.push_back(0);
+    pilha.push_back(1);
+    for (int32_t j = 2; j < k - 1; j++) {
+        if (ladoFace[j] != ladoFace[pilha.back()]) {
+            // Outra cadeia: todos da pilha enxergam j
+            while (pilha.size() > 1) {
+                int32_t a = pilha.back();
+                pilha.pop_back();
+                emitir(ordemFace[j], ordemFace[a], ordemFace[pilha.back()]);
+            }
+            pilha.clear();
+            pilha.push_back(j - 1);
+            pilha.push_back(j);
+        } else {
+            // Mesma cadeia: corta enquanto o vértice do meio for convexo
+            int32_t ultimo = pilha.back();
+            pilha.pop_back();
+            while (!pilha.empty()) {
+                const Vertice& t = vertices[ordemFace[pilha.back()]];
+                const Vertice& u = vertices[ordemFace[ultimo]];
+                const Vertice& w = vertices[ordemFace[j]];
+                double g = giro(t.x, t.y, u.x, u.y, w.x, w.y);
+                if (ladoFace[j] == 0 ? g <= 0.0 : g >= 0.0) break;
+                emitir(ordemFace[j], ordemFace[ultimo], ordemFace[pilha.back()]);
+                ultimo = pilha.back();
+                pilha.pop_back();
+            }
+            pilha.push_back(ultimo);
+            pilha.push_back(j);
+        }
+    }
+    while (pilha.size() > 1) {
+        int32_t a = pilha.back();
+        pilha.pop_back();
+        emitir(ordemFace[k - 1], ordemFace[a], ordemFace[pilha.back()]);
+    }
+    return true;
+}
+
+bool Triangulador::triangularVarredura(const float* xy, size_t numPontos, bool antiHorario) {
+    // Anel anti-horário sem pontos repetidos em sequência
+    vertices.clear();
+    vertices.reserve(numPontos);
+    for (size_t k = 0; k < numPontos; k++) {
+        size_t i = antiHorario ? k : numPontos - 1 - k;
+        Vertice v{ xy[i * 2], xy[i * 2 + 1], static_cast<uint32_t>(i) };
+        if (!vertices.empty() && vertices.back().x == v.x && vertices.back().y == v.y) continue;
+        vertices.push_back(v);
+    }
+    while (vertices.size() > 1 && vertices.back().x == vertices[0].x && vertices.back().y == vertices[0].y) {
+        vertices.pop_back();
+    }
+    if (vertices.size() < 3) return false;
+
+    size_t inicio = saida->size();
+    if (decomporMonotonos() && triangularPartes() && saida->size() - inicio == (vertices.size() - 2) * 3) {
+        return true;
+    }
+    saida->resize(inicio);
+    return false;
+}
+
+// ========== Entrada ==========
+
+static bool cobreArea(const float* xy, const std::vector<uint32_t>& indices, double areaContorno) {
+    // Completa se os triângulos cobrem a área do contorno (pontos repetidos ou
+    // colineares somem sem erro; autointerseções e buracos na cobertura, não)
+    double areaTriangulos = 0.0;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        const float* a = &xy[indices[i] * 2];
+        const float* b = &xy[indices[i + 1] * 2];
+        const float* c = &xy[indices[i + 2] * 2];
+        areaTriangulos += std::fabs((static_cast<double>(b[0]) - a[0]) * (static_cast<double>(c[1]) - a[1]) -
+                                    (static_cast<double>(c[0]) - a[0]) * (static_cast<double>(b[1]) - a[1]));
+    }
+    return !indices.empty() && std::fabs(areaTriangulos - areaContorno) <= 1e-6 * areaContorno;
+}
+
+bool Triangulador::triangular(const float* xy, size_t numPontos, std::vector<uint32_t>& indices) {
+    indices.clear();
+    nos.clear();
+    if (numPontos < 3) return false;
+    saida = &indices;
+
+    // Dobro da área com sinal: positiva no sentido anti-horário
+    double soma = 0.0;
+    for (size_t i = 0, j = numPontos - 1; i < numPontos; j = i++) {
+        soma += (static_cast<double>(xy[j * 2]) - xy[i * 2]) * (static_cast<double>(xy[i * 2 + 1]) + xy[j * 2 + 1]);
+    }
+
+    // Contornos grandes: partes monótonas, O(n log n). Se a varredura não
+    // cobrir o contorno (não era simples), o corte de orelhas tenta
+    if (numPontos >= LIMIAR_VARREDURA) {
+        if (triangularVarredura(xy, numPontos, soma > 0.0) && cobreArea(xy, indices, std::fabs(soma))) {
+            saida = nullptr;
+            return true;
+        }
+        indices.clear();
+    }
+
+    // Anel na orientação em que os vértices convexos têm área negativa
+    nos.reserve(numPontos + numPontos / 4);
+    size_t log2Pontos = 1;
+    while ((size_t(1) << log2Pontos) < numPontos) log2Pontos++;
+    orcamentoDivisao = 8 * numPontos * log2Pontos + 65536;
+    int32_t ultimo = -1;
+    if (soma > 0.0) {
+        for (size_t i = 0; i < numPontos; i++) {
+            ultimo = inserir(static_cast<uint32_t>(i), xy[i * 2], xy[i * 2 + 1], ultimo);
+        }
+    } else {
+        for (size_t i = numPontos; i-- > 0;) {
+            ultimo = inserir(static_cast<uint32_t>(i), xy[i * 2], xy[i * 2 + 1], ultimo);
+        }
+    }
+    if (iguais(ultimo, nos[ultimo].proximo)) {
+        remover(ultimo);
+        ultimo = nos[ultimo].proximo;
+    }
+    if (nos[ultimo].proximo == nos[ultimo].anterior) return false;
+
+    // Contornos grandes: caixa envolvente para o código Z
+    escalaZ = 0.0;
+    if (numPontos > LIMIAR_HASH_Z) {
+        double maxX, maxY;
+        minX = maxX = xy[0];
+        minY = maxY = xy[1];
+        for (size_t i = 1; i < numPontos; i++) {
+            minX = std::min(minX, static_cast<double>(xy[i * 2]));
+            minY = std::min(minY, static_cast<double>(xy[i * 2 + 1]));
+            maxX = std::max(maxX, static_cast<double>(xy[i * 2]));
+            maxY = std::max(maxY, static_cast<double>(xy[i * 2 + 1]));
+        }
+        double tamanho = std::max(maxX - minX, maxY - minY);
+        escalaZ = tamanho != 0.0 ? 32767.0 / tamanho : 0.0;
+    }
+
+    cortarOrelhas(ultimo, 0);
+    saida = nullptr;
+    return cobreArea(xy, indices, std::fabs(soma));
+}
+
+// ========== Cache ==========
+
+CacheTriangulacoes& CacheTriangulacoes::instancia() {
+    static CacheTriangulacoes cache;
+    return cache;
+}
+
+uint64_t CacheTriangulacoes::hashContorno(const float* xy, size_t numPontos) {
+    // FNV-1a de 64 bits, uma palavra de 32 bits por vez (os bits de cada float)
+    uint64_t hash = 1469598103934665603ull ^ numPontos;
+    for (size_t i = 0; i < numPontos * 2; i++) {
+        uint32_t bits;
+        std::memcpy(&bits, &xy[i], sizeof(bits));
+        hash = (hash ^ bits) * 1099511628211ull;
+    }
+    return hash;
+}
+
+const TriangulacaoCache& CacheTriangulacoes::obter(const float* xy, size_t numPontos) {
+    uint64_t hash = hashContorno(xy, numPontos);
+    std::vector<std::unique_ptr<TriangulacaoCache>>& balde = baldes[hash];
+    for (const auto& entrada : balde) {
+        if (entrada->contorno.size() == numPontos * 2 &&
+            (numPontos == 0 || std::memcmp(entrada->contorno.data(), xy, numPontos * 2 * sizeof(float)) == 0)) {
+            acertos++;
+            return *entrada;
+        }
+    }
+
+    // Primeira vez: triangula e expande os índices em vértices para GL_TRIANGLES
+    std::unique_ptr<TriangulacaoCache> nova(new TriangulacaoCache());
+    nova->id = static_cast<uint32_t>(numEntradas);
+    nova->hash = hash;
+    nova->contorno.assign(xy, xy + numPontos * 2);
+    nova->completa = triangulador.triangular(xy, numPontos, indices);
+    nova->triangulos.resize(indices.size() * 2);
+    for (size_t i = 0; i < indices.size(); i++) {
+        nova->triangulos[i * 2] = xy[indices[i] * 2];
+        nova->triangulos[i * 2 + 1] = xy[indices[i] * 2 + 1];
+    }
+    nova->minX = nova->maxX = numPontos ? xy[0] : 0.0f;
+    nova->minY = nova->maxY = numPontos ? xy[1] : 0.0f;
+    for (size_t i = 1; i < numPontos; i++) {
+        nova->minX = std::min(nova->minX, xy[i * 2]);
+        nova->minY = std::min(nova->minY, xy[i * 2 + 1]);
+        nova->maxX = std::max(nova->maxX, xy[i * 2]);
+        nova->maxY = std::max(nova->maxY, xy[i * 2 + 1]);
+    }
+
+    numEntradas++;
+    balde.push_back(std::move(nova));
+    return *balde.back();
+}
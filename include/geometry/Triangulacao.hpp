@@ -0,0 +1,193 @@
+#ifndef TRIANGULACAO_HPP
+#define TRIANGULACAO_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class Triangulador
+ * @brief Triangulação de polígonos simples (côncavos inclusive)
+ *
+ * A partir de LIMIAR_VARREDURA pontos, uma varredura de cima para baixo
+ * divide o polígono em partes y-monótonas (diagonais nos vértices de
+ * divisão e de junção, arestas ativas em uma treap) e cada parte é
+ * triangulada em tempo linear com uma pilha: O(n log n) em qualquer
+ * contorno simples, inclusive os de ruído com metade dos vértices
+ * reflexos (o `make bench` mede 1k, 10k e 100k pontos).
+ *
+ * Contornos pequenos, e os que a varredura não cobre por inteiro (pontos
+ * repetidos fora de sequência, autointerseções), vão para o corte de
+ * orelhas: o contorno vira uma lista duplamente ligada e uma orelha
+ * (vértice convexo cujo triângulo com os vizinhos não contém outro vértice
+ * reflexo) é cortada por vez. Acima de LIMIAR_HASH_Z pontos o teste de
+ * orelha só percorre os vértices cujo código Z (Morton) cai na caixa do
+ * triângulo. Esse caminho é O(n²) no pior caso.
+ *
+ * Quando não há mais orelhas, a lista é limpa e, se preciso, o polígono é
+ * dividido por uma diagonal válida e cada metade triangulada à parte. Cada
+ * diagonal testada percorre o anel inteiro, então a busca tem um orçamento
+ * de O(n log n) nós visitados: esgotado, o resto do contorno fica sem
+ * triângulos e triangular() devolve false.
+ *
+ * A memória é do objeto e reaproveitada: triangular contornos do mesmo
+ * tamanho de novo não aloca. Não é thread-safe (um por thread).
+ */
+class Triangulador {
+public:
+    /// A partir de quantos pontos o contorno é decomposto em partes monótonas
+    static const size_t LIMIAR_VARREDURA = 64;
+
+    /// A partir de quantos pontos o teste de orelha usa a curva Z
+    static const size_t LIMIAR_HASH_Z = 80;
+
+    /**
+     * @brief Triangula um contorno fechado (o último ponto liga ao primeiro)
+     *
+     * @param xy - Pontos (x, y) em sequência, em qualquer orientação
+     * @param numPontos - Quantidade de pontos
+     * @param indices - Recebe 3 índices de ponto por triângulo (substitui o conteúdo)
+     * @return bool - true se os triângulos cobrem exatamente a área do contorno
+     *         (false em contornos com autointerseção)
+     */
+    bool triangular(const float* xy, size_t numPontos, std::vector<uint32_t>& indices);
+
+private:
+    struct No {
+        uint32_t indice;          ///< Ponto de origem no contorno
+        double x, y;
+        uint32_t z;               ///< Código Morton (0 até indexar)
+        int32_t anterior, proximo;
+        int32_t anteriorZ, proximoZ;
+    };
+
+    std::vector<No> nos;
+    std::vector<uint32_t>* saida = nullptr;
+    double minX = 0.0, minY = 0.0, escalaZ = 0.0;   ///< escalaZ 0: sem curva Z
+    size_t orcamentoDivisao = 0;                    ///< Nós que dividirECortar ainda pode visitar
+
+    // ========== Varredura ==========
+
+    struct Vertice {
+        double x, y;
+        uint32_t indice;          ///< Ponto de origem no contorno
+    };
+
+    /// Nó da treap de arestas ativas, ordenadas da esquerda para a direita na linha de varredura
+    struct NoStatus {
+        int32_t esquerda, direita, pai;
+        uint32_t prioridade;
+        int32_t aresta;           ///< Aresta i liga o vértice i ao i+1
+        double x0, y0, dxdy;      ///< Reta da aresta: x = x0 + (y - y0) * dxdy
+    };
+
+    std::vector<Vertice> vertices;            ///< Anel anti-horário, sem pontos repetidos em sequência
+    struct Evento {
+        double y, x;
+        int32_t vertice;
+    };
+
+    std::vector<Evento> eventos;              ///< Vértices de cima para baixo
+    std::vector<int32_t> ajudante;            ///< Por aresta ativa: vértice mais baixo visto à direita dela
+    std::vector<int32_t> noDaAresta;          ///< Por aresta: nó na treap, -1 fora dela
+    std::vector<NoStatus> status;
+    int32_t raizStatus = -1;
+    uint32_t sementeStatus = 0;
+    std::vector<int32_t> diagonais;           ///< Pares (a, b)
+    std::vector<int32_t> semiOrigem, semiDestino, semiOrdenadas, semiPosicao, inicioGrupo;
+    std::vector<double> semiAngulo;
+    std::vector<uint8_t> semiVisitada;
+    std::vector<int32_t> face;                ///< Vértices de uma parte monótona, anti-horário
+    std::vector<int32_t> ordemFace;           ///< A parte de cima para baixo
+    std::vector<uint8_t> ladoFace;            ///< 0 = cadeia da esquerda, 1 = da direita
+    std::vector<int32_t> pilha;
+
+    bool triangularVarredura(const float* xy, size_t numPontos, bool antiHorario);
+    bool decomporMonotonos();
+    bool triangularPartes();
+    bool triangularMonotono();
+    bool acima(int32_t a, int32_t b) const;
+    bool ehJuncao(int32_t v) const;
+    double xNaVarredura(int32_t no, double y) const;
+    int32_t arestaAEsquerda(int32_t v) const;
+    void inserirStatus(int32_t aresta);
+    bool removerStatus(int32_t aresta);
+    bool fecharAresta(int32_t aresta, int32_t v);
+    void girarParaCima(int32_t no);
+    int32_t proximaSemiaresta(int32_t semi) const;
+    void emitir(int32_t a, int32_t b, int32_t c);
+
+    // ========== Corte de orelhas ==========
+
+    int32_t inserir(uint32_t indice, double x, double y, int32_t ultimo);
+    void remover(int32_t p);
+    int32_t limparPontos(int32_t inicio, int32_t fim = -1);
+    void cortarOrelhas(int32_t orelha, int passada);
+    bool ehOrelha(int32_t orelha) const;
+    bool ehOrelhaZ(int32_t orelha) const;
+    int32_t curarIntersecoesLocais(int32_t inicio);
+    void dividirECortar(int32_t inicio);
+    void indexarCurvaZ(int32_t inicio);
+    int32_t ordenarPorZ(int32_t lista);
+    uint32_t codigoZ(double x, double y) const;
+
+    double area(int32_t p, int32_t q, int32_t r) const;
+    bool iguais(int32_t a, int32_t b) const;
+    bool seCruzam(int32_t p1, int32_t q1, int32_t p2, int32_t q2) const;
+    bool cruzaPoligono(int32_t a, int32_t b) const;
+    bool localmenteDentro(int32_t a, int32_t b) const;
+    bool meioDentro(int32_t a, int32_t b) const;
+    bool diagonalValida(int32_t a, int32_t b) const;
+    int32_t dividirPoligono(int32_t a, int32_t b);
+};
+
+/**
+ * @struct TriangulacaoCache
+ * @brief Um contorno e seus triângulos prontos para um VBO
+ */
+struct TriangulacaoCache {
+    uint32_t id;                      ///< Único por contorno distinto (chave do RegistroMalhas)
+    uint64_t hash;
+    std::vector<float> contorno;      ///< Pontos (x, y) como recebidos
+    std::vector<float> triangulos;    ///< (x, y) de 3 vértices por triângulo, para GL_TRIANGLES
+    float minX, minY, maxX, maxY;     ///< Caixa envolvente do contorno
+    bool completa;                    ///< false se o contorno não era um polígono simples
+};
+
+/**
+ * @class CacheTriangulacoes
+ * @brief Triangulações indexadas pelo hash do contorno
+ *
+ * O mesmo contorno (mesmos floats, na mesma ordem) é triangulado uma única
+ * vez; os pedidos seguintes custam o hash e uma comparação. Entradas nunca
+ * são removidas, então as referências devolvidas valem até o fim do programa.
+ * Colisões de hash são tratadas comparando o contorno inteiro.
+ *
+ * Usado pela thread que constrói as formas (sem trava).
+ */
+class CacheTriangulacoes {
+public:
+    /// O cache da aplicação
+    static CacheTriangulacoes& instancia();
+
+    /// Triangulação do contorno (xy com numPontos pontos), calculada na primeira vez
+    const TriangulacaoCache& obter(const float* xy, size_t numPontos);
+
+    size_t getNumEntradas() const { return numEntradas; }
+    size_t getAcertos() const { return acertos; }
+    size_t getFaltas() const { return numEntradas; }
+
+    /// Hash de 64 bits dos bits dos floats do contorno
+    static uint64_t hashContorno(const float* xy, size_t numPontos);
+
+private:
+    std::unordered_map<uint64_t, std::vector<std::unique_ptr<TriangulacaoCache>>> baldes;
+    Triangulador triangulador;
+    std::vector<uint32_t> indices;
+    size_t numEntradas = 0;
+    size_t acertos = 0;
+};
+
+#endif // TRIANGULACAO_HPP
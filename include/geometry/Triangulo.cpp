@@ -1,4 +1,5 @@
 #include "Triangulo.hpp"
+#include <algorithm> // para min
 #include <cstring> // para memcpy
 
 // ========== Construtores ==========
@@ -34,9 +35,9 @@ void Triangulo::gerarVertices() {
     // Limpa qualquer vértice anterior
     vertices.clear();
     
-    // Reserva espaço para 6 floats (3 vértices × 2 coordenadas)
+    // Reserva espaço para 3 vértices (2 coordenadas, ou 5 com textura)
     // Isso evita realocações desnecessárias
-    vertices.reserve(6);
+    vertices.reserve(3 * getComponentesPorVertice());
     
     if (usarCustomizados) {
         // Usa os vértices customizados fornecidos pelo usuário
@@ -59,6 +60,25 @@ void Triangulo::gerarVertices() {
         vertices.push_back(0.0f);
         vertices.push_back(0.5f);
     }
+    
+    // Coordenadas de textura a partir do canto inferior esquerdo da caixa envolvente
+    float minX = std::min(vertices[0], std::min(vertices[2], vertices[4]));
+    float minY = std::min(vertices[1], std::min(vertices[3], vertices[5]));
+    aplicarUVs(minX, minY);
+}
+
+void Triangulo::descreverMalha(ChaveMalha& chave) const {
+    // Vértices customizados já estão na posição final (deslocamento zero)
+    chave.tipo = TipoMalha::triangulo;
+    if (usarCustomizados) {
+        chave.parametros.assign(verticesCustomizados, verticesCustomizados + 6);
+    }
+}
+
+bool Triangulo::contornoConvexo(PoligonoConvexo& saida) const {
+    // Mesmos pontos de gerarVertices(), sem as UVs
+    static const float padrao[6] = { -0.5f, -0.5f, 0.5f, -0.5f, 0.0f, 0.5f };
+    return transformarContorno(usarCustomizados ? verticesCustomizados : padrao, 3, saida);
 }
 
 // ========== Métodos Auxiliares ==========
@@ -73,8 +93,6 @@ void Triangulo::setVerticesCustomizados(const float novosVertices[6]) {
     // Regenera os vértices com os novos valores
     gerarVertices();
     
-    // Atualiza o VBO na GPU com os novos dados
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(float), 
-                 vertices.data(), GL_STATIC_DRAW);
+    // Troca a malha na GPU (compartilhada com triângulos de mesmos vértices)
+    atualizarMalha();
 }
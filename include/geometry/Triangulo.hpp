@@ -77,6 +77,21 @@ public:
      */
     int getNumeroVertices() const override { return 3; }
 
+    /**
+     * @brief Os 3 vértices no mundo (todo triângulo é convexo)
+     * @return bool - true
+     */
+    bool contornoConvexo(PoligonoConvexo& saida) const override;
+
+protected:
+    /**
+     * @brief Os 6 floats customizados (nenhum parâmetro no triângulo padrão)
+     * @param chave - Chave da malha a preencher
+     */
+    void descreverMalha(ChaveMalha& chave) const override;
+
+public:
+
     // ========== Métodos Auxiliares ==========
     
     /**
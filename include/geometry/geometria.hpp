@@ -6,6 +6,14 @@
 #include "Quadrado.hpp"
 #include "Retangulo.hpp"
 #include "Circulo.hpp"
+#include "PoligonoRegular.hpp"
+#include "Estrela.hpp"
+#include "Elipse.hpp"
+#include "Poligono.hpp"
+#include "RegistroMalhas.hpp"
+#include "GeometriaEstatica.hpp"
+#include "DesenhoMultiplo.hpp"
+#include "FilaDesenho.hpp"
 
 //void geometria();
 
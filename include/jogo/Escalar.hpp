@@ -0,0 +1,155 @@
+#ifndef ESCALAR_HPP
+#define ESCALAR_HPP
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @class PontoFixo
+ * @brief Número com FRACAO bits de fração guardado em um int32
+ *
+ * Soma, multiplicação, divisão e raiz são operações inteiras: o resultado
+ * é o mesmo bit a bit em qualquer compilador, CPU e nível de otimização,
+ * o que o float não garante (FMA, precisão estendida, -ffast-math,
+ * libm diferente). É o que permite lockstep entre máquinas diferentes.
+ *
+ * Com FRACAO = 16 (Q16_16) a faixa é ±32768 com resolução de 1/65536,
+ * folgada para coordenadas em NDC. Multiplicação e divisão truncam (sem
+ * arredondamento) e não há checagem de estouro.
+ */
+template<int FRACAO>
+class PontoFixo {
+public:
+    static constexpr int BITS_FRACAO = FRACAO;
+    static constexpr int32_t UM = int32_t(1) << FRACAO;
+
+    constexpr PontoFixo() : valor(0) {}
+
+    /// Conversão de constantes (em tempo de compilação quando o argumento é constante)
+    static constexpr PontoFixo deFloat(float v) {
+        return deBruto(static_cast<int32_t>(v * UM + (v >= 0.0f ? 0.5f : -0.5f)));
+    }
+    static constexpr PontoFixo deBruto(int32_t bruto) {
+        PontoFixo r;
+        r.valor = bruto;
+        return r;
+    }
+
+    constexpr int32_t bruto() const { return valor; }
+    constexpr float paraFloat() const { return static_cast<float>(valor) / UM; }
+
+    // ========== Aritmética ==========
+    constexpr PontoFixo operator+(PontoFixo o) const { return deBruto(valor + o.valor); }
+    constexpr PontoFixo operator-(PontoFixo o) const { return deBruto(valor - o.valor); }
+    constexpr PontoFixo operator-() const { return deBruto(-valor); }
+    constexpr PontoFixo operator*(PontoFixo o) const {
+        return deBruto(static_cast<int32_t>((static_cast<int64_t>(valor) * o.valor) >> FRACAO));
+    }
+    constexpr PontoFixo operator/(PontoFixo o) const {
+        return deBruto(static_cast<int32_t>((static_cast<int64_t>(valor) * UM) / o.valor));
+    }
+    PontoFixo& operator+=(PontoFixo o) { valor += o.valor; return *this; }
+    PontoFixo& operator-=(PontoFixo o) { valor -= o.valor; return *this; }
+    PontoFixo& operator*=(PontoFixo o) { return *this = *this * o; }
+
+    // ========== Comparação ==========
+    constexpr bool operator<(PontoFixo o) const { return valor < o.valor; }
+    constexpr bool operator>(PontoFixo o) const { return valor > o.valor; }
+    constexpr bool operator<=(PontoFixo o) const { return valor <= o.valor; }
+    constexpr bool operator>=(PontoFixo o) const { return valor >= o.valor; }
+    constexpr bool operator==(PontoFixo o) const { return valor == o.valor; }
+    constexpr bool operator!=(PontoFixo o) const { return valor != o.valor; }
+
+private:
+    int32_t valor;
+};
+
+using Q16_16 = PontoFixo<16>;
+
+/**
+ * Tipo numérico da simulação (Partida), escolhido na compilação:
+ * float por padrão, Q16_16 com -DFISICA_PONTO_FIXO
+ * (ex.: make run extra_flags=-DFISICA_PONTO_FIXO).
+ */
+#ifdef FISICA_PONTO_FIXO
+using Escalar = Q16_16;
+#else
+using Escalar = float;
+#endif
+
+// ========== Funções para os dois tipos ==========
+// O código da simulação usa só estas, então compila igual com float ou PontoFixo
+
+/// Constante no tipo T (ex.: escalar<T>(0.5f))
+template<typename T>
+constexpr T escalar(float v) { return T::deFloat(v); }
+template<>
+constexpr float escalar<float>(float v) { return v; }
+
+/// Valor uniforme em [0, 1) a partir de 64 bits aleatórios
+template<typename T>
+inline T uniforme(uint64_t bits) { return T::deBruto(static_cast<int32_t>(bits >> (64 - T::BITS_FRACAO))); }
+template<>
+inline float uniforme<float>(uint64_t bits) { return static_cast<float>(bits >> 40) * (1.0f / 16777216.0f); }
+
+inline float paraFloat(float v) { return v; }
+template<int F>
+inline float paraFloat(PontoFixo<F> v) { return v.paraFloat(); }
+
+inline float absoluto(float v) { return std::fabs(v); }
+template<int F>
+inline PontoFixo<F> absoluto(PontoFixo<F> v) { return v < PontoFixo<F>() ? -v : v; }
+
+inline float raiz(float v) { return std::sqrt(v); }
+
+/// Raiz quadrada inteira (bit a bit) do valor já escalado: exata até o último bit
+template<int F>
+inline PontoFixo<F> raiz(PontoFixo<F> v) {
+    if (v.bruto() <= 0) return PontoFixo<F>();
+    uint64_t n = static_cast<uint64_t>(v.bruto()) << F;
+    uint64_t resultado = 0;
+    uint64_t bit = uint64_t(1) << 62;
+    while (bit > n) bit >>= 2;
+    while (bit) {
+        if (n >= resultado + bit) {
+            n -= resultado + bit;
+            resultado = (resultado >> 1) + bit;
+        } else {
+            resultado >>= 1;
+        }
+        bit >>= 2;
+    }
+    return PontoFixo<F>::deBruto(static_cast<int32_t>(resultado));
+}
+
+inline float seno(float v) { return std::sin(v); }
+inline float cosseno(float v) { return std::cos(v); }
+
+/// Série de Taylor até x^7: erro abaixo da resolução de Q16_16 para |x| <= 1 rad
+template<int F>
+inline PontoFixo<F> seno(PontoFixo<F> x) {
+    using T = PontoFixo<F>;
+    constexpr T um = T::deFloat(1.0f);
+    constexpr T c6 = T::deFloat(1.0f / 6.0f), c20 = T::deFloat(1.0f / 20.0f), c42 = T::deFloat(1.0f / 42.0f);
+    // x (1 - x²/6 (1 - x²/20 (1 - x²/42)))
+    T x2 = x * x;
+    T r = um - x2 * c42;
+    r = um - x2 * c20 * r;
+    r = um - x2 * c6 * r;
+    return x * r;
+}
+
+/// Série de Taylor até x^6, mesma faixa de seno()
+template<int F>
+inline PontoFixo<F> cosseno(PontoFixo<F> x) {
+    using T = PontoFixo<F>;
+    constexpr T um = T::deFloat(1.0f);
+    constexpr T c2 = T::deFloat(0.5f), c12 = T::deFloat(1.0f / 12.0f), c30 = T::deFloat(1.0f / 30.0f);
+    // 1 - x²/2 (1 - x²/12 (1 - x²/30))
+    T x2 = x * x;
+    T r = um - x2 * c30;
+    r = um - x2 * c12 * r;
+    return um - x2 * c2 * r;
+}
+
+#endif // ESCALAR_HPP
@@ -0,0 +1,212 @@
+#include "LotePartidas.hpp"
+#include "../core/SistemaJobs.hpp"
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+LotePartidas::LotePartidas(size_t numPartidas, uint32_t pontosParaVencer, uint64_t sementeBase)
+    : numPartidas(numPartidas),
+      numPistas((numPartidas + LARGURA_SIMD - 1) / LARGURA_SIMD * LARGURA_SIMD),
+      pontosParaVencer(pontosParaVencer), sementeBase(sementeBase), concluidas(0), ticksEscalares(0) {
+    for (std::vector<float>* campo : { &bolaX, &bolaY, &bolaVX, &bolaVY, &raqueteY[0], &raqueteY[1] }) {
+        campo->resize(numPistas);
+    }
+    placar[0].resize(numPistas);
+    placar[1].resize(numPistas);
+    tick.resize(numPistas);
+    rng.resize(numPistas);
+    geracao.assign(numPistas, 0);
+    for (size_t i = 0; i < numPistas; i++) iniciarPista(i);
+    parciais.resize(2 * ((numPistas + LOTE_PARTIDAS - 1) / LOTE_PARTIDAS));
+}
+
+uint64_t LotePartidas::semente(uint64_t sementeBase, size_t pista, uint32_t geracao) {
+    // splitmix64 de (pista, geração): sementes bem espalhadas e reprodutíveis
+    uint64_t z = sementeBase + 0x9E3779B97F4A7C15ull * ((static_cast<uint64_t>(geracao) << 32 | pista) + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// ========== Estado de uma Pista ==========
+
+void LotePartidas::iniciarPista(size_t i) {
+    PartidaT<float> nova(semente(sementeBase, i, geracao[i]++));
+    gravarEstado(i, nova.getEstado());
+}
+
+void LotePartidas::gravarEstado(size_t i, const EstadoPartidaT<float>& e) {
+    bolaX[i] = e.bolaX;
+    bolaY[i] = e.bolaY;
+    bolaVX[i] = e.bolaVX;
+    bolaVY[i] = e.bolaVY;
+    raqueteY[0][i] = e.raqueteY[0];
+    raqueteY[1][i] = e.raqueteY[1];
+    placar[0][i] = e.placar[0];
+    placar[1][i] = e.placar[1];
+    tick[i] = e.tick;
+    rng[i] = e.rng;
+}
+
+EstadoPartidaT<float> LotePartidas::getEstado(size_t i) const {
+    EstadoPartidaT<float> e;
+    e.bolaX = bolaX[i];
+    e.bolaY = bolaY[i];
+    e.bolaVX = bolaVX[i];
+    e.bolaVY = bolaVY[i];
+    e.raqueteY[0] = raqueteY[0][i];
+    e.raqueteY[1] = raqueteY[1][i];
+    e.placar[0] = placar[0][i];
+    e.placar[1] = placar[1][i];
+    e.tick = tick[i];
+    e.rng = rng[i];
+    return e;
+}
+
+bool LotePartidas::passoEscalar(size_t i, uint8_t entrada, PartidaT<float>& rascunho) {
+    rascunho.restaurar(getEstado(i));
+    rascunho.passo(entrada);
+    const EstadoPartidaT<float>& e = rascunho.getEstado();
+    if (e.placar[0] >= pontosParaVencer || e.placar[1] >= pontosParaVencer) {
+        iniciarPista(i);
+        return true;
+    }
+    gravarEstado(i, e);
+    return false;
+}
+
+// ========== Passo ==========
+
+void LotePartidas::passo(const uint8_t* entradas, SistemaJobs* jobs) {
+    if (jobs) {
+        std::fill(parciais.begin(), parciais.end(), 0);
+        jobs->paraCadaIntervalo(numPistas, LOTE_PARTIDAS, [&](size_t inicio, size_t fim) {
+            size_t lote = inicio / LOTE_PARTIDAS;
+            passoIntervalo(entradas, inicio, fim, parciais[2 * lote], parciais[2 * lote + 1]);
+        });
+        for (size_t k = 0; k < parciais.size(); k += 2) {
+            concluidas += parciais[k];
+            ticksEscalares += parciais[k + 1];
+        }
+    } else {
+        passoIntervalo(entradas, 0, numPistas, concluidas, ticksEscalares);
+    }
+}
+
+void LotePartidas::passoIntervalo(const uint8_t* entradas, size_t inicio, size_t fim,
+                                  uint64_t& concluidasLote, uint64_t& escalaresLote) {
+    PartidaT<float> rascunho;
+    auto entradaDa = [&](size_t i) -> uint8_t { return i < numPartidas ? entradas[i] : 0; };
+    auto resolverEscalar = [&](size_t i) {
+        escalaresLote++;
+        // pistas de preenchimento (além de numPartidas) não contam
+        if (passoEscalar(i, entradaDa(i), rascunho) && i < numPartidas) concluidasLote++;
+    };
+
+#if defined(__SSE2__)
+    using P = PartidaT<float>;
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 sinal = _mm_set1_ps(-0.0f);
+    const __m128 deslocamento = _mm_set1_ps(P::RAQUETE_VELOCIDADE * P::TICK);
+    const __m128 limiteRaquete = _mm_set1_ps(1.0f - P::RAQUETE_MEIA_ALTURA);
+    const __m128 menosLimiteRaquete = _mm_set1_ps(-(1.0f - P::RAQUETE_MEIA_ALTURA));
+    const __m128 dt = _mm_set1_ps(P::TICK);
+    const float limiteBola = 1.0f - P::BOLA_RAIO;
+    const __m128 limite = _mm_set1_ps(limiteBola);
+    const __m128 menosLimite = _mm_set1_ps(-limiteBola);
+    const __m128 reflexoCima = _mm_set1_ps(limiteBola + limiteBola);
+    const __m128 reflexoBaixo = _mm_set1_ps(-limiteBola - limiteBola);
+    const __m128 faceX = _mm_set1_ps(P::RAQUETE_X - P::RAQUETE_MEIA_LARGURA - P::BOLA_RAIO);
+    const __m128 raqueteX = _mm_set1_ps(P::RAQUETE_X);
+    const __m128 alcance = _mm_set1_ps(P::RAQUETE_MEIA_ALTURA + P::BOLA_RAIO);
+    const __m128 fundo = _mm_set1_ps(1.0f + P::BOLA_RAIO);
+    const __m128 menosFundo = _mm_set1_ps(-(1.0f + P::BOLA_RAIO));
+
+    // seleciona(m, a, b) = m ? a : b, pista a pista
+    auto seleciona = [](__m128 m, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); };
+
+    for (size_t i = inicio; i < fim; i += LARGURA_SIMD) {
+        // 4 bytes de entrada viram 4 inteiros de 32 bits
+        int32_t quatro;
+        if (i + LARGURA_SIMD <= numPartidas) {
+            std::memcpy(&quatro, entradas + i, sizeof(quatro));
+        } else {
+            uint8_t resto[4] = { entradaDa(i), entradaDa(i + 1), entradaDa(i + 2), entradaDa(i + 3) };
+            std::memcpy(&quatro, resto, sizeof(quatro));
+        }
+        const __m128i e = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(quatro), _mm_setzero_si128()),
+                                             _mm_setzero_si128());
+
+        // 1. Raquetes: sobe só com "cima" sem "baixo" e vice-versa (como em Partida)
+        __m128 r[2];
+        for (int j = 0; j < 2; j++) {
+            const __m128i bitCima = _mm_set1_epi32(j == 0 ? ENTRADA_P1_CIMA : ENTRADA_P2_CIMA);
+            const __m128i bitBaixo = _mm_set1_epi32(j == 0 ? ENTRADA_P1_BAIXO : ENTRADA_P2_BAIXO);
+            __m128 cima = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(e, bitCima), bitCima));
+            __m128 baixo = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(e, bitBaixo), bitBaixo));
+            __m128 y = _mm_loadu_ps(&raqueteY[j][i]);
+            y = seleciona(_mm_andnot_ps(baixo, cima), _mm_add_ps(y, deslocamento),
+                          seleciona(_mm_andnot_ps(cima, baixo), _mm_sub_ps(y, deslocamento), y));
+            r[j] = _mm_min_ps(_mm_max_ps(y, menosLimiteRaquete), limiteRaquete);
+        }
+
+        // 2. Bola e paredes
+        __m128 vx = _mm_loadu_ps(&bolaVX[i]);
+        __m128 vy = _mm_loadu_ps(&bolaVY[i]);
+        __m128 x = _mm_add_ps(_mm_loadu_ps(&bolaX[i]), _mm_mul_ps(vx, dt));
+        __m128 y = _mm_add_ps(_mm_loadu_ps(&bolaY[i]), _mm_mul_ps(vy, dt));
+        __m128 acima = _mm_cmpgt_ps(y, limite);
+        __m128 abaixo = _mm_cmplt_ps(y, menosLimite);
+        y = seleciona(acima, _mm_sub_ps(reflexoCima, y), seleciona(abaixo, _mm_sub_ps(reflexoBaixo, y), y));
+        vy = seleciona(_mm_or_ps(acima, abaixo), _mm_xor_ps(vy, sinal), vy);
+
+        // 3. Rebatida ou ponto: só o teste; o tratamento fica no caminho escalar
+        __m128 menosX = _mm_xor_ps(x, sinal);
+        __m128 rebate0 = _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(vx, zero), _mm_cmpge_ps(menosX, faceX)),
+                                    _mm_and_ps(_mm_cmple_ps(menosX, raqueteX),
+                                               _mm_cmple_ps(_mm_andnot_ps(sinal, _mm_sub_ps(y, r[0])), alcance)));
+        __m128 rebate1 = _mm_and_ps(_mm_and_ps(_mm_cmpgt_ps(vx, zero), _mm_cmpge_ps(x, faceX)),
+                                    _mm_and_ps(_mm_cmple_ps(x, raqueteX),
+                                               _mm_cmple_ps(_mm_andnot_ps(sinal, _mm_sub_ps(y, r[1])), alcance)));
+        __m128 ponto = _mm_or_ps(_mm_cmplt_ps(x, menosFundo), _mm_cmpgt_ps(x, fundo));
+        int evento = _mm_movemask_ps(_mm_or_ps(_mm_or_ps(rebate0, rebate1), ponto));
+
+        if (evento == 0) {
+            _mm_storeu_ps(&raqueteY[0][i], r[0]);
+            _mm_storeu_ps(&raqueteY[1][i], r[1]);
+            _mm_storeu_ps(&bolaX[i], x);
+            _mm_storeu_ps(&bolaY[i], y);
+            _mm_storeu_ps(&bolaVY[i], vy);
+            __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&tick[i]));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(&tick[i]), _mm_add_epi32(t, _mm_set1_epi32(1)));
+            continue;
+        }
+
+        // Pistas com evento refazem o tick do zero; as outras guardam o resultado SIMD
+        alignas(16) float rr0[4], rr1[4], xx[4], yy[4], vvy[4];
+        _mm_store_ps(rr0, r[0]);
+        _mm_store_ps(rr1, r[1]);
+        _mm_store_ps(xx, x);
+        _mm_store_ps(yy, y);
+        _mm_store_ps(vvy, vy);
+        for (size_t k = 0; k < LARGURA_SIMD; k++) {
+            if (evento & (1 << k)) {
+                resolverEscalar(i + k);
+            } else {
+                raqueteY[0][i + k] = rr0[k];
+                raqueteY[1][i + k] = rr1[k];
+                bolaX[i + k] = xx[k];
+                bolaY[i + k] = yy[k];
+                bolaVY[i + k] = vvy[k];
+                tick[i + k]++;
+            }
+        }
+    }
+#else
+    for (size_t i = inicio; i < fim; i++) resolverEscalar(i);
+#endif
+}
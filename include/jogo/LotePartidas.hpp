@@ -0,0 +1,90 @@
+#ifndef LOTE_PARTIDAS_HPP
+#define LOTE_PARTIDAS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Partida.hpp"
+
+class SistemaJobs;
+
+/**
+ * @class LotePartidas
+ * @brief N partidas em float avançando juntas, uma por pista SIMD
+ *
+ * Para treino e ajuste de bots (milhões de partidas sem janela). Os
+ * estados ficam em estrutura de arrays (um vetor por campo, como no
+ * MundoFisico) e o passo processa LARGURA_SIMD partidas por instrução
+ * com SSE: raquetes, movimento da bola, paredes e os testes de rebatida
+ * e de ponto são todos sem desvio, pista a pista.
+ *
+ * Rebatidas e pontos são raros (um a cada dezenas de ticks por partida) e
+ * precisam de seno, cosseno e do sorteio do saque: as pistas em que o
+ * teste acusa um desses eventos refazem o tick inteiro com
+ * PartidaT<float>::passo(). Assim cada pista segue bit a bit uma Partida
+ * em float com a mesma semente e as mesmas entradas (o bench confere).
+ *
+ * Quando alguém chega a pontosParaVencer, a pista recomeça com uma
+ * semente nova (derivada da pista e de quantas partidas ela já jogou, então
+ * o resultado não depende de quantas threads foram usadas).
+ * Sem SSE (outras arquiteturas), todas as pistas usam o caminho escalar.
+ */
+class LotePartidas {
+public:
+    static constexpr size_t LARGURA_SIMD = 4;
+    /// Partidas por job do SistemaJobs (múltiplo de LARGURA_SIMD)
+    static constexpr size_t LOTE_PARTIDAS = 256;
+
+    LotePartidas(size_t numPartidas, uint32_t pontosParaVencer = 11, uint64_t sementeBase = 1);
+
+    /**
+     * @brief Avança todas as partidas em um tick
+     * @param entradas - Um byte (bits de EntradaPartida) por partida
+     * @param jobs - Pool que recebe os lotes (nullptr executa tudo nesta thread)
+     */
+    void passo(const uint8_t* entradas, SistemaJobs* jobs = nullptr);
+
+    /// Semente da partida número `geracao` jogada na pista `pista`
+    static uint64_t semente(uint64_t sementeBase, size_t pista, uint32_t geracao);
+
+    // ========== Consulta ==========
+
+    size_t getNumPartidas() const { return numPartidas; }
+    uint64_t getPartidasConcluidas() const { return concluidas; }
+    uint64_t getTicksEscalares() const { return ticksEscalares; }   ///< Pistas-tick resolvidas sem SIMD
+    EstadoPartidaT<float> getEstado(size_t i) const;
+
+    // Campos em SoA, para bots que decidem as entradas também em lote
+    const float* getBolaX() const { return bolaX.data(); }
+    const float* getBolaY() const { return bolaY.data(); }
+    const float* getBolaVX() const { return bolaVX.data(); }
+    const float* getRaqueteY(int jogador) const { return raqueteY[jogador].data(); }
+
+private:
+    size_t numPartidas;
+    size_t numPistas;                 ///< numPartidas arredondado para LARGURA_SIMD
+    uint32_t pontosParaVencer;
+    uint64_t sementeBase;
+    uint64_t concluidas;
+    uint64_t ticksEscalares;
+
+    std::vector<float> bolaX, bolaY, bolaVX, bolaVY;
+    std::vector<float> raqueteY[2];
+    std::vector<uint32_t> placar[2];
+    std::vector<uint32_t> tick;
+    std::vector<uint64_t> rng;
+    std::vector<uint32_t> geracao;    ///< Partidas já iniciadas em cada pista
+    std::vector<uint64_t> parciais;   ///< Contadores por lote (com jobs), sem alocar no passo
+
+    void iniciarPista(size_t i);
+    void gravarEstado(size_t i, const EstadoPartidaT<float>& e);
+
+    /// Avança as pistas [inicio, fim), somando concluídas e ticks escalares do intervalo
+    void passoIntervalo(const uint8_t* entradas, size_t inicio, size_t fim,
+                        uint64_t& concluidasLote, uint64_t& escalaresLote);
+
+    /// Refaz o tick de uma pista com PartidaT<float> (rebatida ou ponto)
+    bool passoEscalar(size_t i, uint8_t entrada, PartidaT<float>& rascunho);
+};
+
+#endif // LOTE_PARTIDAS_HPP
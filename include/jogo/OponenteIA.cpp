@@ -0,0 +1,74 @@
+#include "OponenteIA.hpp"
+#include <cmath>
+
+// Distância mínima até o alvo para mexer a raquete (evita tremer em volta dele)
+static const float ZONA_MORTA = Partida::RAQUETE_VELOCIDADE * Partida::TICK;
+
+OponenteIA::OponenteIA(const ConfigIA& config)
+    : config(config), observadas(0), cacheVX(0.0f), cacheVYAbs(-1.0f), alvo(0.0f),
+      rng(config.semente ? config.semente : 0x9E3779B9u), previsoes(0) {
+    if (this->config.latenciaTicks >= MAX_LATENCIA) this->config.latenciaTicks = MAX_LATENCIA - 1;
+}
+
+float OponenteIA::sortearErro() {
+    // xorshift32: o erro é só jogabilidade, não entra no estado da partida
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    float u = static_cast<float>(rng >> 8) * (1.0f / 16777216.0f);
+    return (u * 2.0f - 1.0f) * config.erro;
+}
+
+// ========== Previsão ==========
+
+bool OponenteIA::preverCruzamento(float x, float y, float vx, float vy, float planoX,
+                                  float limiteY, float& yCruzamento) {
+    float distancia = planoX - x;
+    if (vx == 0.0f || distancia * vx < 0.0f) return false;
+
+    // Sem paredes, a bola estaria em yLivre; com paredes em ±L a trajetória
+    // se repete a cada 4L (sobe 2L, desce 2L): dobra yLivre de volta na mesa
+    float yLivre = y + vy * (distancia / vx);
+    float periodo = 4.0f * limiteY;
+    float m = std::fmod(yLivre + limiteY, periodo);
+    if (m < 0.0f) m += periodo;
+    yCruzamento = m <= 2.0f * limiteY ? m - limiteY : 3.0f * limiteY - m;
+    return true;
+}
+
+// ========== Decisão ==========
+
+uint8_t OponenteIA::decidir(const EstadoPartida& estado) {
+    historico[observadas % MAX_LATENCIA] = Observacao{
+        paraFloat(estado.bolaX), paraFloat(estado.bolaY),
+        paraFloat(estado.bolaVX), paraFloat(estado.bolaVY)
+    };
+    observadas++;
+
+    // Reage ao que viu latenciaTicks atrás (ou ao mais antigo, no começo)
+    uint32_t atraso = observadas > config.latenciaTicks ? config.latenciaTicks : observadas - 1;
+    const Observacao& bola = historico[(observadas - 1 - atraso) % MAX_LATENCIA];
+
+    float vyAbs = std::fabs(bola.vy);
+    if (bola.vx != cacheVX || vyAbs != cacheVYAbs) {
+        cacheVX = bola.vx;
+        cacheVYAbs = vyAbs;
+        previsoes++;
+
+        float lado = config.jogador == 0 ? -1.0f : 1.0f;
+        float planoX = lado * (Partida::RAQUETE_X - Partida::RAQUETE_MEIA_LARGURA - Partida::BOLA_RAIO);
+        float yCruzamento;
+        if (preverCruzamento(bola.x, bola.y, bola.vx, bola.vy, planoX, 1.0f - Partida::BOLA_RAIO, yCruzamento)) {
+            alvo = yCruzamento + sortearErro();
+        } else {
+            // Bola indo embora: volta para o meio enquanto espera
+            alvo = 0.0f;
+        }
+    }
+
+    float diferenca = alvo - paraFloat(estado.raqueteY[config.jogador]);
+    uint8_t teclas = 0;
+    if (diferenca > ZONA_MORTA) teclas = ENTRADA_P1_CIMA;
+    if (diferenca < -ZONA_MORTA) teclas = ENTRADA_P1_BAIXO;
+    return config.jogador == 0 ? teclas : static_cast<uint8_t>(teclas << 2);
+}
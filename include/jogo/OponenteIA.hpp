@@ -0,0 +1,74 @@
+#ifndef OPONENTE_IA_HPP
+#define OPONENTE_IA_HPP
+
+#include <cstdint>
+#include "Partida.hpp"
+
+/**
+ * @struct ConfigIA
+ * @brief Dificuldade de um OponenteIA
+ */
+struct ConfigIA {
+    int jogador = 1;                ///< Raquete controlada (0 = esquerda, 1 = direita)
+    uint32_t latenciaTicks = 8;     ///< Tempo de reação: a IA vê a bola de N ticks atrás
+    float erro = 0.06f;             ///< Desvio máximo (NDC) sorteado a cada nova previsão
+    uint32_t semente = 1;           ///< Sorteio do erro (reprodutível)
+};
+
+/**
+ * @class OponenteIA
+ * @brief Jogador automático que calcula onde a bola vai cruzar a raquete
+ *
+ * Em vez de simular a bola tick a tick até a raquete, a previsão é
+ * analítica: o tempo até o plano x da raquete sai de uma divisão, e as
+ * rebatidas nas paredes são resolvidas "desdobrando" a mesa (a trajetória
+ * vira uma reta em uma faixa espelhada infinita, dobrada de volta com um
+ * módulo). A previsão só é refeita quando a velocidade observada muda de
+ * verdade (rebatida em raquete ou saque); a inversão de vy numa parede já
+ * está prevista e não conta. Cada decisão custa O(1).
+ *
+ * A latência é um anel com as últimas posições da bola: a IA reage ao que
+ * viu latenciaTicks atrás. O resultado são bits de EntradaPartida para o
+ * lado do jogador, então a IA joga pela mesma entrada que um humano (e
+ * entra em replays e rollback como qualquer entrada).
+ */
+class OponenteIA {
+public:
+    static constexpr uint32_t MAX_LATENCIA = 32;
+
+    explicit OponenteIA(const ConfigIA& config = ConfigIA());
+
+    /// Observa o estado do tick e devolve as teclas da IA (bits do seu jogador)
+    uint8_t decidir(const EstadoPartida& estado);
+
+    /**
+     * @brief y em que a bola cruza o plano x = planoX, com as paredes em ±limiteY
+     * @return false se a bola não está indo na direção do plano
+     */
+    static bool preverCruzamento(float x, float y, float vx, float vy, float planoX,
+                                 float limiteY, float& yCruzamento);
+
+    // ========== Consulta ==========
+    float getAlvo() const { return alvo; }
+    uint64_t getPrevisoes() const { return previsoes; }   ///< Quantas vezes a previsão foi refeita
+    const ConfigIA& getConfig() const { return config; }
+
+private:
+    struct Observacao {
+        float x, y, vx, vy;
+    };
+
+    ConfigIA config;
+    Observacao historico[MAX_LATENCIA];   ///< Anel das últimas posições da bola
+    uint32_t observadas;
+
+    // Cache da previsão: vale enquanto vx e |vy| não mudarem
+    float cacheVX, cacheVYAbs;
+    float alvo;
+    uint32_t rng;
+    uint64_t previsoes;
+
+    float sortearErro();
+};
+
+#endif // OPONENTE_IA_HPP
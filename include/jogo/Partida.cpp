@@ -0,0 +1,145 @@
+#include "Partida.hpp"
+
+// Ganho de velocidade a cada rebatida e desvio máximo pela posição na raquete
+// (constexpr: a conversão para ponto fixo acontece na compilação, sem float em tempo de execução)
+static constexpr float ACELERACAO_REBATIDA = 1.05f;
+static constexpr float DESVIO_MAXIMO = 0.9f;
+
+template<typename T>
+static T limitar(T v, T minimo, T maximo) {
+    return v < minimo ? minimo : (v > maximo ? maximo : v);
+}
+
+// ========== Construtor ==========
+
+template<typename T>
+PartidaT<T>::PartidaT(uint64_t semente) : semente(semente) {
+    estado = EstadoPartidaT<T>();
+    // Semente 0 travaria o xorshift
+    estado.rng = semente ? semente : 0x9E3779B97F4A7C15ull;
+    constexpr T meio = escalar<T>(0.5f);
+    sacar(sortear() < meio ? -1 : 1);
+}
+
+// ========== Sorteio ==========
+
+template<typename T>
+T PartidaT<T>::sortear() {
+    // xorshift64*: mesmo resultado em qualquer plataforma
+    uint64_t x = estado.rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    estado.rng = x;
+    return uniforme<T>(x * 0x2545F4914F6CDD1Dull);
+}
+
+template<typename T>
+void PartidaT<T>::sacar(int direcao) {
+    // Bola no centro, ângulo sorteado em ±30°, indo para o lado `direcao`
+    constexpr T meio = escalar<T>(0.5f);
+    constexpr T abertura = escalar<T>(1.0471976f);
+    constexpr T velocidade = escalar<T>(BOLA_VELOCIDADE_INICIAL);
+    T angulo = (sortear() - meio) * abertura;
+    estado.bolaX = T();
+    estado.bolaY = T();
+    estado.bolaVX = (direcao < 0 ? -velocidade : velocidade) * cosseno(angulo);
+    estado.bolaVY = velocidade * seno(angulo);
+}
+
+// ========== Passo ==========
+
+template<typename T>
+void PartidaT<T>::passo(uint8_t entradas) {
+    constexpr T zero = T();
+    constexpr T um = escalar<T>(1.0f);
+    estado.tick++;
+
+    // 1. Raquetes
+    const uint8_t cima[2] = { ENTRADA_P1_CIMA, ENTRADA_P2_CIMA };
+    const uint8_t baixo[2] = { ENTRADA_P1_BAIXO, ENTRADA_P2_BAIXO };
+    constexpr T limiteRaquete = escalar<T>(1.0f - RAQUETE_MEIA_ALTURA);
+    constexpr T deslocamento = escalar<T>(RAQUETE_VELOCIDADE * TICK);
+    for (int i = 0; i < 2; i++) {
+        int direcao = 0;
+        if (entradas & cima[i]) direcao++;
+        if (entradas & baixo[i]) direcao--;
+        T y = estado.raqueteY[i];
+        if (direcao > 0) y += deslocamento;
+        if (direcao < 0) y -= deslocamento;
+        estado.raqueteY[i] = limitar(y, -limiteRaquete, limiteRaquete);
+    }
+
+    // 2. Bola
+    constexpr T tick = escalar<T>(TICK);
+    estado.bolaX += estado.bolaVX * tick;
+    estado.bolaY += estado.bolaVY * tick;
+
+    // Paredes de cima e de baixo
+    constexpr T limiteBola = escalar<T>(1.0f - BOLA_RAIO);
+    if (estado.bolaY > limiteBola) {
+        estado.bolaY = limiteBola + limiteBola - estado.bolaY;
+        estado.bolaVY = -estado.bolaVY;
+    } else if (estado.bolaY < -limiteBola) {
+        estado.bolaY = -limiteBola - limiteBola - estado.bolaY;
+        estado.bolaVY = -estado.bolaVY;
+    }
+
+    // 3. Raquetes: só rebate quem está indo na direção dela
+    constexpr T faceX = escalar<T>(RAQUETE_X - RAQUETE_MEIA_LARGURA - BOLA_RAIO);
+    constexpr T alcance = escalar<T>(RAQUETE_MEIA_ALTURA + BOLA_RAIO);
+    for (int i = 0; i < 2; i++) {
+        T lado = i == 0 ? -um : um;
+        bool indo = estado.bolaVX * lado > zero;
+        bool passouFace = estado.bolaX * lado >= faceX && estado.bolaX * lado <= escalar<T>(RAQUETE_X);
+        T dy = estado.bolaY - estado.raqueteY[i];
+        if (indo && passouFace && absoluto(dy) <= alcance) {
+            // A saída depende de onde bateu: no centro volta reta, na ponta sai inclinada
+            T velocidade = raiz(estado.bolaVX * estado.bolaVX + estado.bolaVY * estado.bolaVY);
+            velocidade = limitar(velocidade * escalar<T>(ACELERACAO_REBATIDA), zero,
+                                 escalar<T>(BOLA_VELOCIDADE_MAXIMA));
+            T desvio = limitar(dy / alcance, -um, um) * escalar<T>(DESVIO_MAXIMO);
+            estado.bolaVX = -lado * velocidade * cosseno(desvio);
+            estado.bolaVY = velocidade * seno(desvio);
+            estado.bolaX = lado * faceX;
+        }
+    }
+
+    // 4. Ponto: a bola saiu por um dos lados
+    constexpr T fundo = escalar<T>(1.0f + BOLA_RAIO);
+    if (estado.bolaX < -fundo) {
+        estado.placar[1]++;
+        sacar(-1);
+    } else if (estado.bolaX > fundo) {
+        estado.placar[0]++;
+        sacar(1);
+    }
+}
+
+// ========== Checksum ==========
+
+template<typename T>
+uint64_t PartidaT<T>::checksum() const {
+    // Campo a campo (sem o preenchimento da struct); T é float ou int32,
+    // então o hash de uma partida em ponto fixo vale entre builds
+    uint64_t h = 0xcbf29ce484222325ull;
+    auto misturar = [&h](const void* dados, size_t bytes) {
+        const unsigned char* p = static_cast<const unsigned char*>(dados);
+        for (size_t i = 0; i < bytes; i++) {
+            h ^= p[i];
+            h *= 0x100000001b3ull;
+        }
+    };
+    misturar(&estado.bolaX, sizeof(T));
+    misturar(&estado.bolaY, sizeof(T));
+    misturar(&estado.bolaVX, sizeof(T));
+    misturar(&estado.bolaVY, sizeof(T));
+    misturar(estado.raqueteY, sizeof(estado.raqueteY));
+    misturar(estado.placar, sizeof(estado.placar));
+    misturar(&estado.tick, sizeof(estado.tick));
+    misturar(&estado.rng, sizeof(estado.rng));
+    return h;
+}
+
+template class PartidaT<float>;
+template class PartidaT<Q16_16>;
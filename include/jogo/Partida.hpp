@@ -0,0 +1,106 @@
+#ifndef PARTIDA_HPP
+#define PARTIDA_HPP
+
+#include <cstdint>
+#include "Escalar.hpp"
+
+/// Bits da entrada de um tick (o mesmo formato de teclas_pressionadas)
+enum EntradaPartida : uint8_t {
+    ENTRADA_P1_CIMA  = 1 << 0,
+    ENTRADA_P1_BAIXO = 1 << 1,
+    ENTRADA_P2_CIMA  = 1 << 2,
+    ENTRADA_P2_BAIXO = 1 << 3
+};
+
+/**
+ * @struct EstadoPartidaT
+ * @brief Tudo que define uma partida em um tick (cópia simples, sem ponteiros)
+ *
+ * T é o tipo numérico da simulação (float ou PontoFixo); para desenhar,
+ * converta as coordenadas com paraFloat().
+ */
+template<typename T>
+struct EstadoPartidaT {
+    T bolaX, bolaY;
+    T bolaVX, bolaVY;
+    T raqueteY[2];            ///< Centro das raquetes (0 = esquerda, 1 = direita)
+    uint32_t placar[2];
+    uint32_t tick;
+    uint64_t rng;             ///< Estado do gerador (sorteia o saque)
+};
+
+/**
+ * @class PartidaT
+ * @brief Simulação de ping-pong com passo fixo, sem OpenGL e determinística
+ *
+ * A partida avança um tick de duração fixa (TICK) por chamada a passo(),
+ * recebendo só os bits de entrada daquele tick. Com a mesma semente e a
+ * mesma sequência de entradas, o estado é idêntico bit a bit (mesmo
+ * binário): é isso que permite gravar e reproduzir sessões (Replay).
+ *
+ * Coordenadas em NDC: a mesa vai de -1 a 1 nos dois eixos, as raquetes
+ * ficam em x = ±RAQUETE_X. O sorteio usa um gerador próprio (as
+ * distribuições da biblioteca padrão variam entre implementações).
+ *
+ * T é o tipo de posições, velocidades e colisões. Com float, o estado só
+ * é reproduzível no mesmo binário; com Q16_16 toda a aritmética é inteira
+ * e o mesmo replay dá o mesmo checksum em qualquer build (lockstep entre
+ * máquinas). O jogo usa Partida, que segue a escolha de Escalar.
+ * As dimensões públicas ficam em float (o render as usa direto).
+ */
+template<typename T>
+class PartidaT {
+public:
+    static constexpr uint32_t TICKS_POR_SEGUNDO = 120;
+    static constexpr float TICK = 1.0f / TICKS_POR_SEGUNDO;
+
+    // ========== Dimensões da Mesa ==========
+    static constexpr float RAQUETE_X = 0.92f;            ///< |x| do centro das raquetes
+    static constexpr float RAQUETE_MEIA_LARGURA = 0.015f;
+    static constexpr float RAQUETE_MEIA_ALTURA = 0.15f;
+    static constexpr float RAQUETE_VELOCIDADE = 1.6f;    ///< Unidades por segundo
+    static constexpr float BOLA_RAIO = 0.025f;
+    static constexpr float BOLA_VELOCIDADE_INICIAL = 0.9f;
+    static constexpr float BOLA_VELOCIDADE_MAXIMA = 2.4f;
+
+    explicit PartidaT(uint64_t semente = 1);
+
+    /// Avança um tick com as entradas dadas (bits de EntradaPartida)
+    void passo(uint8_t entradas);
+
+    const EstadoPartidaT<T>& getEstado() const { return estado; }
+
+    /**
+     * @brief Volta a um estado salvo com getEstado() (rollback)
+     *
+     * O estado é uma struct simples de poucas dezenas de bytes: salvar e
+     * restaurar são uma cópia, baratos o bastante para voltar vários ticks
+     * a cada quadro.
+     */
+    void restaurar(const EstadoPartidaT<T>& salvo) { estado = salvo; }
+    uint64_t getSemente() const { return semente; }
+
+    /**
+     * @brief Hash do estado inteiro (FNV-1a)
+     *
+     * Duas execuções com o mesmo checksum no mesmo tick seguiram o mesmo
+     * caminho; o replay guarda o do fim para detectar divergências.
+     */
+    uint64_t checksum() const;
+
+private:
+    EstadoPartidaT<T> estado;
+    uint64_t semente;
+
+    void sacar(int direcao);
+    T sortear();              ///< Valor em [0, 1)
+};
+
+// Instanciadas em Partida.cpp
+extern template class PartidaT<float>;
+extern template class PartidaT<Q16_16>;
+
+using EstadoPartida = EstadoPartidaT<Escalar>;
+using Partida = PartidaT<Escalar>;
+
+#endif // PARTIDA_HPP
@@ -0,0 +1,133 @@
+#include "Replay.hpp"
+#include <fstream>
+#include <iterator>
+
+static const char MAGICO[4] = {'P', 'P', 'R', 'P'};
+static const uint16_t VERSAO = 2;
+static const size_t TAMANHO_CABECALHO_V1 = 4 + 2 + 2 + 8 + 4 + 8;
+static const size_t TAMANHO_CABECALHO = TAMANHO_CABECALHO_V1 + 1;
+
+// ========== Inteiros Little-Endian ==========
+
+static void escreverInteiro(std::vector<uint8_t>& saida, uint64_t valor, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        saida.push_back(static_cast<uint8_t>(valor >> (8 * i)));
+    }
+}
+
+static uint64_t lerInteiro(const uint8_t* p, int bytes) {
+    uint64_t valor = 0;
+    for (int i = 0; i < bytes; i++) {
+        valor |= static_cast<uint64_t>(p[i]) << (8 * i);
+    }
+    return valor;
+}
+
+// Varint: 7 bits por byte, bit alto indica que há mais bytes
+static void escreverVarint(std::vector<uint8_t>& saida, uint32_t valor) {
+    while (valor >= 0x80) {
+        saida.push_back(static_cast<uint8_t>(valor | 0x80));
+        valor >>= 7;
+    }
+    saida.push_back(static_cast<uint8_t>(valor));
+}
+
+static bool lerVarint(const uint8_t*& p, const uint8_t* fim, uint32_t& valor) {
+    valor = 0;
+    for (int deslocamento = 0; deslocamento < 35; deslocamento += 7) {
+        if (p >= fim) return false;
+        uint8_t b = *p++;
+        valor |= static_cast<uint32_t>(b & 0x7f) << deslocamento;
+        if (!(b & 0x80)) return true;
+    }
+    return false;
+}
+
+// ========== Codificação ==========
+
+std::vector<uint8_t> codificarReplay(const Replay& replay) {
+    std::vector<uint8_t> saida;
+    saida.reserve(TAMANHO_CABECALHO + replay.entradas.size() / 8 + 16);
+
+    saida.insert(saida.end(), MAGICO, MAGICO + 4);
+    escreverInteiro(saida, VERSAO, 2);
+    escreverInteiro(saida, replay.ticksPorSegundo, 2);
+    escreverInteiro(saida, replay.semente, 8);
+    escreverInteiro(saida, replay.entradas.size(), 4);
+    escreverInteiro(saida, replay.checksumFinal, 8);
+    saida.push_back(static_cast<uint8_t>(replay.tipoNumerico));
+
+    // RLE: (entrada, quantas vezes seguidas)
+    size_t i = 0;
+    while (i < replay.entradas.size()) {
+        uint8_t entrada = replay.entradas[i];
+        size_t j = i + 1;
+        while (j < replay.entradas.size() && replay.entradas[j] == entrada && j - i < 0xffffffffu) j++;
+        saida.push_back(entrada);
+        escreverVarint(saida, static_cast<uint32_t>(j - i));
+        i = j;
+    }
+    return saida;
+}
+
+bool decodificarReplay(const uint8_t* dados, size_t tamanho, Replay& replay) {
+    if (tamanho < TAMANHO_CABECALHO_V1) return false;
+    for (int i = 0; i < 4; i++) {
+        if (dados[i] != static_cast<uint8_t>(MAGICO[i])) return false;
+    }
+    uint64_t versao = lerInteiro(dados + 4, 2);
+    if (versao != 1 && versao != VERSAO) return false;
+    size_t cabecalho = versao == 1 ? TAMANHO_CABECALHO_V1 : TAMANHO_CABECALHO;
+    if (tamanho < cabecalho) return false;
+
+    replay.ticksPorSegundo = static_cast<uint32_t>(lerInteiro(dados + 6, 2));
+    replay.semente = lerInteiro(dados + 8, 8);
+    uint32_t numTicks = static_cast<uint32_t>(lerInteiro(dados + 16, 4));
+    replay.checksumFinal = lerInteiro(dados + 20, 8);
+    replay.tipoNumerico = TipoNumerico::desconhecido;
+    if (versao >= 2) {
+        uint8_t tipo = dados[28];
+        if (tipo != static_cast<uint8_t>(TipoNumerico::pontoFlutuante) &&
+            tipo != static_cast<uint8_t>(TipoNumerico::pontoFixoQ16_16)) return false;
+        replay.tipoNumerico = static_cast<TipoNumerico>(tipo);
+    }
+
+    replay.entradas.clear();
+    replay.entradas.reserve(numTicks);
+    const uint8_t* p = dados + cabecalho;
+    const uint8_t* fim = dados + tamanho;
+    while (replay.entradas.size() < numTicks) {
+        if (p >= fim) return false;
+        uint8_t entrada = *p++;
+        uint32_t repeticoes;
+        if (!lerVarint(p, fim, repeticoes) || repeticoes == 0) return false;
+        if (repeticoes > numTicks - replay.entradas.size()) return false;
+        replay.entradas.insert(replay.entradas.end(), repeticoes, entrada);
+    }
+    return p == fim;
+}
+
+const char* nomeTipoNumerico(TipoNumerico tipo) {
+    switch (tipo) {
+        case TipoNumerico::pontoFlutuante: return "float";
+        case TipoNumerico::pontoFixoQ16_16: return "ponto fixo Q16.16";
+        default: return "desconhecido";
+    }
+}
+
+// ========== Arquivos ==========
+
+bool salvarReplay(const std::string& caminho, const Replay& replay) {
+    std::ofstream arquivo(caminho, std::ios::binary);
+    if (!arquivo) return false;
+    std::vector<uint8_t> dados = codificarReplay(replay);
+    arquivo.write(reinterpret_cast<const char*>(dados.data()), dados.size());
+    return static_cast<bool>(arquivo);
+}
+
+bool carregarReplay(const std::string& caminho, Replay& replay) {
+    std::ifstream arquivo(caminho, std::ios::binary);
+    if (!arquivo) return false;
+    std::vector<uint8_t> dados((std::istreambuf_iterator<char>(arquivo)), std::istreambuf_iterator<char>());
+    return decodificarReplay(dados.data(), dados.size(), replay);
+}
@@ -0,0 +1,81 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "Escalar.hpp"
+
+/// Tipo numérico em que a partida foi simulada (Escalar no build que gravou)
+enum class TipoNumerico : uint8_t {
+    pontoFlutuante = 0,
+    pontoFixoQ16_16 = 1,
+    desconhecido = 0xFF    ///< Arquivos da versão 1, que não guardavam o tipo
+};
+
+/// Tipo numérico deste build: só replays gravados nele podem conferir o checksum
+constexpr TipoNumerico TIPO_NUMERICO_ATUAL =
+    std::is_same<Escalar, float>::value ? TipoNumerico::pontoFlutuante : TipoNumerico::pontoFixoQ16_16;
+
+/**
+ * @struct Replay
+ * @brief Uma sessão gravada: semente + entradas de cada tick
+ *
+ * É tudo que a Partida precisa para refazer a sessão inteira. O checksum
+ * do estado final serve para detectar divergência ao reproduzir (build
+ * diferente, flags de compilação que mudam o ponto flutuante, bug).
+ * Gravado com -DFISICA_PONTO_FIXO, o checksum vale em qualquer build que
+ * também use ponto fixo; com float, só no mesmo binário. O tipo numérico
+ * vai no arquivo: reproduzir em outro tipo não é divergência, é outra
+ * simulação.
+ */
+struct Replay {
+    uint64_t semente = 1;
+    uint32_t ticksPorSegundo = 0;
+    TipoNumerico tipoNumerico = TIPO_NUMERICO_ATUAL;
+    std::vector<uint8_t> entradas;   ///< Uma entrada por tick
+    uint64_t checksumFinal = 0;      ///< Partida::checksum() após o último tick
+};
+
+/**
+ * Formato binário (.ppr), little-endian:
+ *
+ * | bytes | campo                                   |
+ * |-------|-----------------------------------------|
+ * | 4     | "PPRP"                                  |
+ * | 2     | versão (2)                              |
+ * | 2     | ticks por segundo                       |
+ * | 8     | semente                                 |
+ * | 4     | número de ticks                         |
+ * | 8     | checksum final                          |
+ * | 1     | tipo numérico (0 float, 1 Q16.16)       |
+ * | ...   | pares (entrada: 1 byte, repetições: varint) |
+ *
+ * A versão 1 não tem o byte do tipo; ainda é lida, com tipo desconhecido.
+ *
+ * As entradas mudam pouco de um tick para o outro, então a codificação
+ * por repetição (RLE) deixa uma partida de minutos com poucos KB.
+ */
+
+/// Grava o replay; false se não conseguir escrever o arquivo
+bool salvarReplay(const std::string& caminho, const Replay& replay);
+
+/**
+ * @brief Lê o replay; false se o arquivo não existir ou estiver corrompido
+ *
+ * Não recusa outro tipo numérico: quem reproduz compara replay.tipoNumerico
+ * com TIPO_NUMERICO_ATUAL e decide (ver tools/replay.cpp).
+ */
+bool carregarReplay(const std::string& caminho, Replay& replay);
+
+/// Codifica em memória (o conteúdo do arquivo)
+std::vector<uint8_t> codificarReplay(const Replay& replay);
+
+/// Decodifica de memória
+bool decodificarReplay(const uint8_t* dados, size_t tamanho, Replay& replay);
+
+/// "float", "ponto fixo Q16.16" ou "desconhecido"
+const char* nomeTipoNumerico(TipoNumerico tipo);
+
+#endif // REPLAY_HPP
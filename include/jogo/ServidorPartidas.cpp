@@ -0,0 +1,88 @@
+#include "ServidorPartidas.hpp"
+#include "../core/SistemaJobs.hpp"
+
+ServidorPartidas::ServidorPartidas(uint32_t pontosParaVencer, uint64_t sementeBase)
+    : pontosParaVencer(pontosParaVencer), sementeBase(sementeBase), partidasCriadas(0), concluidas(0) {}
+
+// ========== Ciclo de Vida ==========
+
+uint32_t ServidorPartidas::criarPartida() {
+    uint32_t id;
+    if (!idsLivres.empty()) {
+        id = idsLivres.back();
+        idsLivres.pop_back();
+    } else {
+        id = static_cast<uint32_t>(slotDoId.size());
+        slotDoId.push_back(SEM_SLOT);
+    }
+
+    // Semente distinta e reprodutível para cada partida criada
+    uint64_t semente = sementeBase + 0x9E3779B97F4A7C15ull * ++partidasCriadas;
+    slots.push_back(Slot{Partida(semente), id, 0, false});
+    slotDoId[id] = static_cast<uint32_t>(slots.size() - 1);
+    return id;
+}
+
+void ServidorPartidas::removerSlot(size_t indice) {
+    // Troca com a última para manter as ativas contíguas
+    uint32_t id = slots[indice].id;
+    if (indice != slots.size() - 1) {
+        slots[indice] = slots.back();
+        slotDoId[slots[indice].id] = static_cast<uint32_t>(indice);
+    }
+    slots.pop_back();
+    slotDoId[id] = SEM_SLOT;
+    idsLivres.push_back(id);
+}
+
+void ServidorPartidas::encerrarPartida(uint32_t id) {
+    if (ativa(id)) removerSlot(slotDoId[id]);
+}
+
+void ServidorPartidas::enviarEntrada(uint32_t id, int jogador, uint8_t teclas) {
+    if (!ativa(id)) return;
+    Slot& slot = slots[slotDoId[id]];
+    uint8_t mascara = jogador == 0 ? (ENTRADA_P1_CIMA | ENTRADA_P1_BAIXO) : (ENTRADA_P2_CIMA | ENTRADA_P2_BAIXO);
+    slot.entradas = static_cast<uint8_t>((slot.entradas & ~mascara) | (teclas & mascara));
+}
+
+// ========== Simulação ==========
+
+size_t ServidorPartidas::passo(SistemaJobs* jobs, FonteEntradas fonte, void* contexto) {
+    auto avancarLote = [&](size_t inicio, size_t fim) {
+        for (size_t i = inicio; i < fim; i++) {
+            Slot& slot = slots[i];
+            uint8_t entradas = fonte ? fonte(contexto, slot.id, slot.partida.getEstado()) : slot.entradas;
+            slot.partida.passo(entradas);
+            const EstadoPartida& e = slot.partida.getEstado();
+            slot.terminou = e.placar[0] >= pontosParaVencer || e.placar[1] >= pontosParaVencer;
+        }
+    };
+
+    if (jobs) {
+        jobs->paraCadaIntervalo(slots.size(), LOTE_PARTIDAS, avancarLote);
+    } else {
+        avancarLote(0, slots.size());
+    }
+
+    // Remoção sequencial (de trás para frente: a troca traz uma partida já verificada)
+    size_t terminaram = 0;
+    for (size_t i = slots.size(); i-- > 0;) {
+        if (slots[i].terminou) {
+            removerSlot(i);
+            terminaram++;
+        }
+    }
+    concluidas += terminaram;
+    return terminaram;
+}
+
+// ========== Consulta ==========
+
+bool ServidorPartidas::ativa(uint32_t id) const {
+    return id < slotDoId.size() && slotDoId[id] != SEM_SLOT;
+}
+
+const EstadoPartida* ServidorPartidas::getEstado(uint32_t id) const {
+    return ativa(id) ? &slots[slotDoId[id]].partida.getEstado() : nullptr;
+}
@@ -0,0 +1,102 @@
+#ifndef SERVIDOR_PARTIDAS_HPP
+#define SERVIDOR_PARTIDAS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Partida.hpp"
+
+class SistemaJobs;
+
+/**
+ * @class ServidorPartidas
+ * @brief Muitas partidas independentes avançando juntas, sem OpenGL
+ *
+ * Cada partida ativa ocupa um slot de um vetor contíguo (a Partida mais as
+ * entradas recebidas, menos de 100 bytes). Um passo do servidor avança
+ * todas as partidas ativas em um tick, dividindo o vetor em lotes de
+ * LOTE_PARTIDAS que o SistemaJobs distribui entre as threads; lotes de
+ * uma thread ocupada são roubados pelas livres, então o custo desigual
+ * entre partidas (pontos, rebatidas) se equilibra sozinho entre os núcleos.
+ *
+ * O escalonador mantém as ativas compactadas no início do vetor: uma
+ * partida encerrada cede o slot para a última (troca e remove), e nenhum
+ * lote gasta tempo com slots vazios.
+ *
+ * Entradas chegam por enviarEntrada() entre dois passos (mesma thread que
+ * chama passo()); o último valor de cada jogador vale até ser trocado. Para
+ * testes de carga, uma FonteEntradas gera as entradas dentro dos jobs.
+ */
+class ServidorPartidas {
+public:
+    /// Partidas avançadas por job (tamanho do lote do SistemaJobs)
+    static constexpr size_t LOTE_PARTIDAS = 64;
+
+    /// Gera as entradas de uma partida no tick (chamada em paralelo, uma vez por partida)
+    using FonteEntradas = uint8_t (*)(void* contexto, uint32_t idPartida, const EstadoPartida& estado);
+
+    /**
+     * @param pontosParaVencer - A partida termina quando alguém chega a este placar
+     * @param sementeBase - As sementes das partidas derivam desta (reprodutível)
+     */
+    explicit ServidorPartidas(uint32_t pontosParaVencer = 11, uint64_t sementeBase = 1);
+
+    // ========== Ciclo de Vida ==========
+
+    /// Cria uma partida e retorna seu id
+    uint32_t criarPartida();
+
+    /// Encerra uma partida antes do fim (ex.: jogador desconectou)
+    void encerrarPartida(uint32_t id);
+
+    /**
+     * @brief Atualiza as entradas de um jogador (0 ou 1) de uma partida
+     * @param teclas - Bits de EntradaPartida do jogador (cima/baixo dele)
+     */
+    void enviarEntrada(uint32_t id, int jogador, uint8_t teclas);
+
+    // ========== Simulação ==========
+
+    /**
+     * @brief Avança todas as partidas ativas em um tick
+     *
+     * @param jobs - Pool que recebe os lotes (nullptr executa tudo nesta thread)
+     * @param fonte - Gerador de entradas (nullptr usa as de enviarEntrada)
+     *
+     * Partidas que terminaram neste tick são removidas ao fim do passo.
+     * @return size_t - Quantas partidas terminaram neste tick
+     */
+    size_t passo(SistemaJobs* jobs = nullptr, FonteEntradas fonte = nullptr, void* contexto = nullptr);
+
+    // ========== Consulta ==========
+
+    size_t getNumAtivas() const { return slots.size(); }
+    uint64_t getPartidasConcluidas() const { return concluidas; }
+    bool ativa(uint32_t id) const;
+    const EstadoPartida* getEstado(uint32_t id) const;
+
+    /// Memória de uma partida ativa (slot + entrada no índice por id)
+    static size_t bytesPorPartida() { return sizeof(Slot) + sizeof(uint32_t); }
+
+private:
+    struct Slot {
+        Partida partida;
+        uint32_t id;
+        uint8_t entradas;      ///< Últimos bits recebidos dos dois jogadores
+        bool terminou;         ///< Marcado no job, removido no fim do passo
+    };
+
+    static constexpr uint32_t SEM_SLOT = 0xffffffffu;
+
+    std::vector<Slot> slots;             ///< Partidas ativas, compactadas
+    std::vector<uint32_t> slotDoId;      ///< id -> índice em slots (ou SEM_SLOT)
+    std::vector<uint32_t> idsLivres;
+    uint32_t pontosParaVencer;
+    uint64_t sementeBase;
+    uint64_t partidasCriadas;
+    uint64_t concluidas;
+
+    void removerSlot(size_t indice);
+};
+
+#endif // SERVIDOR_PARTIDAS_HPP
@@ -0,0 +1,165 @@
+#include "SessaoRollback.hpp"
+#include <cstring>
+
+// Identifica os pacotes da sessão ("PPRB")
+static const uint32_t MAGIA_PACOTE = 0x42525050u;
+
+struct CabecalhoPacote {
+    uint32_t magia;
+    uint32_t inicio;        ///< Tick da primeira entrada do pacote
+    uint32_t ack;           ///< Quantas entradas do destinatário já recebemos
+    uint16_t quantidade;    ///< Entradas (1 byte cada) após o cabeçalho
+};
+
+// No fio: os campos acima em little-endian, sem preenchimento
+static const size_t TAMANHO_CABECALHO = 4 + 4 + 4 + 2;
+
+static void escreverInteiro(uint8_t* p, uint32_t valor, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        p[i] = static_cast<uint8_t>(valor >> (8 * i));
+    }
+}
+
+static uint32_t lerInteiro(const uint8_t* p, int bytes) {
+    uint32_t valor = 0;
+    for (int i = 0; i < bytes; i++) {
+        valor |= static_cast<uint32_t>(p[i]) << (8 * i);
+    }
+    return valor;
+}
+
+static inline uint32_t indice(uint32_t tick) {
+    return tick % SessaoRollback::TAMANHO_HISTORICO;
+}
+
+// ========== Construtor ==========
+
+SessaoRollback::SessaoRollback(uint64_t semente, int jogadorLocal, uint32_t atrasoEntrada)
+    : partida(semente), jogadorLocal(jogadorLocal),
+      atrasoEntrada(atrasoEntrada < MAX_PREDICAO ? atrasoEntrada : MAX_PREDICAO - 1),
+      tickAtual(0), remotasConfirmadas(0), locaisConfirmadas(0), primeiraErrada(SEM_ERRO) {
+    std::memset(entradaLocal, 0, sizeof(entradaLocal));
+    std::memset(entradaRemota, 0, sizeof(entradaRemota));
+    std::memset(previsaoUsada, 0, sizeof(previsaoUsada));
+    // Os primeiros ticks (antes do atraso) não têm tecla de ninguém: já estão confirmados
+    locaisConhecidas = this->atrasoEntrada;
+    remotasConfirmadas = this->atrasoEntrada;
+    locaisConfirmadas = this->atrasoEntrada;
+}
+
+// ========== Simulação ==========
+
+uint8_t SessaoRollback::remotaParaTick(uint32_t tick) const {
+    if (tick < remotasConfirmadas) return entradaRemota[indice(tick)];
+    // Previsão: o jogador continua fazendo o que fazia
+    return remotasConfirmadas > 0 ? entradaRemota[indice(remotasConfirmadas - 1)] : 0;
+}
+
+void SessaoRollback::simularTick(uint32_t tick) {
+    uint32_t i = indice(tick);
+    snapshots[i] = partida.getEstado();
+
+    uint8_t remota = remotaParaTick(tick);
+    previsaoUsada[i] = remota;
+    uint8_t local = entradaLocal[i];
+
+    uint8_t entradas = jogadorLocal == 0 ? static_cast<uint8_t>(local | (remota << 2))
+                                         : static_cast<uint8_t>((local << 2) | remota);
+    partida.passo(entradas);
+}
+
+void SessaoRollback::corrigir() {
+    if (primeiraErrada >= tickAtual) {
+        primeiraErrada = SEM_ERRO;
+        return;
+    }
+
+    uint32_t profundidade = tickAtual - primeiraErrada;
+    partida.restaurar(snapshots[indice(primeiraErrada)]);
+    for (uint32_t t = primeiraErrada; t < tickAtual; t++) {
+        simularTick(t);
+    }
+
+    estatisticas.rollbacks++;
+    estatisticas.ticksResimulados += profundidade;
+    if (profundidade > estatisticas.maiorRollback) estatisticas.maiorRollback = profundidade;
+    primeiraErrada = SEM_ERRO;
+}
+
+bool SessaoRollback::avancar(uint8_t teclas) {
+    corrigir();
+
+    // Sem entradas remotas há muito tempo, ou o outro lado sem nossas entradas
+    // (o anel só guarda TAMANHO_HISTORICO ticks delas): espera em vez de prever
+    if (tickAtual >= remotasConfirmadas + MAX_PREDICAO ||
+        locaisConhecidas >= locaisConfirmadas + TAMANHO_HISTORICO / 2) {
+        estatisticas.ticksParados++;
+        return false;
+    }
+
+    entradaLocal[indice(locaisConhecidas)] = teclas & (ENTRADA_P1_CIMA | ENTRADA_P1_BAIXO);
+    locaisConhecidas++;
+
+    if (tickAtual >= remotasConfirmadas) estatisticas.ticksPrevistos++;
+    simularTick(tickAtual);
+    tickAtual++;
+    return true;
+}
+
+// ========== Rede ==========
+
+size_t SessaoRollback::montarPacote(uint8_t* buffer, size_t capacidade) const {
+    if (capacidade < TAMANHO_CABECALHO) return 0;
+
+    CabecalhoPacote cabecalho;
+    cabecalho.magia = MAGIA_PACOTE;
+    cabecalho.inicio = locaisConfirmadas;
+    cabecalho.ack = remotasConfirmadas;
+    size_t pendentes = locaisConhecidas - locaisConfirmadas;
+    size_t cabem = capacidade - TAMANHO_CABECALHO;
+    if (cabem > 0xFFFF) cabem = 0xFFFF;
+    cabecalho.quantidade = static_cast<uint16_t>(pendentes < cabem ? pendentes : cabem);
+
+    escreverInteiro(buffer, cabecalho.magia, 4);
+    escreverInteiro(buffer + 4, cabecalho.inicio, 4);
+    escreverInteiro(buffer + 8, cabecalho.ack, 4);
+    escreverInteiro(buffer + 12, cabecalho.quantidade, 2);
+    for (uint32_t k = 0; k < cabecalho.quantidade; k++) {
+        buffer[TAMANHO_CABECALHO + k] = entradaLocal[indice(cabecalho.inicio + k)];
+    }
+    return TAMANHO_CABECALHO + cabecalho.quantidade;
+}
+
+void SessaoRollback::receberPacote(const uint8_t* dados, size_t tamanho) {
+    if (tamanho < TAMANHO_CABECALHO) return;
+    CabecalhoPacote cabecalho;
+    cabecalho.magia = lerInteiro(dados, 4);
+    cabecalho.inicio = lerInteiro(dados + 4, 4);
+    cabecalho.ack = lerInteiro(dados + 8, 4);
+    cabecalho.quantidade = static_cast<uint16_t>(lerInteiro(dados + 12, 2));
+    if (cabecalho.magia != MAGIA_PACOTE ||
+        tamanho < TAMANHO_CABECALHO + cabecalho.quantidade) return;
+
+    // Ack: com reordenação, um pacote velho pode trazer um ack menor
+    if (cabecalho.ack > locaisConfirmadas && cabecalho.ack <= locaisConhecidas) {
+        locaisConfirmadas = cabecalho.ack;
+    }
+
+    // Só aceita entradas em sequência: a partir da primeira que falta
+    const uint8_t* entradas = dados + TAMANHO_CABECALHO;
+    for (uint32_t k = 0; k < cabecalho.quantidade; k++) {
+        uint32_t tick = cabecalho.inicio + k;
+        if (tick < remotasConfirmadas) continue;
+        if (tick > remotasConfirmadas) break;
+        // Não pode sobrescrever no anel um tick que ainda pode ser resimulado
+        if (tick >= tickAtual + TAMANHO_HISTORICO - MAX_PREDICAO) break;
+
+        uint8_t valor = entradas[k] & (ENTRADA_P1_CIMA | ENTRADA_P1_BAIXO);
+        uint32_t i = indice(tick);
+        entradaRemota[i] = valor;
+        if (tick < tickAtual && previsaoUsada[i] != valor && tick < primeiraErrada) {
+            primeiraErrada = tick;
+        }
+        remotasConfirmadas++;
+    }
+}
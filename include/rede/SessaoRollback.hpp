@@ -0,0 +1,112 @@
+#ifndef SESSAO_ROLLBACK_HPP
+#define SESSAO_ROLLBACK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include "jogo/Partida.hpp"
+
+/**
+ * @struct EstatisticasRollback
+ * @brief Contadores de uma SessaoRollback desde o início
+ */
+struct EstatisticasRollback {
+    uint64_t rollbacks = 0;          ///< Correções feitas (previsão errada detectada)
+    uint64_t ticksResimulados = 0;   ///< Soma das profundidades de todas as correções
+    uint32_t maiorRollback = 0;      ///< Maior profundidade, em ticks
+    uint64_t ticksPrevistos = 0;     ///< Ticks simulados sem a entrada remota confirmada
+    uint64_t ticksParados = 0;       ///< Chamadas de avancar() recusadas (remoto atrasado demais)
+};
+
+/**
+ * @class SessaoRollback
+ * @brief Rollback no estilo GGPO sobre uma Partida determinística
+ *
+ * Cada ponta simula a partida inteira localmente. A entrada local vale
+ * atrasoEntrada ticks no futuro (esconde parte da latência sem prever);
+ * a entrada remota de um tick que ainda não chegou é prevista como a
+ * última confirmada, e a simulação segue sem esperar. Quando a entrada
+ * real chega e difere da prevista, a sessão volta ao snapshot do primeiro
+ * tick errado e resimula até o tick atual com as entradas corrigidas.
+ *
+ * Snapshots e entradas ficam em anéis de TAMANHO_HISTORICO ticks. Um
+ * snapshot é o EstadoPartida (cópia de poucas dezenas de bytes) e um tick
+ * custa algumas dezenas de ns, então voltar 8+ ticks cabe com folga em um
+ * quadro. Se a ponta remota ficar mais de MAX_PREDICAO ticks para trás,
+ * avancar() recusa o tick até chegarem entradas (o jogo "engasga" em vez
+ * de prever cada vez mais longe).
+ *
+ * Pacotes levam as entradas locais ainda não confirmadas pelo outro lado
+ * (redundância: um pacote perdido é coberto pelo seguinte) e o ack das
+ * entradas remotas recebidas. Não há retransmissão nem conexão: basta
+ * chamar montarPacote() a cada tick e entregar tudo que chegar em
+ * receberPacote(). As duas pontas precisam usar a mesma semente e o mesmo
+ * atrasoEntrada. O cabeçalho do pacote é little-endian, sem preenchimento.
+ */
+class SessaoRollback {
+public:
+    static constexpr uint32_t TAMANHO_HISTORICO = 64;
+    static constexpr uint32_t MAX_PREDICAO = 12;
+
+    /**
+     * @param semente - Semente da Partida (igual nas duas pontas)
+     * @param jogadorLocal - 0 (raquete esquerda) ou 1 (direita)
+     * @param atrasoEntrada - Ticks entre ler a tecla e ela valer na simulação
+     */
+    SessaoRollback(uint64_t semente, int jogadorLocal, uint32_t atrasoEntrada = 2);
+
+    // ========== Simulação ==========
+
+    /**
+     * @brief Corrige previsões erradas e avança um tick
+     * @param teclas - Entrada local no formato do jogador 1 (ENTRADA_P1_CIMA/BAIXO),
+     *                 a sessão desloca para o lado de jogadorLocal
+     * @return false se o tick foi recusado por falta de entradas remotas
+     */
+    bool avancar(uint8_t teclas);
+
+    /// Só aplica as correções pendentes (para sincronizar sem avançar)
+    void corrigir();
+
+    // ========== Rede ==========
+
+    /// Escreve o pacote a enviar neste tick; retorna o tamanho (0 se não couber)
+    size_t montarPacote(uint8_t* buffer, size_t capacidade) const;
+
+    /// Processa um pacote recebido; pacotes inválidos ou velhos são ignorados
+    void receberPacote(const uint8_t* dados, size_t tamanho);
+
+    // ========== Consulta ==========
+
+    const Partida& getPartida() const { return partida; }
+    uint32_t getTick() const { return tickAtual; }
+    /// Ticks cujas entradas remotas já chegaram (antes disso o estado é definitivo)
+    uint32_t getConfirmados() const { return remotasConfirmadas; }
+    bool temCorrecaoPendente() const { return primeiraErrada < tickAtual; }
+    const EstatisticasRollback& getEstatisticas() const { return estatisticas; }
+
+private:
+    static constexpr uint32_t SEM_ERRO = 0xFFFFFFFFu;
+
+    Partida partida;
+    int jogadorLocal;
+    uint32_t atrasoEntrada;
+
+    uint32_t tickAtual;             ///< Próximo tick a simular
+    uint32_t locaisConhecidas;      ///< Entradas locais gravadas: ticks [0, locaisConhecidas)
+    uint32_t remotasConfirmadas;    ///< Entradas remotas recebidas em sequência
+    uint32_t locaisConfirmadas;     ///< Quantas entradas locais o outro lado já tem (ack)
+    uint32_t primeiraErrada;        ///< Primeiro tick simulado com previsão errada
+
+    // Anéis indexados por tick % TAMANHO_HISTORICO
+    EstadoPartida snapshots[TAMANHO_HISTORICO];   ///< Estado antes de simular o tick
+    uint8_t entradaLocal[TAMANHO_HISTORICO];
+    uint8_t entradaRemota[TAMANHO_HISTORICO];
+    uint8_t previsaoUsada[TAMANHO_HISTORICO];     ///< Entrada remota usada ao simular o tick
+
+    EstatisticasRollback estatisticas;
+
+    void simularTick(uint32_t tick);
+    uint8_t remotaParaTick(uint32_t tick) const;   ///< Confirmada ou prevista
+};
+
+#endif // SESSAO_ROLLBACK_HPP
@@ -0,0 +1,106 @@
+#include "TransporteUDP.hpp"
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Pacotes em voo no simulador; acima disso os mais novos são descartados
+static const size_t MAX_PACOTES_EM_VOO = 1024;
+
+static sockaddr_in enderecoLocal(uint16_t porta) {
+    sockaddr_in endereco;
+    std::memset(&endereco, 0, sizeof(endereco));
+    endereco.sin_family = AF_INET;
+    endereco.sin_port = htons(porta);
+    endereco.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return endereco;
+}
+
+// ========== Construtor e Destrutor ==========
+
+TransporteUDP::TransporteUDP(uint16_t portaLocal, uint16_t portaRemota, CondicoesRede condicoes,
+                             uint32_t semente)
+    : socketUDP(-1), portaRemota(portaRemota), condicoes(condicoes), gerador(semente),
+      enviados(0), descartados(0) {
+    fila.reserve(MAX_PACOTES_EM_VOO);
+
+    int s = socket(AF_INET, SOCK_DGRAM, 0);
+    if (s < 0) {
+        std::cerr << "TransporteUDP: socket falhou: " << std::strerror(errno) << std::endl;
+        return;
+    }
+    sockaddr_in endereco = enderecoLocal(portaLocal);
+    if (bind(s, reinterpret_cast<sockaddr*>(&endereco), sizeof(endereco)) < 0) {
+        std::cerr << "TransporteUDP: bind na porta " << portaLocal << " falhou: "
+                  << std::strerror(errno) << std::endl;
+        close(s);
+        return;
+    }
+    fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+    socketUDP = s;
+}
+
+TransporteUDP::~TransporteUDP() {
+    if (socketUDP >= 0) close(socketUDP);
+}
+
+// ========== Envio ==========
+
+bool TransporteUDP::enviar(const void* dados, size_t tamanho) {
+    if (!aberto() || tamanho > MAX_PACOTE) return false;
+    enviados++;
+
+    std::uniform_real_distribution<float> uniforme(0.0f, 1.0f);
+    if (uniforme(gerador) < condicoes.perda || fila.size() >= MAX_PACOTES_EM_VOO) {
+        descartados++;
+        return true;   // para quem envia, um pacote perdido não é erro
+    }
+
+    float atrasoMs = condicoes.latenciaMs + (uniforme(gerador) * 2.0f - 1.0f) * condicoes.jitterMs;
+    if (atrasoMs < 0.0f) atrasoMs = 0.0f;
+
+    PacoteAtrasado pacote;
+    pacote.entrega = relogio::now() +
+        std::chrono::duration_cast<relogio::duration>(std::chrono::duration<float, std::milli>(atrasoMs));
+    pacote.tamanho = tamanho;
+    std::memcpy(pacote.dados, dados, tamanho);
+    fila.push_back(pacote);
+
+    // sem atraso nenhum não há por que esperar o próximo atualizar()
+    if (atrasoMs == 0.0f) atualizar();
+    return true;
+}
+
+void TransporteUDP::atualizar() {
+    if (fila.empty()) return;
+    auto agora = relogio::now();
+    // remove no lugar os que venceram; com jitter a ordem de saída pode trocar
+    size_t mantidos = 0;
+    for (size_t i = 0; i < fila.size(); i++) {
+        if (fila[i].entrega <= agora) {
+            enviarAgora(fila[i].dados, fila[i].tamanho);
+        } else {
+            if (mantidos != i) fila[mantidos] = fila[i];
+            mantidos++;
+        }
+    }
+    fila.resize(mantidos);
+}
+
+void TransporteUDP::enviarAgora(const uint8_t* dados, size_t tamanho) {
+    sockaddr_in destino = enderecoLocal(portaRemota);
+    // UDP: se o buffer do sistema estiver cheio o pacote some, como na rede real
+    sendto(socketUDP, dados, tamanho, 0, reinterpret_cast<sockaddr*>(&destino), sizeof(destino));
+}
+
+// ========== Recebimento ==========
+
+size_t TransporteUDP::receber(void* buffer, size_t capacidade) {
+    if (!aberto()) return 0;
+    ssize_t lidos = recv(socketUDP, buffer, capacidade, 0);
+    return lidos > 0 ? static_cast<size_t>(lidos) : 0;
+}
@@ -0,0 +1,82 @@
+#ifndef TRANSPORTE_UDP_HPP
+#define TRANSPORTE_UDP_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * @struct CondicoesRede
+ * @brief O que o simulador aplica a cada pacote enviado
+ */
+struct CondicoesRede {
+    float latenciaMs = 0.0f;   ///< Atraso fixo de ida
+    float jitterMs = 0.0f;     ///< Variação uniforme em ±jitter (pode reordenar pacotes)
+    float perda = 0.0f;        ///< Probabilidade de descartar o pacote (0 a 1)
+};
+
+/**
+ * @class TransporteUDP
+ * @brief Socket UDP em 127.0.0.1 com simulador de latência, jitter e perda
+ *
+ * Liga-se a uma porta local e envia para uma porta remota na mesma máquina,
+ * então dois TransporteUDP com as portas trocadas formam uma conexão
+ * completa em um só processo (ou em dois, um por jogador).
+ *
+ * enviar() não manda na hora: o pacote vai para uma fila com o instante de
+ * entrega sorteado segundo as CondicoesRede (ou é descartado); atualizar()
+ * manda de fato os que já venceram. Chame atualizar() a cada quadro.
+ * O socket é não bloqueante: receber() retorna 0 se não houver nada.
+ */
+class TransporteUDP {
+public:
+    static const size_t MAX_PACOTE = 512;
+
+    TransporteUDP(uint16_t portaLocal, uint16_t portaRemota, CondicoesRede condicoes = CondicoesRede(),
+                  uint32_t semente = 1);
+    ~TransporteUDP();
+
+    TransporteUDP(const TransporteUDP&) = delete;
+    TransporteUDP& operator=(const TransporteUDP&) = delete;
+
+    /// false se o socket não pôde ser criado ou ligado à porta
+    bool aberto() const { return socketUDP >= 0; }
+
+    /// Agenda o envio (sujeito ao simulador); pacotes maiores que MAX_PACOTE são recusados
+    bool enviar(const void* dados, size_t tamanho);
+
+    /// Envia os pacotes cujo atraso simulado já passou
+    void atualizar();
+
+    /// Lê um pacote recebido; retorna o tamanho (0 se não houver)
+    size_t receber(void* buffer, size_t capacidade);
+
+    void setCondicoes(const CondicoesRede& novas) { condicoes = novas; }
+
+    // ========== Estatísticas ==========
+    uint64_t getEnviados() const { return enviados; }
+    uint64_t getDescartados() const { return descartados; }
+
+private:
+    using relogio = std::chrono::steady_clock;
+
+    struct PacoteAtrasado {
+        relogio::time_point entrega;
+        size_t tamanho;
+        uint8_t dados[MAX_PACOTE];
+    };
+
+    int socketUDP;
+    uint16_t portaRemota;
+    CondicoesRede condicoes;
+    std::mt19937 gerador;
+    std::vector<PacoteAtrasado> fila;   ///< Capacidade reservada no construtor
+    uint64_t enviados;
+    uint64_t descartados;
+
+    void enviarAgora(const uint8_t* dados, size_t tamanho);
+};
+
+#endif // TRANSPORTE_UDP_HPP
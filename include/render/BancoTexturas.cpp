@@ -0,0 +1,105 @@
+#include "BancoTexturas.hpp"
+#include "ImagemQOI.hpp"
+#include <iostream>
+#include <vector>
+
+// Materiais com camada no array (na ordem das camadas)
+static const textura MATERIAIS[] = { textura::wood, textura::metal };
+static const int NUM_CAMADAS = sizeof(MATERIAIS) / sizeof(MATERIAIS[0]);
+
+static const char* DIRETORIO_TEXTURAS = "assets/texturas/";
+
+// ========== Acesso ==========
+
+BancoTexturas& BancoTexturas::instancia() {
+    static BancoTexturas banco;
+    return banco;
+}
+
+int BancoTexturas::camada(textura t) {
+    for (int i = 0; i < NUM_CAMADAS; i++) {
+        if (MATERIAIS[i] == t) return i;
+    }
+    return -1;
+}
+
+const char* BancoTexturas::nome(textura t) {
+    switch (t) {
+        case textura::wood:  return "wood";
+        case textura::metal: return "metal";
+        case textura::none:
+        default:             return "none";
+    }
+}
+
+// ========== Criação ==========
+
+BancoTexturas::BancoTexturas() : texturaArray(0) {
+    // log2(128) + 1 níveis de mipmap
+    int niveis = 1;
+    for (int t = TAMANHO_CAMADA; t > 1; t /= 2) niveis++;
+
+    glGenTextures(1, &texturaArray);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, texturaArray);
+    for (int nivel = 0, t = TAMANHO_CAMADA; nivel < niveis; nivel++, t = t > 1 ? t / 2 : 1) {
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, nivel, GL_RGBA8, t, t, NUM_CAMADAS, 0,
+                     GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    }
+
+    for (int i = 0; i < NUM_CAMADAS; i++) {
+        carregarCamada(i, std::string(DIRETORIO_TEXTURAS) + nome(MATERIAIS[i]) + ".qoi");
+    }
+
+    // Mipmaps de todas as camadas de uma vez, na GPU
+    glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+}
+
+void BancoTexturas::carregarCamada(int camada, const std::string& caminho) {
+    const int t = TAMANHO_CAMADA;
+    std::vector<unsigned char> pixels(static_cast<size_t>(t) * t * 4);
+
+    Imagem imagem;
+    if (carregarQOI(caminho, imagem)) {
+        // Reamostra (vizinho mais próximo) se o arquivo tiver outro tamanho;
+        // a linha 0 da imagem é o topo, a do OpenGL é a base
+        // Contas em size_t: uma imagem alta e estreita (até 400M pixels)
+        // estouraria o int em (t - 1 - y) * altura
+        size_t largura = static_cast<size_t>(imagem.largura);
+        size_t altura = static_cast<size_t>(imagem.altura);
+        for (int y = 0; y < t; y++) {
+            size_t origemY = static_cast<size_t>(t - 1 - y) * altura / t;
+            for (int x = 0; x < t; x++) {
+                size_t origemX = static_cast<size_t>(x) * largura / t;
+                const unsigned char* o = &imagem.pixels[(origemY * largura + origemX) * 4];
+                unsigned char* d = &pixels[(static_cast<size_t>(y) * t + x) * 4];
+                d[0] = o[0]; d[1] = o[1]; d[2] = o[2]; d[3] = o[3];
+            }
+        }
+    } else {
+        std::cerr << "AVISO: Textura '" << caminho << "' não encontrada ou inválida" << std::endl;
+        for (int y = 0; y < t; y++) {
+            for (int x = 0; x < t; x++) {
+                bool claro = ((x / 16) + (y / 16)) % 2 == 0;
+                unsigned char* d = &pixels[(static_cast<size_t>(y) * t + x) * 4];
+                d[0] = claro ? 255 : 0;
+                d[1] = 0;
+                d[2] = claro ? 255 : 0;
+                d[3] = 255;
+            }
+        }
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, camada, t, t, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+}
+
+void BancoTexturas::liberar() {
+    if (texturaArray) {
+        glDeleteTextures(1, &texturaArray);
+        texturaArray = 0;
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef BANCO_TEXTURAS_HPP
+#define BANCO_TEXTURAS_HPP
+
+#include <GL/glew.h>
+#include <string>
+#include "../visual.hpp"
+
+/**
+ * @class BancoTexturas
+ * @brief Todos os materiais do enum textura em um único GL_TEXTURE_2D_ARRAY
+ *
+ * Cada material ocupa uma camada do array (mesmo tamanho, com mipmaps).
+ * O vértice de uma forma texturizada leva (u, v, camada), então formas
+ * de materiais diferentes usam a mesma textura e o mesmo shader: nada de
+ * trocar textura entre elas, e podem ir no mesmo draw quando agrupadas.
+ *
+ * As imagens vêm de assets/texturas/<nome>.qoi; se o arquivo não existir,
+ * a camada recebe um xadrez magenta para o erro ficar visível.
+ *
+ * Criado na primeira chamada a instancia() (precisa do contexto OpenGL ativo).
+ */
+class BancoTexturas {
+public:
+    static const int TAMANHO_CAMADA = 128;   ///< Largura e altura de cada camada em pixels
+
+    /// O banco da aplicação (criado sob demanda)
+    static BancoTexturas& instancia();
+
+    /// ID do GL_TEXTURE_2D_ARRAY
+    GLuint getTextura() const { return texturaArray; }
+
+    /// Camada de um material (-1 para textura::none)
+    static int camada(textura t);
+
+    /// Nome do material (também o nome do arquivo)
+    static const char* nome(textura t);
+
+    /**
+     * @brief Libera a textura (chamar antes de destruir o contexto)
+     *
+     * O destrutor não chama OpenGL: o banco é estático e seria destruído
+     * depois do glfwTerminate().
+     */
+    void liberar();
+
+private:
+    BancoTexturas();
+
+    GLuint texturaArray;
+
+    void carregarCamada(int camada, const std::string& caminho);
+};
+
+#endif // BANCO_TEXTURAS_HPP
@@ -0,0 +1,356 @@
+#include "CapturaQuadros.hpp"
+#include "ImagemPNG.hpp"
+#include "ListaComandos.hpp"
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+// Leituras pedidas antes ainda podem não ter chegado ao contexto (a ThreadRender
+// está até dois quadros atrás): continua registrando a coleta por esse tempo
+static const int QUADROS_ATE_O_CONTEXTO = 2;
+
+static void criarDiretorioDe(const char* caminho) {
+    std::error_code erro;
+    std::filesystem::path pai = std::filesystem::path(caminho).parent_path();
+    if (!pai.empty()) std::filesystem::create_directories(pai, erro);
+}
+
+// ========== Construtor e Destrutor ==========
+
+CapturaQuadros::CapturaQuadros(int largura, int altura, size_t quadrosNaFila)
+    : largura(largura),
+      altura(altura),
+      bytesQuadro(static_cast<size_t>(largura) * altura * 4),
+      fotoPendente{},
+      videoAtual(0),
+      ultimaGeracaoVideo(0),
+      coletasRestantes(0),
+      primeiraEmVoo(0),
+      numEmVoo(0),
+      encerrado(false),
+      quadros(quadrosNaFila < 1 ? 1 : quadrosNaFila),
+      fila(quadros.size()),
+      inicioFila(0),
+      tamanhoFila(0),
+      rodando(true),
+      geracaoVideo(0),
+      quadrosPorSegundo(60),
+      arquivoVideo(nullptr),
+      videoAberto(0)
+{
+    for (LeituraEmVoo& leitura : leituras) {
+        glGenBuffers(1, &leitura.pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, leitura.pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(bytesQuadro), nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    livres.reserve(quadros.size());
+    for (size_t i = 0; i < quadros.size(); i++) {
+        quadros[i].pixels.resize(bytesQuadro);
+        livres.push_back(static_cast<int>(i));
+    }
+    size_t larguraCor = (largura + 1) / 2, alturaCor = (altura + 1) / 2;
+    planos.resize(static_cast<size_t>(largura) * altura + 2 * larguraCor * alturaCor);
+
+    // A thread é criada por último: todos os membros já estão prontos
+    codificador = std::thread(&CapturaQuadros::laco, this);
+}
+
+CapturaQuadros::~CapturaQuadros() {
+    encerrar();
+}
+
+// ========== Pedidos (thread do jogo) ==========
+
+bool CapturaQuadros::fotografar(const char* caminho) {
+    size_t tamanho = std::strlen(caminho);
+    if (tamanho == 0 || tamanho >= MAX_CAMINHO) return false;
+    std::memcpy(fotoPendente, caminho, tamanho + 1);
+    return true;
+}
+
+void CapturaQuadros::iniciarVideo(const std::string& caminho, int quadrosPorSegundoVideo) {
+    {
+        std::lock_guard<std::mutex> lk(trava);
+        caminhoVideo = caminho;
+        quadrosPorSegundo = quadrosPorSegundoVideo > 0 ? quadrosPorSegundoVideo : 60;
+        geracaoVideo = ++ultimaGeracaoVideo;
+    }
+    videoAtual = ultimaGeracaoVideo;
+}
+
+void CapturaQuadros::pararVideo() {
+    videoAtual = 0;
+}
+
+CapturaQuadros::Pedido CapturaQuadros::montarPedido(GLuint framebuffer) {
+    Pedido pedido;
+    std::memcpy(pedido.caminhoFoto, fotoPendente, MAX_CAMINHO);
+    pedido.video = videoAtual;
+    pedido.framebuffer = framebuffer;
+    fotoPendente[0] = '\0';
+    return pedido;
+}
+
+void CapturaQuadros::registrar(ListaComandos& lista, GLuint framebuffer) {
+    if (fotoPendente[0] != '\0' || videoAtual != 0) {
+        coletasRestantes = QUADROS_ATE_O_CONTEXTO;
+    } else if (coletasRestantes > 0) {
+        coletasRestantes--;
+    } else if (numEmVoo.load(std::memory_order_relaxed) == 0) {
+        return;   // nada pedido nem em voo: nenhum comando no quadro
+    }
+    Pedido pedido = montarPedido(framebuffer);
+    lista.chamarComDados(&CapturaQuadros::executarRegistrado, this, &pedido, sizeof(pedido));
+}
+
+void CapturaQuadros::capturar(GLuint framebuffer) {
+    executar(montarPedido(framebuffer));
+}
+
+// ========== Contexto OpenGL ==========
+
+void CapturaQuadros::executarRegistrado(void* contexto, const void* dados) {
+    static_cast<CapturaQuadros*>(contexto)->executar(*static_cast<const Pedido*>(dados));
+}
+
+void CapturaQuadros::executar(const Pedido& pedido) {
+    bool foto = pedido.caminhoFoto[0] != '\0';
+    if (encerrado || (!foto && pedido.video == 0 && numEmVoo.load(std::memory_order_relaxed) == 0)) return;
+    auto inicio = std::chrono::steady_clock::now();
+
+    coletar(false);
+
+    bool descartou = false;
+    if (foto || pedido.video != 0) {
+        if (numEmVoo.load(std::memory_order_relaxed) == NUM_PBOS) {
+            // Vídeo não espera a GPU; uma foto espera só a leitura mais antiga
+            if (foto) {
+                LeituraEmVoo& antiga = leituras[primeiraEmVoo];
+                glClientWaitSync(antiga.cerca, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000ull);
+                entregar(antiga);
+            } else {
+                descartou = true;
+            }
+        }
+        if (!descartou) {
+            int indice = (primeiraEmVoo + numEmVoo.load(std::memory_order_relaxed)) % NUM_PBOS;
+            LeituraEmVoo& leitura = leituras[indice];
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, pedido.framebuffer);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, leitura.pbo);
+            // Com um PBO ligado o último argumento é um offset: a cópia fica na GPU
+            glReadPixels(0, 0, largura, altura, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            if (pedido.framebuffer != 0) glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+            leitura.cerca = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            std::memcpy(leitura.caminhoFoto, pedido.caminhoFoto, MAX_CAMINHO);
+            leitura.video = pedido.video;
+            numEmVoo.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+    std::lock_guard<std::mutex> lk(trava);
+    if (descartou) estatisticas.descartados++;
+    else if (foto || pedido.video != 0) estatisticas.lidos++;
+    estatisticas.chamadas++;
+    estatisticas.custoTotalMs += ms;
+    if (ms > estatisticas.custoMaximoMs) estatisticas.custoMaximoMs = ms;
+}
+
+void CapturaQuadros::coletar(bool esperar) {
+    while (numEmVoo.load(std::memory_order_relaxed) > 0) {
+        LeituraEmVoo& leitura = leituras[primeiraEmVoo];
+        GLuint64 espera = esperar ? 1000000000ull : 0;
+        GLenum estado = glClientWaitSync(leitura.cerca, esperar ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, espera);
+        if (estado == GL_TIMEOUT_EXPIRED && !esperar) break;   // ainda na GPU: tenta no próximo quadro
+        entregar(leitura);
+    }
+}
+
+void CapturaQuadros::entregar(LeituraEmVoo& leitura) {
+    // Fotos e o encerramento esperam o codificador liberar um buffer; vídeo descarta
+    bool esperarBuffer = encerrado || leitura.caminhoFoto[0] != '\0';
+    int indice = -1;
+    {
+        std::unique_lock<std::mutex> lk(trava);
+        if (esperarBuffer) mudou.wait(lk, [this] { return !livres.empty(); });
+        if (!livres.empty()) {
+            indice = livres.back();
+            livres.pop_back();
+        } else {
+            estatisticas.descartados++;
+        }
+    }
+
+    if (indice >= 0) {
+        QuadroCapturado& quadro = quadros[indice];
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, leitura.pbo);
+        const void* mapa = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(bytesQuadro), GL_MAP_READ_BIT);
+        if (mapa) {
+            std::memcpy(quadro.pixels.data(), mapa, bytesQuadro);
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        std::memcpy(quadro.caminhoFoto, leitura.caminhoFoto, MAX_CAMINHO);
+        quadro.video = leitura.video;
+
+        {
+            std::lock_guard<std::mutex> lk(trava);
+            if (mapa) {
+                fila[(inicioFila + tamanhoFila) % fila.size()] = indice;
+                tamanhoFila++;
+            } else {
+                livres.push_back(indice);
+                estatisticas.descartados++;
+            }
+        }
+        mudou.notify_all();
+    }
+
+    glDeleteSync(leitura.cerca);
+    leitura.cerca = nullptr;
+    primeiraEmVoo = (primeiraEmVoo + 1) % NUM_PBOS;
+    numEmVoo.fetch_sub(1, std::memory_order_relaxed);
+}
+
+// ========== Fim ==========
+
+void CapturaQuadros::encerrar() {
+    if (encerrado) return;
+    encerrado = true;
+
+    coletar(true);
+    for (LeituraEmVoo& leitura : leituras) {
+        glDeleteBuffers(1, &leitura.pbo);
+        leitura.pbo = 0;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(trava);
+        rodando = false;
+    }
+    mudou.notify_all();
+    codificador.join();
+}
+
+EstatisticasCaptura CapturaQuadros::getEstatisticas() const {
+    std::lock_guard<std::mutex> lk(trava);
+    return estatisticas;
+}
+
+void CapturaQuadros::relatorio(std::ostream& saida) const {
+    EstatisticasCaptura e = getEstatisticas();
+    char linha[192];
+    std::snprintf(linha, sizeof(linha),
+                  "Captura: %llu lidos, %llu gravados, %llu descartados | custo no contexto: média %.3f ms, máx %.3f ms",
+                  static_cast<unsigned long long>(e.lidos), static_cast<unsigned long long>(e.gravados),
+                  static_cast<unsigned long long>(e.descartados),
+                  e.chamadas ? e.custoTotalMs / e.chamadas : 0.0, e.custoMaximoMs);
+    saida << linha << std::endl;
+}
+
+// ========== Thread do Codificador ==========
+
+void CapturaQuadros::laco() {
+    while (true) {
+        int indice;
+        {
+            std::unique_lock<std::mutex> lk(trava);
+            mudou.wait(lk, [this] { return tamanhoFila > 0 || !rodando; });
+
+            // Ao encerrar, ainda grava o que está na fila
+            if (tamanhoFila == 0) break;
+            indice = fila[inicioFila];
+            inicioFila = (inicioFila + 1) % fila.size();
+            tamanhoFila--;
+        }
+
+        const QuadroCapturado& quadro = quadros[indice];
+        if (quadro.caminhoFoto[0] != '\0') {
+            criarDiretorioDe(quadro.caminhoFoto);
+            if (!salvarPNG(quadro.caminhoFoto, quadro.pixels.data(), largura, altura, true)) {
+                std::cerr << "AVISO: não foi possível gravar " << quadro.caminhoFoto << std::endl;
+            }
+        }
+        if (quadro.video != 0) gravarQuadroVideo(quadro);
+
+        {
+            std::lock_guard<std::mutex> lk(trava);
+            livres.push_back(indice);
+            estatisticas.gravados++;
+        }
+        mudou.notify_all();
+    }
+
+    if (arquivoVideo) {
+        std::fclose(arquivoVideo);
+        arquivoVideo = nullptr;
+    }
+}
+
+void CapturaQuadros::gravarQuadroVideo(const QuadroCapturado& quadro) {
+    // Geração nova: fecha o vídeo anterior e abre o pedido mais recente
+    if (quadro.video != videoAberto) {
+        if (arquivoVideo) {
+            std::fclose(arquivoVideo);
+            arquivoVideo = nullptr;
+        }
+        std::string caminho;
+        int fps;
+        {
+            std::lock_guard<std::mutex> lk(trava);
+            if (quadro.video != geracaoVideo) return;   // sobra de um vídeo já substituído
+            caminho = caminhoVideo;
+            fps = quadrosPorSegundo;
+        }
+        videoAberto = quadro.video;
+        criarDiretorioDe(caminho.c_str());
+        arquivoVideo = std::fopen(caminho.c_str(), "wb");
+        if (!arquivoVideo) {
+            std::cerr << "AVISO: não foi possível criar o vídeo " << caminho << std::endl;
+            return;
+        }
+        // C420jpeg: 4:2:0 com luma e croma em faixa completa (BT.601)
+        std::fprintf(arquivoVideo, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", largura, altura, fps);
+    }
+    if (!arquivoVideo) return;
+
+    // RGBA de baixo para cima -> planos Y, Cb, Cr de cima para baixo
+    const size_t larguraCor = (largura + 1) / 2, alturaCor = (altura + 1) / 2;
+    unsigned char* planoY = planos.data();
+    unsigned char* planoCb = planoY + static_cast<size_t>(largura) * altura;
+    unsigned char* planoCr = planoCb + larguraCor * alturaCor;
+    const unsigned char* px = quadro.pixels.data();
+    auto pixel = [&](int x, int y) { return px + (static_cast<size_t>(altura - 1 - y) * largura + x) * 4; };
+
+    for (int y = 0; y < altura; y++) {
+        const unsigned char* p = pixel(0, y);
+        unsigned char* destino = planoY + static_cast<size_t>(y) * largura;
+        for (int x = 0; x < largura; x++, p += 4) destino[x] = static_cast<unsigned char>((77 * p[0] + 150 * p[1] + 29 * p[2] + 128) >> 8);
+    }
+    for (size_t cy = 0; cy < alturaCor; cy++) {
+        int y0 = static_cast<int>(2 * cy), y1 = y0 + 1 < altura ? y0 + 1 : y0;
+        for (size_t cx = 0; cx < larguraCor; cx++) {
+            int x0 = static_cast<int>(2 * cx), x1 = x0 + 1 < largura ? x0 + 1 : x0;
+            const unsigned char* a = pixel(x0, y0);
+            const unsigned char* b = pixel(x1, y0);
+            const unsigned char* c = pixel(x0, y1);
+            const unsigned char* d = pixel(x1, y1);
+            int r = a[0] + b[0] + c[0] + d[0];
+            int g = a[1] + b[1] + c[1] + d[1];
+            int bl = a[2] + b[2] + c[2] + d[2];
+            // Somas de 4 pixels: >> 10 divide por 4 * 256; +131072 é o deslocamento de 128
+            int cb = (-43 * r - 85 * g + 128 * bl + 131072 + 512) >> 10;
+            int cr = (128 * r - 107 * g - 21 * bl + 131072 + 512) >> 10;
+            planoCb[cy * larguraCor + cx] = static_cast<unsigned char>(cb > 255 ? 255 : cb);
+            planoCr[cy * larguraCor + cx] = static_cast<unsigned char>(cr > 255 ? 255 : cr);
+        }
+    }
+
+    std::fputs("FRAME\n", arquivoVideo);
+    std::fwrite(planos.data(), 1, planos.size(), arquivoVideo);
+    std::fflush(arquivoVideo);   // o arquivo fica legível enquanto grava
+}
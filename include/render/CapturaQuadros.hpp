@@ -0,0 +1,168 @@
+#ifndef CAPTURA_QUADROS_HPP
+#define CAPTURA_QUADROS_HPP
+
+#include <GL/glew.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ListaComandos;
+
+/**
+ * @struct EstatisticasCaptura
+ * @brief Contadores da captura; o custo é o tempo gasto na thread do contexto
+ */
+struct EstatisticasCaptura {
+    uint64_t lidos = 0;          ///< glReadPixels disparados
+    uint64_t gravados = 0;       ///< Quadros já escritos em disco pelo codificador
+    uint64_t descartados = 0;    ///< Sem PBO livre (vídeo) ou codificador atrasado
+    uint64_t chamadas = 0;       ///< Quadros em que a captura fez algo no contexto
+    double custoTotalMs = 0.0;
+    double custoMaximoMs = 0.0;
+};
+
+/**
+ * @class CapturaQuadros
+ * @brief Capturas de tela (PNG) e vídeo (Y4M) sem travar o quadro
+ *
+ * A leitura do framebuffer vai para um anel de NUM_PBOS pixel buffers
+ * (GL_PIXEL_PACK_BUFFER): o glReadPixels só agenda a cópia na GPU e
+ * retorna. Nos quadros seguintes, quando a cerca (glFenceSync) daquela
+ * leitura já passou, o PBO é mapeado e os pixels são copiados para um
+ * buffer do pool, que uma thread própria codifica e grava em disco.
+ * Nada disso espera a GPU nem o disco: se o anel ou o pool estiverem
+ * cheios, o quadro de vídeo é descartado (e contado). Só uma foto pedida
+ * com o anel cheio espera a leitura mais antiga terminar.
+ *
+ * O pool de buffers é alocado no construtor; capturar não aloca.
+ *
+ * Uso direto (contexto nesta thread), depois de desenhar e antes do swap:
+ * @code
+ * captura.fotografar("capturas/tela.png");
+ * captura.capturar();
+ * @endcode
+ * Com a ThreadRender, captura.registrar(lista) como último comando do quadro.
+ */
+class CapturaQuadros {
+public:
+    static const int NUM_PBOS = 3;
+    static const size_t MAX_CAMINHO = 128;
+
+    /**
+     * @brief Cria os PBOs e inicia a thread do codificador (precisa do contexto OpenGL ativo)
+     *
+     * @param largura, altura - Área lida a partir de (0, 0)
+     * @param quadrosNaFila - Buffers do pool entre a leitura e o disco
+     */
+    CapturaQuadros(int largura, int altura, size_t quadrosNaFila = 6);
+
+    /// Chama encerrar() se ainda não foi chamado (precisa do contexto)
+    ~CapturaQuadros();
+
+    CapturaQuadros(const CapturaQuadros&) = delete;
+    CapturaQuadros& operator=(const CapturaQuadros&) = delete;
+
+    // ========== Pedidos (thread do jogo) ==========
+
+    /// O próximo quadro capturado vira um PNG; false se o caminho não couber
+    bool fotografar(const char* caminho);
+
+    /// Grava todos os quadros seguintes em um Y4M (4:2:0), até pararVideo()
+    void iniciarVideo(const std::string& caminho, int quadrosPorSegundo = 60);
+    void pararVideo();
+    bool gravandoVideo() const { return videoAtual != 0; }
+
+    /// Grava a captura pedida (se houver) na lista; deve ser o último comando antes do swap
+    void registrar(ListaComandos& lista, GLuint framebuffer = 0);
+
+    /// Igual a registrar(), executando na hora (contexto nesta thread)
+    void capturar(GLuint framebuffer = 0);
+
+    // ========== Fim ==========
+
+    /**
+     * @brief Espera as leituras em voo, esvazia a fila e junta a thread
+     *
+     * Precisa do contexto OpenGL ativo na thread que chama.
+     */
+    void encerrar();
+
+    EstatisticasCaptura getEstatisticas() const;
+    void relatorio(std::ostream& saida) const;
+
+private:
+    /// Copiado para a lista de comandos: o que capturar neste quadro
+    struct Pedido {
+        char caminhoFoto[MAX_CAMINHO];   ///< Vazio = sem foto
+        uint32_t video;                  ///< Geração do vídeo (0 = sem vídeo)
+        GLuint framebuffer;
+    };
+
+    struct LeituraEmVoo {
+        GLuint pbo = 0;
+        GLsync cerca = nullptr;
+        char caminhoFoto[MAX_CAMINHO] = {};
+        uint32_t video = 0;
+    };
+
+    struct QuadroCapturado {
+        std::vector<unsigned char> pixels;
+        char caminhoFoto[MAX_CAMINHO] = {};
+        uint32_t video = 0;
+    };
+
+    int largura;
+    int altura;
+    size_t bytesQuadro;
+
+    // Estado dos pedidos (thread do jogo)
+    char fotoPendente[MAX_CAMINHO];
+    uint32_t videoAtual;
+    uint32_t ultimaGeracaoVideo;
+    int coletasRestantes;             ///< Quadros que ainda registram a coleta após o último pedido
+
+    // Anel de PBOs (thread do contexto)
+    LeituraEmVoo leituras[NUM_PBOS];
+    int primeiraEmVoo;
+    std::atomic<int> numEmVoo;        ///< Lido pela thread do jogo para saber se ainda há o que coletar
+    bool encerrado;
+
+    // Pool e fila do codificador (trava)
+    std::vector<QuadroCapturado> quadros;
+    std::vector<int> livres;
+    std::vector<int> fila;            ///< Anel com a capacidade do pool
+    size_t inicioFila;
+    size_t tamanhoFila;
+    bool rodando;
+    std::string caminhoVideo;
+    uint32_t geracaoVideo;
+    int quadrosPorSegundo;
+    EstatisticasCaptura estatisticas;
+    mutable std::mutex trava;
+    std::condition_variable mudou;
+    std::thread codificador;
+
+    // Só a thread do codificador
+    FILE* arquivoVideo;
+    uint32_t videoAberto;
+    std::vector<unsigned char> planos;
+
+    Pedido montarPedido(GLuint framebuffer);
+    void executar(const Pedido& pedido);
+    static void executarRegistrado(void* contexto, const void* dados);
+
+    /// Entrega ao codificador as leituras já prontas (ou todas, esperando)
+    void coletar(bool esperar);
+    void entregar(LeituraEmVoo& leitura);
+
+    void laco();
+    void gravarQuadroVideo(const QuadroCapturado& quadro);
+};
+
+#endif // CAPTURA_QUADROS_HPP
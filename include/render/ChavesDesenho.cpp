@@ -0,0 +1,66 @@
+#include "ChavesDesenho.hpp"
+#include <cstring>
+
+// ========== Chave ==========
+
+uint64_t montarChave(const CamposChave& campos) {
+    float p = campos.profundidade < 0.0f ? 0.0f : (campos.profundidade > 1.0f ? 1.0f : campos.profundidade);
+    uint64_t profundidade = static_cast<uint64_t>(p * 65535.0f + 0.5f);
+
+    uint64_t chave = static_cast<uint64_t>(campos.camada) << 56;
+    // Sem teste de profundidade: longe primeiro, para o perto cobrir
+    if (!campos.translucido) {
+        chave |= static_cast<uint64_t>(campos.programa) << 39;
+        chave |= static_cast<uint64_t>(campos.textura) << 23;
+        chave |= (0xFFFFull - profundidade) << 7;
+    } else {
+        // Aqui a profundidade vem antes do estado: a mistura depende da ordem
+        chave |= 1ull << 55;
+        chave |= (0xFFFFull - profundidade) << 39;
+        chave |= static_cast<uint64_t>(campos.programa) << 23;
+        chave |= static_cast<uint64_t>(campos.textura) << 7;
+    }
+    return chave;
+}
+
+// ========== Ordenação ==========
+
+void ordenarChaves(ItemOrdenacao* itens, ItemOrdenacao* temporario, size_t n) {
+    if (n < 2) return;
+
+    // Os 8 histogramas de uma vez
+    uint32_t contagem[8][256];
+    std::memset(contagem, 0, sizeof(contagem));
+    for (size_t i = 0; i < n; i++) {
+        uint64_t chave = itens[i].chave;
+        for (int byte = 0; byte < 8; byte++) {
+            contagem[byte][(chave >> (byte * 8)) & 0xFF]++;
+        }
+    }
+
+    ItemOrdenacao* origem = itens;
+    ItemOrdenacao* destino = temporario;
+    for (int byte = 0; byte < 8; byte++) {
+        // Todas as chaves com o mesmo valor neste byte: o passe não muda nada
+        uint32_t* c = contagem[byte];
+        if (c[(origem[0].chave >> (byte * 8)) & 0xFF] == n) continue;
+
+        uint32_t inicio[256];
+        uint32_t soma = 0;
+        for (int valor = 0; valor < 256; valor++) {
+            inicio[valor] = soma;
+            soma += c[valor];
+        }
+        for (size_t i = 0; i < n; i++) {
+            destino[inicio[(origem[i].chave >> (byte * 8)) & 0xFF]++] = origem[i];
+        }
+        ItemOrdenacao* troca = origem;
+        origem = destino;
+        destino = troca;
+    }
+
+    // Número ímpar de passes: o resultado ficou no temporário
+    if (origem != itens) {
+        std::memcpy(itens, origem, n * sizeof(ItemOrdenacao));
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef CHAVES_DESENHO_HPP
+#define CHAVES_DESENHO_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct CamposChave
+ * @brief O que decide a ordem de um desenho, do mais para o menos importante
+ *
+ * Camada primeiro (a ordem do pintor entre camadas é sempre respeitada),
+ * depois opacos antes de translúcidos. Dentro dos opacos a ordem é a que
+ * economiza estado: programa, textura e só então profundidade. Não há
+ * teste de profundidade (quem desenha por último cobre), então nos dois
+ * casos a profundidade entra invertida: longe primeiro. Nos translúcidos
+ * ela vem antes do estado, senão a mistura sai errada.
+ */
+struct CamposChave {
+    uint8_t camada = 0;
+    bool translucido = false;
+    uint16_t programa = 0;     ///< Material (id pequeno: o mesmo para formas que dividem o programa)
+    uint16_t textura = 0;      ///< 0 = sem textura
+    float profundidade = 0.0f; ///< 0 (perto) a 1 (longe), limitada a esse intervalo
+};
+
+/**
+ * @brief Empacota os campos em 64 bits: comparar chaves = comparar os campos na ordem acima
+ *
+ * Bits 63-56 camada, 55 translúcido, depois 3 campos de 16 bits:
+ * programa, textura, profundidade invertida (opacos) ou profundidade
+ * invertida, programa, textura (translúcidos). Os 7 bits de baixo ficam em zero.
+ */
+uint64_t montarChave(const CamposChave& campos);
+
+/// Um desenho na fila: a chave e o índice do item que ela representa
+struct ItemOrdenacao {
+    uint64_t chave;
+    uint32_t indice;
+};
+
+/**
+ * @brief Ordena por chave com radix LSD de 8 bits (estável)
+ *
+ * Um único passe conta os 8 histogramas; as casas de byte em que todas
+ * as chaves são iguais (camadas que não mudam, bits vazios) são puladas.
+ * Linear no número de itens, sem comparação e sem alocar.
+ *
+ * @param itens - Entrada e saída
+ * @param temporario - Espaço para n itens
+ */
+void ordenarChaves(ItemOrdenacao* itens, ItemOrdenacao* temporario, size_t n);
+
+#endif // CHAVES_DESENHO_HPP
@@ -0,0 +1,298 @@
+#include "ImagemPNG.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+
+// ========== CRC-32 e Adler-32 ==========
+
+static uint32_t calcularCRC(const unsigned char* dados, size_t tamanho) {
+    struct Tabela {
+        uint32_t valores[256];
+        Tabela() {
+            for (uint32_t n = 0; n < 256; n++) {
+                uint32_t c = n;
+                for (int k = 0; k < 8; k++) c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+                valores[n] = c;
+            }
+        }
+    };
+    static const Tabela tabela;
+
+    uint32_t crc = 0xffffffffu;
+    for (size_t i = 0; i < tamanho; i++) crc = tabela.valores[(crc ^ dados[i]) & 0xff] ^ (crc >> 8);
+    return crc ^ 0xffffffffu;
+}
+
+static uint32_t calcularAdler(const unsigned char* dados, size_t tamanho) {
+    uint32_t a = 1, b = 0;
+    while (tamanho > 0) {
+        // 5552 é o maior bloco em que b não estoura 32 bits antes do módulo
+        size_t bloco = tamanho < 5552 ? tamanho : 5552;
+        tamanho -= bloco;
+        while (bloco--) {
+            a += *dados++;
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    return (b << 16) | a;
+}
+
+static void escreverBigEndian32(std::vector<unsigned char>& saida, uint32_t valor) {
+    saida.push_back(static_cast<unsigned char>(valor >> 24));
+    saida.push_back(static_cast<unsigned char>(valor >> 16));
+    saida.push_back(static_cast<unsigned char>(valor >> 8));
+    saida.push_back(static_cast<unsigned char>(valor));
+}
+
+// ========== Filtros de Linha ==========
+
+static const size_t BYTES_POR_PIXEL = 4;
+
+static inline int preditorPaeth(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+/// Byte filtrado na coluna x (acima == nullptr na primeira linha)
+static inline unsigned char filtrar(int tipo, const unsigned char* linha, const unsigned char* acima, size_t x) {
+    int a = x >= BYTES_POR_PIXEL ? linha[x - BYTES_POR_PIXEL] : 0;
+    int b = acima ? acima[x] : 0;
+    int c = (acima && x >= BYTES_POR_PIXEL) ? acima[x - BYTES_POR_PIXEL] : 0;
+    switch (tipo) {
+        case 1: return static_cast<unsigned char>(linha[x] - a);
+        case 2: return static_cast<unsigned char>(linha[x] - b);
+        case 3: return static_cast<unsigned char>(linha[x] - ((a + b) >> 1));
+        case 4: return static_cast<unsigned char>(linha[x] - preditorPaeth(a, b, c));
+        default: return linha[x];
+    }
+}
+
+/// Escreve as linhas com o byte do filtro na frente, escolhendo o de menor soma absoluta
+static void filtrarImagem(const unsigned char* rgba, int largura, int altura, bool deBaixoParaCima,
+                          std::vector<unsigned char>& filtrada) {
+    size_t bytesLinha = static_cast<size_t>(largura) * BYTES_POR_PIXEL;
+    filtrada.resize((bytesLinha + 1) * altura);
+    unsigned char* destino = filtrada.data();
+    const unsigned char* acima = nullptr;
+
+    for (int y = 0; y < altura; y++) {
+        int origem = deBaixoParaCima ? altura - 1 - y : y;
+        const unsigned char* linha = rgba + origem * bytesLinha;
+
+        int melhorTipo = 0;
+        unsigned long melhorSoma = ~0ul;
+        for (int tipo = 0; tipo < 5; tipo++) {
+            unsigned long soma = 0;
+            for (size_t x = 0; x < bytesLinha && soma < melhorSoma; x++) {
+                soma += std::abs(static_cast<signed char>(filtrar(tipo, linha, acima, x)));
+            }
+            if (soma < melhorSoma) {
+                melhorSoma = soma;
+                melhorTipo = tipo;
+            }
+        }
+
+        *destino++ = static_cast<unsigned char>(melhorTipo);
+        for (size_t x = 0; x < bytesLinha; x++) *destino++ = filtrar(melhorTipo, linha, acima, x);
+        acima = linha;
+    }
+}
+
+// ========== Deflate (Huffman fixo + LZ77) ==========
+
+namespace {
+
+const int JANELA = 32768;
+const int BITS_HASH = 15;
+const int MAX_CADEIA = 16;     ///< Candidatos testados por posição
+const int MIN_REPETICAO = 3;
+const int MAX_REPETICAO = 258;
+
+const uint16_t BASE_COMPRIMENTO[29] = {3,  4,  5,  6,  7,  8,  9,  10, 11,  13,  15,  17,  19,  23, 27,
+                                       31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+const uint8_t EXTRA_COMPRIMENTO[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2,
+                                       2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+const uint16_t BASE_DISTANCIA[30] = {1,    2,    3,    4,    5,    7,     9,     13,    17,  25,
+                                     33,   49,   65,   97,   129,  193,   257,   385,   513, 769,
+                                     1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+const uint8_t EXTRA_DISTANCIA[30] = {0, 0, 0, 0, 1, 1, 2, 2,  3,  3,  4,  4,  5,  5,  6,
+                                     6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+uint32_t inverterBits(uint32_t codigo, int tamanho) {
+    uint32_t r = 0;
+    for (int i = 0; i < tamanho; i++) {
+        r = (r << 1) | (codigo & 1);
+        codigo >>= 1;
+    }
+    return r;
+}
+
+/// Códigos Huffman fixos do deflate, já invertidos (o fluxo é escrito do bit menos significativo)
+struct CodigosFixos {
+    uint16_t literal[288];
+    uint8_t tamanhoLiteral[288];
+    uint8_t distancia[30];
+    uint8_t simboloComprimento[MAX_REPETICAO + 1];   ///< Índice em BASE_COMPRIMENTO
+
+    CodigosFixos() {
+        for (int s = 0; s < 288; s++) {
+            uint32_t codigo;
+            int tamanho;
+            if (s < 144)      { codigo = 0x30 + s;          tamanho = 8; }
+            else if (s < 256) { codigo = 0x190 + (s - 144); tamanho = 9; }
+            else if (s < 280) { codigo = s - 256;           tamanho = 7; }
+            else              { codigo = 0xc0 + (s - 280);  tamanho = 8; }
+            literal[s] = static_cast<uint16_t>(inverterBits(codigo, tamanho));
+            tamanhoLiteral[s] = static_cast<uint8_t>(tamanho);
+        }
+        for (int d = 0; d < 30; d++) distancia[d] = static_cast<uint8_t>(inverterBits(d, 5));
+        int indice = 0;
+        for (int c = MIN_REPETICAO; c <= MAX_REPETICAO; c++) {
+            // 258 tem símbolo próprio (285) em vez de 227 + 31
+            while (indice < 28 && BASE_COMPRIMENTO[indice + 1] <= c) indice++;
+            simboloComprimento[c] = static_cast<uint8_t>(indice);
+        }
+    }
+};
+
+struct EscritorBits {
+    std::vector<unsigned char>& saida;
+    uint64_t acumulador = 0;
+    int numBits = 0;
+
+    explicit EscritorBits(std::vector<unsigned char>& s) : saida(s) {}
+
+    void escrever(uint32_t bits, int n) {
+        acumulador |= static_cast<uint64_t>(bits) << numBits;
+        numBits += n;
+        while (numBits >= 8) {
+            saida.push_back(static_cast<unsigned char>(acumulador));
+            acumulador >>= 8;
+            numBits -= 8;
+        }
+    }
+
+    void completarByte() {
+        if (numBits > 0) escrever(0, 8 - numBits);
+    }
+};
+
+/// Um único bloco final com códigos fixos
+void comprimir(const unsigned char* dados, size_t n, EscritorBits& bits) {
+    static const CodigosFixos codigos;
+    auto literal = [&](int simbolo) { bits.escrever(codigos.literal[simbolo], codigos.tamanhoLiteral[simbolo]); };
+
+    bits.escrever(1, 1);   // BFINAL
+    bits.escrever(1, 2);   // BTYPE = 01 (Huffman fixo)
+
+    std::vector<int32_t> cabeca(size_t(1) << BITS_HASH, -1);
+    std::vector<int32_t> anterior(JANELA, -1);
+    auto hash = [&](size_t p) {
+        uint32_t v = dados[p] | (dados[p + 1] << 8) | (dados[p + 2] << 16);
+        return (v * 2654435761u) >> (32 - BITS_HASH);
+    };
+    auto inserir = [&](size_t p) {
+        if (p + MIN_REPETICAO > n) return;
+        uint32_t h = hash(p);
+        anterior[p & (JANELA - 1)] = cabeca[h];
+        cabeca[h] = static_cast<int32_t>(p);
+    };
+
+    size_t i = 0;
+    while (i < n) {
+        size_t melhor = 0;
+        size_t distancia = 0;
+        if (i + MIN_REPETICAO <= n) {
+            size_t limite = n - i < size_t(MAX_REPETICAO) ? n - i : size_t(MAX_REPETICAO);
+            int32_t candidato = cabeca[hash(i)];
+            // Posições mais antigas que a janela já podem ter sido sobrescritas no anel
+            for (int tentativas = 0; candidato >= 0 && i - candidato < size_t(JANELA) && tentativas < MAX_CADEIA;
+                 tentativas++) {
+                const unsigned char* a = dados + candidato;
+                const unsigned char* b = dados + i;
+                size_t c = 0;
+                while (c < limite && a[c] == b[c]) c++;
+                if (c > melhor) {
+                    melhor = c;
+                    distancia = i - candidato;
+                    if (c == limite) break;
+                }
+                candidato = anterior[candidato & (JANELA - 1)];
+            }
+        }
+
+        if (melhor >= size_t(MIN_REPETICAO)) {
+            int sc = codigos.simboloComprimento[melhor];
+            literal(257 + sc);
+            bits.escrever(static_cast<uint32_t>(melhor - BASE_COMPRIMENTO[sc]), EXTRA_COMPRIMENTO[sc]);
+            int sd = 29;
+            while (BASE_DISTANCIA[sd] > distancia) sd--;
+            bits.escrever(codigos.distancia[sd], 5);
+            bits.escrever(static_cast<uint32_t>(distancia - BASE_DISTANCIA[sd]), EXTRA_DISTANCIA[sd]);
+            for (size_t k = 0; k < melhor; k++) inserir(i + k);
+            i += melhor;
+        } else {
+            literal(dados[i]);
+            inserir(i);
+            i++;
+        }
+    }
+    literal(256);   // fim do bloco
+    bits.completarByte();
+}
+
+} // namespace
+
+// ========== Arquivo PNG ==========
+
+void codificarPNG(const unsigned char* rgba, int largura, int altura, bool deBaixoParaCima,
+                  std::vector<unsigned char>& saida) {
+    std::vector<unsigned char> filtrada;
+    filtrarImagem(rgba, largura, altura, deBaixoParaCima, filtrada);
+
+    saida.clear();
+    saida.reserve(filtrada.size() / 4 + 1024);
+    static const unsigned char ASSINATURA[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'};
+    saida.insert(saida.end(), ASSINATURA, ASSINATURA + 8);
+
+    // IHDR: 8 bits por canal, RGBA (tipo 6), sem entrelaçamento
+    escreverBigEndian32(saida, 13);
+    size_t inicio = saida.size();
+    saida.insert(saida.end(), {'I', 'H', 'D', 'R'});
+    escreverBigEndian32(saida, static_cast<uint32_t>(largura));
+    escreverBigEndian32(saida, static_cast<uint32_t>(altura));
+    saida.insert(saida.end(), {8, 6, 0, 0, 0});
+    escreverBigEndian32(saida, calcularCRC(saida.data() + inicio, saida.size() - inicio));
+
+    // IDAT: um único chunk com o fluxo zlib inteiro; o tamanho é preenchido no fim
+    size_t posTamanho = saida.size();
+    escreverBigEndian32(saida, 0);
+    inicio = saida.size();
+    saida.insert(saida.end(), {'I', 'D', 'A', 'T'});
+    saida.insert(saida.end(), {0x78, 0x01});   // deflate, janela de 32 KB, sem dicionário
+    EscritorBits bits(saida);
+    comprimir(filtrada.data(), filtrada.size(), bits);
+    escreverBigEndian32(saida, calcularAdler(filtrada.data(), filtrada.size()));
+    uint32_t tamanhoIDAT = static_cast<uint32_t>(saida.size() - inicio - 4);
+    for (int k = 0; k < 4; k++) saida[posTamanho + k] = static_cast<unsigned char>(tamanhoIDAT >> (24 - 8 * k));
+    escreverBigEndian32(saida, calcularCRC(saida.data() + inicio, saida.size() - inicio));
+
+    escreverBigEndian32(saida, 0);
+    inicio = saida.size();
+    saida.insert(saida.end(), {'I', 'E', 'N', 'D'});
+    escreverBigEndian32(saida, calcularCRC(saida.data() + inicio, saida.size() - inicio));
+}
+
+bool salvarPNG(const std::string& caminho, const unsigned char* rgba, int largura, int altura,
+               bool deBaixoParaCima) {
+    std::vector<unsigned char> arquivo;
+    codificarPNG(rgba, largura, altura, deBaixoParaCima, arquivo);
+    std::ofstream saida(caminho, std::ios::binary);
+    if (!saida) return false;
+    saida.write(reinterpret_cast<const char*>(arquivo.data()), static_cast<std::streamsize>(arquivo.size()));
+    return static_cast<bool>(saida);
+}
@@ -0,0 +1,34 @@
+#ifndef IMAGEM_PNG_HPP
+#define IMAGEM_PNG_HPP
+
+#include <string>
+#include <vector>
+
+/**
+ * Gravador de imagens PNG
+ *
+ * Sem bibliotecas externas: cada linha recebe o filtro PNG que deixa os
+ * bytes mais próximos de zero (heurística da soma dos valores absolutos) e
+ * o resultado é comprimido com deflate de códigos Huffman fixos e LZ77 com
+ * cadeias de hash curtas. Comprime menos que a zlib no nível máximo, mas
+ * telas com áreas de cor chapada caem para uma fração do tamanho bruto.
+ */
+
+/**
+ * @brief Codifica pixels RGBA de 8 bits em um arquivo PNG completo na memória
+ *
+ * @param rgba - largura * altura * 4 bytes, sem preenchimento entre linhas
+ * @param deBaixoParaCima - true se a linha 0 for a de baixo (saída do glReadPixels)
+ * @param saida - Recebe o arquivo; a capacidade é reaproveitada entre chamadas
+ */
+void codificarPNG(const unsigned char* rgba, int largura, int altura, bool deBaixoParaCima,
+                  std::vector<unsigned char>& saida);
+
+/**
+ * @brief Codifica e grava em disco
+ * @return bool - false se o arquivo não puder ser escrito
+ */
+bool salvarPNG(const std::string& caminho, const unsigned char* rgba, int largura, int altura,
+               bool deBaixoParaCima = false);
+
+#endif // IMAGEM_PNG_HPP
@@ -0,0 +1,102 @@
+#include "ImagemQOI.hpp"
+#include <fstream>
+#include <iterator>
+
+// Operações do formato (2 bits de tag ou byte inteiro)
+static const unsigned char QOI_OP_INDEX = 0x00;
+static const unsigned char QOI_OP_DIFF  = 0x40;
+static const unsigned char QOI_OP_LUMA  = 0x80;
+static const unsigned char QOI_OP_RUN   = 0xc0;
+static const unsigned char QOI_OP_RGB   = 0xfe;
+static const unsigned char QOI_OP_RGBA  = 0xff;
+static const unsigned char QOI_MASCARA  = 0xc0;
+
+static const size_t QOI_CABECALHO = 14;
+static const size_t QOI_FIM = 8;          // 7 bytes 0x00 seguidos de 0x01
+static const size_t QOI_MAX_PIXELS = 400000000;
+
+static unsigned int lerBigEndian32(const unsigned char* p) {
+    return (static_cast<unsigned int>(p[0]) << 24) | (static_cast<unsigned int>(p[1]) << 16) |
+           (static_cast<unsigned int>(p[2]) << 8) | static_cast<unsigned int>(p[3]);
+}
+
+bool decodificarQOI(const unsigned char* dados, size_t tamanho, Imagem& saida) {
+    if (!dados || tamanho < QOI_CABECALHO + QOI_FIM) return false;
+    if (dados[0] != 'q' || dados[1] != 'o' || dados[2] != 'i' || dados[3] != 'f') return false;
+
+    unsigned int largura = lerBigEndian32(dados + 4);
+    unsigned int altura = lerBigEndian32(dados + 8);
+    unsigned char canais = dados[12];
+    if (largura == 0 || altura == 0 || (canais != 3 && canais != 4)) return false;
+    if (static_cast<size_t>(largura) * altura > QOI_MAX_PIXELS) return false;
+
+    size_t numPixels = static_cast<size_t>(largura) * altura;
+    saida.largura = static_cast<int>(largura);
+    saida.altura = static_cast<int>(altura);
+    saida.pixels.resize(numPixels * 4);
+
+    // Tabela dos últimos pixels vistos, indexada por hash
+    unsigned char indice[64][4] = {};
+    unsigned char px[4] = {0, 0, 0, 255};
+
+    size_t p = QOI_CABECALHO;
+    size_t limite = tamanho - QOI_FIM;
+    int repeticao = 0;
+    unsigned char* destino = saida.pixels.data();
+
+    for (size_t i = 0; i < numPixels; i++) {
+        if (repeticao > 0) {
+            repeticao--;
+        } else if (p < limite) {
+            unsigned char b1 = dados[p++];
+            if (b1 == QOI_OP_RGB) {
+                if (p + 3 > limite) return false;
+                px[0] = dados[p++];
+                px[1] = dados[p++];
+                px[2] = dados[p++];
+            } else if (b1 == QOI_OP_RGBA) {
+                if (p + 4 > limite) return false;
+                px[0] = dados[p++];
+                px[1] = dados[p++];
+                px[2] = dados[p++];
+                px[3] = dados[p++];
+            } else if ((b1 & QOI_MASCARA) == QOI_OP_INDEX) {
+                const unsigned char* v = indice[b1];
+                px[0] = v[0]; px[1] = v[1]; px[2] = v[2]; px[3] = v[3];
+            } else if ((b1 & QOI_MASCARA) == QOI_OP_DIFF) {
+                px[0] += ((b1 >> 4) & 0x03) - 2;
+                px[1] += ((b1 >> 2) & 0x03) - 2;
+                px[2] += (b1 & 0x03) - 2;
+            } else if ((b1 & QOI_MASCARA) == QOI_OP_LUMA) {
+                if (p >= limite) return false;
+                unsigned char b2 = dados[p++];
+                int dg = (b1 & 0x3f) - 32;
+                px[0] += dg - 8 + ((b2 >> 4) & 0x0f);
+                px[1] += dg;
+                px[2] += dg - 8 + (b2 & 0x0f);
+            } else {   // QOI_OP_RUN
+                repeticao = b1 & 0x3f;
+            }
+
+            unsigned char* v = indice[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64];
+            v[0] = px[0]; v[1] = px[1]; v[2] = px[2]; v[3] = px[3];
+        } else {
+            // Dados acabaram antes dos pixels
+            return false;
+        }
+
+        destino[0] = px[0];
+        destino[1] = px[1];
+        destino[2] = px[2];
+        destino[3] = px[3];
+        destino += 4;
+    }
+    return true;
+}
+
+bool carregarQOI(const std::string& caminho, Imagem& saida) {
+    std::ifstream arquivo(caminho, std::ios::binary);
+    if (!arquivo) return false;
+    std::vector<unsigned char> dados((std::istreambuf_iterator<char>(arquivo)), std::istreambuf_iterator<char>());
+    return decodificarQOI(dados.data(), dados.size(), saida);
+}
@@ -0,0 +1,35 @@
+#ifndef IMAGEM_QOI_HPP
+#define IMAGEM_QOI_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/// Imagem decodificada: sempre RGBA de 8 bits, linha 0 no topo
+struct Imagem {
+    int largura = 0;
+    int altura = 0;
+    std::vector<unsigned char> pixels;   ///< largura * altura * 4 bytes
+};
+
+/**
+ * Leitor de imagens QOI ("Quite OK Image Format")
+ *
+ * Formato sem perdas com compressão próxima à do PNG, mas decodificado em
+ * uma única passada sem tabelas nem bibliotecas externas (especificação em
+ * qoiformat.org). Imagens RGB ou RGBA; a saída é sempre RGBA.
+ */
+
+/**
+ * @brief Decodifica um arquivo QOI já em memória
+ * @return bool - false se os dados não forem um QOI válido
+ */
+bool decodificarQOI(const unsigned char* dados, size_t tamanho, Imagem& saida);
+
+/**
+ * @brief Lê e decodifica um arquivo .qoi do disco
+ * @return bool - false se o arquivo não existir ou for inválido
+ */
+bool carregarQOI(const std::string& caminho, Imagem& saida);
+
+#endif // IMAGEM_QOI_HPP
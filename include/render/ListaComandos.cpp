@@ -0,0 +1,205 @@
+#include "ListaComandos.hpp"
+#include <cstring>
+
+ListaComandos::ListaComandos(size_t maxComandos, size_t maxBytes)
+    : comandos(maxComandos), dados(maxBytes), numComandos(0), bytesUsados(0), estourou(false) {}
+
+// ========== Gravação ==========
+
+void ListaComandos::reiniciar() {
+    numComandos = 0;
+    bytesUsados = 0;
+    estourou = false;
+}
+
+Comando* ListaComandos::novoComando(TipoComando tipo) {
+    if (numComandos == comandos.size()) {
+        estourou = true;
+        return nullptr;
+    }
+    Comando* c = &comandos[numComandos++];
+    *c = Comando{};
+    c->tipo = tipo;
+    return c;
+}
+
+bool ListaComandos::limparTela(float r, float g, float b, float a) {
+    if (Comando* c = novoComando(TipoComando::limparTela)) {
+        c->valores[0] = r;
+        c->valores[1] = g;
+        c->valores[2] = b;
+        c->valores[3] = a;
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::usarPrograma(GLuint programa) {
+    if (Comando* c = novoComando(TipoComando::usarPrograma)) {
+        c->objeto = programa;
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::uniformFloat(GLint local, float valor) {
+    if (Comando* c = novoComando(TipoComando::uniformFloat)) {
+        c->local = local;
+        c->valores[0] = valor;
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::uniformVec2(GLint local, float x, float y) {
+    if (Comando* c = novoComando(TipoComando::uniformVec2)) {
+        c->local = local;
+        c->valores[0] = x;
+        c->valores[1] = y;
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::uniformMat2(GLint local, const float colunas[4]) {
+    if (Comando* c = novoComando(TipoComando::uniformMat2)) {
+        c->local = local;
+        std::memcpy(c->valores, colunas, sizeof(c->valores));
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::copiarDados(const void* origem, size_t bytes, size_t& offset) {
+    // Sem espaço para os dados: o comando inteiro é descartado
+    if (bytesUsados + bytes > dados.size() || numComandos == comandos.size()) {
+        estourou = true;
+        return false;
+    }
+    // Alinha o início para que a função possa ler structs direto da lista
+    size_t alinhado = (bytesUsados + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    if (alinhado + bytes > dados.size()) {
+        estourou = true;
+        return false;
+    }
+    std::memcpy(dados.data() + alinhado, origem, bytes);
+    offset = alinhado;
+    bytesUsados = alinhado + bytes;
+    return true;
+}
+
+bool ListaComandos::atualizarBuffer(GLuint vbo, const void* origem, size_t bytes, size_t capacidade) {
+    size_t offset;
+    if (!copiarDados(origem, bytes, offset)) return false;
+    if (Comando* c = novoComando(TipoComando::atualizarBuffer)) {
+        c->objeto = vbo;
+        c->local = static_cast<GLint>(capacidade > bytes ? capacidade : bytes);
+        c->contagem = static_cast<GLsizei>(bytes);
+        c->offsetDados = offset;
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::desenhar(GLuint vao, GLenum modo, GLint primeiro, GLsizei numVertices) {
+    if (Comando* c = novoComando(TipoComando::desenhar)) {
+        c->objeto = vao;
+        c->modo = modo;
+        c->local = primeiro;
+        c->contagem = numVertices;
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::desenharIndices(GLuint vao, GLenum modo, GLsizei numIndices) {
+    if (Comando* c = novoComando(TipoComando::desenharIndices)) {
+        c->objeto = vao;
+        c->modo = modo;
+        c->contagem = numIndices;
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::ligarTextura(GLenum alvo, GLuint textura, GLint unidade) {
+    if (Comando* c = novoComando(TipoComando::ligarTextura)) {
+        c->modo = alvo;
+        c->objeto = textura;
+        c->local = unidade;
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::chamar(void (*funcao)(void*), void* contexto) {
+    if (Comando* c = novoComando(TipoComando::funcao)) {
+        c->funcao = funcao;
+        c->contexto = contexto;
+        return true;
+    }
+    return false;
+}
+
+bool ListaComandos::chamarComDados(void (*funcao)(void*, const void*), void* contexto,
+                                   const void* origem, size_t bytes) {
+    size_t offset;
+    if (!copiarDados(origem, bytes, offset)) return false;
+    if (Comando* c = novoComando(TipoComando::funcaoComDados)) {
+        c->funcaoDados = funcao;
+        c->contexto = contexto;
+        c->offsetDados = offset;
+        return true;
+    }
+    return false;
+}
+
+// ========== Execução ==========
+
+void ListaComandos::executar() const {
+    for (size_t i = 0; i < numComandos; i++) {
+        const Comando& c = comandos[i];
+        switch (c.tipo) {
+            case TipoComando::limparTela:
+                glClearColor(c.valores[0], c.valores[1], c.valores[2], c.valores[3]);
+                glClear(GL_COLOR_BUFFER_BIT);
+                break;
+            case TipoComando::usarPrograma:
+                glUseProgram(c.objeto);
+                break;
+            case TipoComando::uniformFloat:
+                glUniform1f(c.local, c.valores[0]);
+                break;
+            case TipoComando::uniformVec2:
+                glUniform2f(c.local, c.valores[0], c.valores[1]);
+                break;
+            case TipoComando::uniformMat2:
+                glUniformMatrix2fv(c.local, 1, GL_FALSE, c.valores);
+                break;
+            case TipoComando::atualizarBuffer:
+                // Órfão: o driver entrega memória nova sem esperar o quadro anterior
+                glBindBuffer(GL_ARRAY_BUFFER, c.objeto);
+                glBufferData(GL_ARRAY_BUFFER, c.local, nullptr, GL_STREAM_DRAW);
+                glBufferSubData(GL_ARRAY_BUFFER, 0, c.contagem, dados.data() + c.offsetDados);
+                break;
+            case TipoComando::desenhar:
+                glBindVertexArray(c.objeto);
+                glDrawArrays(c.modo, c.local, c.contagem);
+                break;
+            case TipoComando::desenharIndices:
+                glBindVertexArray(c.objeto);
+                glDrawElements(c.modo, c.contagem, GL_UNSIGNED_INT, nullptr);
+                break;
+            case TipoComando::ligarTextura:
+                glActiveTexture(GL_TEXTURE0 + c.local);
+                glBindTexture(c.modo, c.objeto);
+                break;
+            case TipoComando::funcao:
+                c.funcao(c.contexto);
+                break;
+            case TipoComando::funcaoComDados:
+                c.funcaoDados(c.contexto, dados.data() + c.offsetDados);
+                break;
+        }
+    }
+}
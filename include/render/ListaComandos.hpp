@@ -0,0 +1,125 @@
+#ifndef LISTA_COMANDOS_HPP
+#define LISTA_COMANDOS_HPP
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Tipos de comando que a thread de render sabe executar
+enum class TipoComando : uint8_t {
+    limparTela,       ///< glClearColor + glClear
+    usarPrograma,     ///< glUseProgram
+    uniformFloat,     ///< glUniform1f
+    uniformVec2,      ///< glUniform2f
+    uniformMat2,      ///< glUniformMatrix2fv (colunas em valores)
+    atualizarBuffer,  ///< Órfão com glBufferData(GL_STREAM_DRAW) + glBufferSubData dos bytes copiados
+    desenhar,         ///< glBindVertexArray + glDrawArrays
+    desenharIndices,  ///< glBindVertexArray + glDrawElements (índices uint32 do EBO do VAO)
+    ligarTextura,     ///< glActiveTexture + glBindTexture
+    funcao,           ///< chama uma função arbitrária na thread do contexto
+    funcaoComDados    ///< idem, recebendo bytes copiados para a lista
+};
+
+/**
+ * @struct Comando
+ * @brief Um item da lista: dados simples (POD), sem ponteiros para a heap
+ */
+struct Comando {
+    TipoComando tipo;
+    GLuint objeto;        ///< Programa, VAO, VBO ou textura conforme o tipo
+    GLint local;          ///< Location do uniform, primeiro vértice, unidade de textura ou capacidade do buffer
+    GLenum modo;          ///< Modo de desenho (GL_TRIANGLES, ...) ou alvo da textura
+    GLsizei contagem;     ///< Número de vértices ou de bytes
+    float valores[4];     ///< Cor de limpeza ou valor do uniform (até um mat2)
+    size_t offsetDados;   ///< Início dos bytes copiados (atualizarBuffer, funcaoComDados)
+    void (*funcao)(void*);
+    void (*funcaoDados)(void*, const void*);
+    void* contexto;
+};
+
+/**
+ * @class ListaComandos
+ * @brief Lista de comandos de render gravada por uma thread e executada por outra
+ *
+ * A thread do jogo grava os comandos do quadro (trocar programa, atualizar
+ * uniform, enviar vértices, desenhar) e a thread de render, dona do contexto
+ * OpenGL, executa tudo em ordem.
+ *
+ * A capacidade é fixa e alocada no construtor: gravar um quadro não faz
+ * nenhuma alocação. Os bytes de atualizarBuffer são copiados para uma área
+ * da própria lista, então a forma pode mudar seus vértices logo depois de
+ * gravar. Se a capacidade estourar, os comandos extras são descartados e
+ * transbordou() passa a retornar true; cada gravação devolve false quando
+ * o seu comando foi descartado.
+ */
+class ListaComandos {
+public:
+    /**
+     * @brief Reserva a memória da lista
+     *
+     * @param maxComandos - Quantos comandos cabem em um quadro
+     * @param maxBytes - Espaço para dados de vértices copiados em um quadro
+     */
+    ListaComandos(size_t maxComandos = 8192, size_t maxBytes = 1 << 20);
+
+    // ========== Gravação (thread do jogo) ==========
+
+    /// Esvazia a lista para um novo quadro (mantém a memória)
+    void reiniciar();
+
+    bool limparTela(float r, float g, float b, float a);
+    bool usarPrograma(GLuint programa);
+    bool uniformFloat(GLint local, float valor);
+    bool uniformVec2(GLint local, float x, float y);
+    bool uniformMat2(GLint local, const float colunas[4]);
+
+    /**
+     * @brief Envia `bytes` para o início do VBO, sem esperar a GPU
+     *
+     * O buffer é reespecificado (órfão) com GL_STREAM_DRAW e `capacidade`
+     * bytes (ou `bytes`, se maior) antes do envio: o tamanho reservado pelo
+     * dono não encolhe a cada quadro.
+     */
+    bool atualizarBuffer(GLuint vbo, const void* dados, size_t bytes, size_t capacidade = 0);
+    bool desenhar(GLuint vao, GLenum modo, GLint primeiro, GLsizei numVertices);
+    bool desenharIndices(GLuint vao, GLenum modo, GLsizei numIndices);
+    bool ligarTextura(GLenum alvo, GLuint textura, GLint unidade);
+    bool chamar(void (*funcao)(void*), void* contexto);
+
+    /**
+     * @brief Como chamar(), mas copia `bytes` de `dados` para a lista
+     *
+     * A função recebe a cópia: o estado do quadro pode ser montado na pilha
+     * da thread do jogo e continuar válido quando a thread de render executar.
+     */
+    bool chamarComDados(void (*funcao)(void*, const void*), void* contexto, const void* dados, size_t bytes);
+
+    // ========== Execução (thread de render) ==========
+
+    /**
+     * @brief Executa todos os comandos gravados, em ordem
+     *
+     * Precisa do contexto OpenGL ativo na thread que chama.
+     */
+    void executar() const;
+
+    // ========== Getters ==========
+
+    size_t getNumComandos() const { return numComandos; }
+    size_t getBytesUsados() const { return bytesUsados; }
+    size_t getCapacidadeBytes() const { return dados.size(); }
+    bool transbordou() const { return estourou; }
+
+private:
+    std::vector<Comando> comandos;
+    std::vector<unsigned char> dados;
+    size_t numComandos;
+    size_t bytesUsados;
+    bool estourou;
+
+    Comando* novoComando(TipoComando tipo);
+    bool copiarDados(const void* origem, size_t bytes, size_t& offset);
+};
+
+#endif // LISTA_COMANDOS_HPP
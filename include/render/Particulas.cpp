@@ -0,0 +1,333 @@
+#include "Particulas.hpp"
+#include "ListaComandos.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+// ========== Shaders ==========
+
+/// vec2/vec4 GLSL a partir de floats da configuração
+static std::string vec2GLSL(float x, float y) {
+    return "vec2(" + std::to_string(x) + ", " + std::to_string(y) + ")";
+}
+
+static std::string vec4GLSL(const float c[4]) {
+    return "vec4(" + std::to_string(c[0]) + ", " + std::to_string(c[1]) + ", " +
+           std::to_string(c[2]) + ", " + std::to_string(c[3]) + ")";
+}
+
+static GLuint compilarShader(GLenum tipo, const std::string& fonte) {
+    GLuint shader = glCreateShader(tipo);
+    const char* texto = fonte.c_str();
+    glShaderSource(shader, 1, &texto, NULL);
+    glCompileShader(shader);
+
+    int success;
+    char infoLog[512];
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        std::cerr << "ERRO: Falha ao compilar shader de partículas\n" << infoLog << std::endl;
+    }
+    return shader;
+}
+
+static void verificarLink(GLuint programa) {
+    int success;
+    char infoLog[512];
+    glGetProgramiv(programa, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(programa, 512, NULL, infoLog);
+        std::cerr << "ERRO: Falha ao linkar shader de partículas\n" << infoLog << std::endl;
+    }
+}
+
+// ========== Construtor e Destrutor ==========
+
+SistemaParticulas::SistemaParticulas(const ConfigParticulas& config)
+    : config(config), estado{0, 0}, vaoAtualizar{0, 0}, vaoDesenhar{0, 0}, vboCanto(0),
+      programaAtualizar(0), programaDesenhar(0), atual(0),
+      locDt(-1), locSemente(-1), locNumEmissoes(-1), locEmissaoPos(-1), locEmissaoFaixa(-1),
+      pendente{}, cursor(0), contadorPassos(0)
+{
+    if (this->config.maxParticulas < 1) this->config.maxParticulas = 1;
+    criarProgramas();
+    criarBuffers();
+}
+
+SistemaParticulas::~SistemaParticulas() {
+    glDeleteVertexArrays(2, vaoAtualizar);
+    glDeleteVertexArrays(2, vaoDesenhar);
+    glDeleteBuffers(2, estado);
+    if (vboCanto) glDeleteBuffers(1, &vboCanto);
+    if (programaAtualizar) glDeleteProgram(programaAtualizar);
+    if (programaDesenhar) glDeleteProgram(programaDesenhar);
+}
+
+// ========== Criação dos Recursos ==========
+
+void SistemaParticulas::criarProgramas() {
+    // A configuração é fixa: entra no shader como constantes
+    std::string constantes =
+        "const int MAX_PARTICULAS = " + std::to_string(config.maxParticulas) + ";\n"
+        "const int MAX_EMISSOES = " + std::to_string(MAX_EMISSOES) + ";\n"
+        "const vec2 VIDA = " + vec2GLSL(config.vidaMin, config.vidaMax) + ";\n"
+        "const vec2 VELOCIDADE = " + vec2GLSL(config.velocidadeMin, config.velocidadeMax) + ";\n"
+        "const vec2 GRAVIDADE = " + vec2GLSL(config.gravidadeX, config.gravidadeY) + ";\n"
+        "const float ARRASTO = " + std::to_string(config.arrasto) + ";\n"
+        "const vec2 TAMANHO = " + vec2GLSL(config.tamanhoInicial, config.tamanhoFinal) + ";\n"
+        "const vec4 COR_INICIAL = " + vec4GLSL(config.corInicial) + ";\n"
+        "const vec4 COR_FINAL = " + vec4GLSL(config.corFinal) + ";\n";
+
+    // 1. Atualização: só vertex shader, a saída vai para o outro buffer
+    std::string fonteAtualizar = "#version 330 core\n" + constantes + R"(
+        layout(location = 0) in vec2 a_pos;
+        layout(location = 1) in vec2 a_vel;
+        layout(location = 2) in vec2 a_vida;   // restante, total
+
+        out vec2 o_pos;
+        out vec2 o_vel;
+        out vec2 o_vida;
+
+        uniform float u_dt;
+        uniform uint u_semente;
+        uniform int u_numEmissoes;
+        uniform vec4 u_emissaoPos[MAX_EMISSOES];    // x, y, ângulo, abertura
+        uniform ivec2 u_emissaoFaixa[MAX_EMISSOES]; // início no anel, quantidade
+
+        uint hash(uint x) {
+            x ^= x >> 16; x *= 0x7feb352du;
+            x ^= x >> 15; x *= 0x846ca68bu;
+            x ^= x >> 16;
+            return x;
+        }
+
+        float aleatorio(inout uint s) {
+            s = hash(s);
+            return float(s >> 8) * (1.0 / 16777216.0);
+        }
+
+        void main() {
+            vec2 pos = a_pos;
+            vec2 vel = a_vel;
+            vec2 vida = a_vida;
+
+            // Renasce se este índice está na faixa de alguma emissão
+            for (int i = 0; i < u_numEmissoes; i++) {
+                int rel = gl_VertexID - u_emissaoFaixa[i].x;
+                if (rel < 0) rel += MAX_PARTICULAS;
+                if (rel < u_emissaoFaixa[i].y) {
+                    uint s = uint(gl_VertexID) * 747796405u + u_semente;
+                    float angulo = u_emissaoPos[i].z + (aleatorio(s) - 0.5) * u_emissaoPos[i].w;
+                    float v = mix(VELOCIDADE.x, VELOCIDADE.y, aleatorio(s));
+                    float t = mix(VIDA.x, VIDA.y, aleatorio(s));
+                    pos = u_emissaoPos[i].xy;
+                    vel = vec2(cos(angulo), sin(angulo)) * v;
+                    vida = vec2(t, t);
+                }
+            }
+
+            if (vida.x > 0.0) {
+                vel += GRAVIDADE * u_dt;
+                vel *= max(0.0, 1.0 - ARRASTO * u_dt);
+                pos += vel * u_dt;
+                vida.x -= u_dt;
+            }
+
+            o_pos = pos;
+            o_vel = vel;
+            o_vida = vida;
+        }
+    )";
+
+    programaAtualizar = glCreateProgram();
+    GLuint vsAtualizar = compilarShader(GL_VERTEX_SHADER, fonteAtualizar);
+    glAttachShader(programaAtualizar, vsAtualizar);
+    const char* saidas[] = {"o_pos", "o_vel", "o_vida"};
+    glTransformFeedbackVaryings(programaAtualizar, 3, saidas, GL_INTERLEAVED_ATTRIBS);
+    glLinkProgram(programaAtualizar);
+    verificarLink(programaAtualizar);
+    glDeleteShader(vsAtualizar);
+
+    locDt = glGetUniformLocation(programaAtualizar, "u_dt");
+    locSemente = glGetUniformLocation(programaAtualizar, "u_semente");
+    locNumEmissoes = glGetUniformLocation(programaAtualizar, "u_numEmissoes");
+    locEmissaoPos = glGetUniformLocation(programaAtualizar, "u_emissaoPos");
+    locEmissaoFaixa = glGetUniformLocation(programaAtualizar, "u_emissaoFaixa");
+
+    // 2. Desenho: um quad por instância, descartado se a partícula está morta
+    std::string fonteVertex = "#version 330 core\n" + constantes + R"(
+        layout(location = 0) in vec2 a_canto;   // por vértice: -1..1
+        layout(location = 1) in vec2 a_pos;     // por instância
+        layout(location = 2) in vec2 a_vida;    // por instância
+
+        out vec2 v_canto;
+        out vec4 v_cor;
+
+        void main() {
+            v_canto = a_canto;
+            if (a_vida.x <= 0.0) {
+                // Fora do volume de recorte: nenhum fragmento
+                v_cor = vec4(0.0);
+                gl_Position = vec4(0.0, 0.0, 2.0, 1.0);
+                return;
+            }
+            float t = 1.0 - a_vida.x / a_vida.y;  // 0 ao nascer, 1 ao morrer
+            v_cor = mix(COR_INICIAL, COR_FINAL, t);
+            gl_Position = vec4(a_pos + a_canto * mix(TAMANHO.x, TAMANHO.y, t), 0.0, 1.0);
+        }
+    )";
+    std::string fonteFragment = R"(
+        #version 330 core
+        in vec2 v_canto;
+        in vec4 v_cor;
+        out vec4 fragColor;
+
+        void main() {
+            // Disco com borda suave
+            float cobertura = 1.0 - smoothstep(0.5, 1.0, length(v_canto));
+            if (cobertura <= 0.0) discard;
+            fragColor = vec4(v_cor.rgb, v_cor.a * cobertura);
+        }
+    )";
+
+    programaDesenhar = glCreateProgram();
+    GLuint vs = compilarShader(GL_VERTEX_SHADER, fonteVertex);
+    GLuint fs = compilarShader(GL_FRAGMENT_SHADER, fonteFragment);
+    glAttachShader(programaDesenhar, vs);
+    glAttachShader(programaDesenhar, fs);
+    glLinkProgram(programaDesenhar);
+    verificarLink(programaDesenhar);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+}
+
+void SistemaParticulas::criarBuffers() {
+    const GLsizei stride = FLOATS_POR_PARTICULA * sizeof(float);
+
+    // Todas começam mortas (vida = 0)
+    std::vector<float> inicial(static_cast<size_t>(config.maxParticulas) * FLOATS_POR_PARTICULA, 0.0f);
+    glGenBuffers(2, estado);
+    for (int i = 0; i < 2; i++) {
+        glBindBuffer(GL_ARRAY_BUFFER, estado[i]);
+        glBufferData(GL_ARRAY_BUFFER, inicial.size() * sizeof(float), inicial.data(), GL_DYNAMIC_COPY);
+    }
+
+    const float cantos[] = {-1.0f, -1.0f,  1.0f, -1.0f,  -1.0f, 1.0f,  1.0f, 1.0f};
+    glGenBuffers(1, &vboCanto);
+    glBindBuffer(GL_ARRAY_BUFFER, vboCanto);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(cantos), cantos, GL_STATIC_DRAW);
+
+    glGenVertexArrays(2, vaoAtualizar);
+    glGenVertexArrays(2, vaoDesenhar);
+    for (int i = 0; i < 2; i++) {
+        // Atualização: estado[i] por vértice
+        glBindVertexArray(vaoAtualizar[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, estado[i]);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(2 * sizeof(float)));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(4 * sizeof(float)));
+        glEnableVertexAttribArray(2);
+
+        // Desenho: cantos por vértice, estado[i] por instância
+        glBindVertexArray(vaoDesenhar[i]);
+        glBindBuffer(GL_ARRAY_BUFFER, vboCanto);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, estado[i]);
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+        glEnableVertexAttribArray(1);
+        glVertexAttribDivisor(1, 1);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)(4 * sizeof(float)));
+        glEnableVertexAttribArray(2);
+        glVertexAttribDivisor(2, 1);
+    }
+    glBindVertexArray(0);
+}
+
+// ========== Emissão ==========
+
+void SistemaParticulas::emitir(float x, float y, int quantidade, float angulo, float abertura) {
+    if (quantidade <= 0 || pendente.numEmissoes == MAX_EMISSOES) return;
+    if (quantidade > config.maxParticulas) quantidade = config.maxParticulas;
+
+    pendente.emissoes[pendente.numEmissoes++] = Emissao{x, y, angulo, abertura, cursor, quantidade};
+    cursor = (cursor + quantidade) % config.maxParticulas;
+}
+
+SistemaParticulas::ParametrosPasso SistemaParticulas::coletarPasso(float dt) {
+    ParametrosPasso p = pendente;
+    p.dt = dt;
+    // Semente diferente a cada passo (Weyl + mistura simples)
+    uint32_t s = ++contadorPassos * 0x9E3779B9u;
+    p.semente = s ^ (s >> 15);
+    pendente.numEmissoes = 0;
+    return p;
+}
+
+// ========== Simulação e Desenho ==========
+
+void SistemaParticulas::simular(const ParametrosPasso& p) {
+    float posicoes[MAX_EMISSOES * 4];
+    GLint faixas[MAX_EMISSOES * 2];
+    for (int i = 0; i < p.numEmissoes; i++) {
+        const Emissao& e = p.emissoes[i];
+        posicoes[i * 4 + 0] = e.x;
+        posicoes[i * 4 + 1] = e.y;
+        posicoes[i * 4 + 2] = e.angulo;
+        posicoes[i * 4 + 3] = e.abertura;
+        faixas[i * 2 + 0] = e.inicio;
+        faixas[i * 2 + 1] = e.quantidade;
+    }
+
+    glUseProgram(programaAtualizar);
+    glUniform1f(locDt, p.dt);
+    glUniform1ui(locSemente, p.semente);
+    glUniform1i(locNumEmissoes, p.numEmissoes);
+    if (p.numEmissoes > 0) {
+        glUniform4fv(locEmissaoPos, p.numEmissoes, posicoes);
+        glUniform2iv(locEmissaoFaixa, p.numEmissoes, faixas);
+    }
+
+    // Lê estado[atual], escreve estado[1 - atual], sem rasterizar
+    int proximo = 1 - atual;
+    glEnable(GL_RASTERIZER_DISCARD);
+    glBindVertexArray(vaoAtualizar[atual]);
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, estado[proximo]);
+    glBeginTransformFeedback(GL_POINTS);
+    glDrawArrays(GL_POINTS, 0, config.maxParticulas);
+    glEndTransformFeedback();
+    glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+    glDisable(GL_RASTERIZER_DISCARD);
+
+    atual = proximo;
+}
+
+void SistemaParticulas::passo(float dt) {
+    simular(coletarPasso(dt));
+}
+
+void SistemaParticulas::desenhar() {
+    if (config.aditivo) glBlendFunc(GL_SRC_ALPHA, GL_ONE);
+
+    glUseProgram(programaDesenhar);
+    glBindVertexArray(vaoDesenhar[atual]);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, config.maxParticulas);
+
+    // Volta para a mistura padrão da aplicação
+    if (config.aditivo) glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+void SistemaParticulas::executarRegistrado(void* contexto, const void* dados) {
+    SistemaParticulas* sistema = static_cast<SistemaParticulas*>(contexto);
+    sistema->simular(*static_cast<const ParametrosPasso*>(dados));
+    sistema->desenhar();
+}
+
+void SistemaParticulas::registrar(ListaComandos& lista, float dt) {
+    // Os parâmetros vão copiados: a thread do jogo já pode emitir para o próximo quadro
+    ParametrosPasso p = coletarPasso(dt);
+    lista.chamarComDados(&SistemaParticulas::executarRegistrado, this, &p, sizeof(p));
+}
@@ -0,0 +1,132 @@
+#ifndef PARTICULAS_HPP
+#define PARTICULAS_HPP
+
+#include <GL/glew.h>
+#include <cstdint>
+
+class ListaComandos;
+
+/**
+ * @struct ConfigParticulas
+ * @brief Aparência e comportamento de um efeito (faíscas, rastro, ...)
+ *
+ * Cada SistemaParticulas tem uma configuração fixa; efeitos diferentes
+ * usam sistemas diferentes. Posições e tamanhos em NDC, tempos em segundos.
+ */
+struct ConfigParticulas {
+    int maxParticulas = 16384;
+    float vidaMin = 0.4f, vidaMax = 0.8f;
+    float velocidadeMin = 0.2f, velocidadeMax = 0.6f;
+    float gravidadeX = 0.0f, gravidadeY = -0.8f;
+    float arrasto = 1.5f;                         ///< Perda de velocidade por segundo
+    float tamanhoInicial = 0.012f, tamanhoFinal = 0.002f;
+    float corInicial[4] = {1.0f, 0.9f, 0.4f, 1.0f};
+    float corFinal[4] = {1.0f, 0.2f, 0.0f, 0.0f};
+    bool aditivo = true;                          ///< Mistura aditiva (brilho) ou alpha comum
+};
+
+/**
+ * @class SistemaParticulas
+ * @brief Partículas simuladas inteiramente na GPU com transform feedback
+ *
+ * O estado (posição, velocidade, vida) fica em dois VBOs que se alternam
+ * (ping-pong): a cada quadro um vertex shader lê um buffer, integra e
+ * escreve o outro via transform feedback, sem rasterizar nada. O desenho
+ * usa o buffer recém-escrito como atributo por instância de um quad.
+ *
+ * Nascer também acontece na GPU: emitir() só reserva uma faixa do buffer
+ * circular; no passo seguinte, os vértices dessa faixa renascem no ponto
+ * de emissão com direção e vida sorteadas por hash. O custo na CPU por
+ * quadro é constante (uniforms e duas chamadas de desenho), qualquer que
+ * seja o número de partículas. Requer apenas OpenGL 3.3.
+ *
+ * Uso direto (contexto nesta thread):
+ * @code
+ * faiscas.emitir(x, y, 64);
+ * faiscas.passo(dt);
+ * faiscas.desenhar();
+ * @endcode
+ * Com a ThreadRender, faiscas.registrar(lista, dt) grava os dois.
+ */
+class SistemaParticulas {
+public:
+    /// Máximo de chamadas a emitir() entre dois passos (o excesso é ignorado)
+    static const int MAX_EMISSOES = 16;
+
+    /**
+     * @brief Cria os buffers e os shaders (precisa do contexto OpenGL ativo)
+     */
+    explicit SistemaParticulas(const ConfigParticulas& config = ConfigParticulas());
+    ~SistemaParticulas();
+
+    SistemaParticulas(const SistemaParticulas&) = delete;
+    SistemaParticulas& operator=(const SistemaParticulas&) = delete;
+
+    // ========== Emissão (thread que grava o quadro) ==========
+
+    /**
+     * @brief Faz `quantidade` partículas nascerem em (x, y) no próximo passo
+     *
+     * @param angulo - Direção central em radianos
+     * @param abertura - Largura do leque em radianos (2π = todas as direções)
+     *
+     * As partículas mais antigas são reaproveitadas quando o buffer enche.
+     */
+    void emitir(float x, float y, int quantidade, float angulo = 0.0f, float abertura = 6.2831853f);
+
+    // ========== Simulação e Desenho ==========
+
+    /// Avança a simulação na GPU (contexto ativo)
+    void passo(float dt);
+
+    /// Desenha todas as partículas vivas com um draw instanciado (contexto ativo)
+    void desenhar();
+
+    /// Versão para a ThreadRender: grava passo(dt) + desenhar() na lista
+    void registrar(ListaComandos& lista, float dt);
+
+    int getMaxParticulas() const { return config.maxParticulas; }
+
+private:
+    /// Dados de uma emissão (os uniforms u_emissao* do shader de atualização)
+    struct Emissao {
+        float x, y, angulo, abertura;
+        int32_t inicio, quantidade;
+    };
+
+    /// Tudo que um passo precisa: copiado para a lista de comandos
+    struct ParametrosPasso {
+        float dt;
+        uint32_t semente;
+        int32_t numEmissoes;
+        Emissao emissoes[MAX_EMISSOES];
+    };
+
+    static const int FLOATS_POR_PARTICULA = 6;   ///< pos.xy, vel.xy, vida restante, vida total
+
+    ConfigParticulas config;
+
+    GLuint estado[2];              ///< VBOs de estado (ping-pong)
+    GLuint vaoAtualizar[2];        ///< Lê estado[i] como atributos por vértice
+    GLuint vaoDesenhar[2];         ///< Lê estado[i] como atributos por instância
+    GLuint vboCanto;               ///< Os 4 cantos do quad
+    GLuint programaAtualizar;
+    GLuint programaDesenhar;
+    int atual;                     ///< Buffer com o estado mais recente (thread do contexto)
+
+    // Locations dos uniforms
+    GLint locDt, locSemente, locNumEmissoes, locEmissaoPos, locEmissaoFaixa;
+
+    // Emissões pendentes (thread do jogo)
+    ParametrosPasso pendente;
+    int cursor;                    ///< Próximo slot do buffer circular a renascer
+    uint32_t contadorPassos;
+
+    void criarProgramas();
+    void criarBuffers();
+    ParametrosPasso coletarPasso(float dt);
+    void simular(const ParametrosPasso& p);
+    static void executarRegistrado(void* contexto, const void* dados);
+};
+
+#endif // PARTICULAS_HPP
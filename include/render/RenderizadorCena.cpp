@@ -0,0 +1,250 @@
+#include "RenderizadorCena.hpp"
+#include "BancoTexturas.hpp"
+#include "ListaComandos.hpp"
+#include "../cena/Cena.hpp"
+#include "../visual.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+// ========== Shaders ==========
+
+static const char* FONTE_VERTICES = R"(
+    #version 330 core
+    layout(location = 0) in vec2 a_unitario;               // malha de lado 1 centrada na origem
+    layout(location = 1) in uvec4 a_tipoCorTexturaModo;     // bytes iniciais do RegistroForma
+    layout(location = 2) in vec4 a_centroRotacaoLargura;
+    layout(location = 3) in vec2 a_alturaCanto;
+    flat out uvec3 v_corTexturaModo;
+    flat out vec3 v_forma;
+    out vec2 v_local;
+    out vec3 v_uv;
+    const float MARGEM_SDF = 0.01;   // mesma folga de Forma::gerarQuadSDF
+    const float ESCALA_UV = 2.0;     // mesma densidade de Forma::aplicarUVs
+    void main() {
+        vec2 tamanho = vec2(a_centroRotacaoLargura.w, a_alturaCanto.x);
+        bool sdf = a_tipoCorTexturaModo.w == 1u;
+        vec2 local = a_unitario * (sdf ? tamanho + vec2(2.0 * MARGEM_SDF) : tamanho);
+        float c = cos(a_centroRotacaoLargura.z);
+        float s = sin(a_centroRotacaoLargura.z);
+        vec2 posicao = a_centroRotacaoLargura.xy + vec2(c * local.x - s * local.y, s * local.x + c * local.y);
+        v_local = local;
+        v_forma = vec3(0.5 * tamanho, a_alturaCanto.y);
+        v_uv = vec3((local + 0.5 * tamanho) * ESCALA_UV, float(a_tipoCorTexturaModo.z) - 1.0);
+        v_corTexturaModo = a_tipoCorTexturaModo.yzw;
+        gl_Position = vec4(posicao, 0.0, 1.0);
+    }
+)";
+
+/// Paleta no shader: um ramo por valor do enum cor, com as expressões de visual
+static std::string fonteFragmentos() {
+    std::string paleta;
+    for (int c = 0; c <= static_cast<int>(cor::rainbow); c++) {
+        paleta += "        if (i == " + std::to_string(c) + "u) return " + visual::expressaoCor(static_cast<cor>(c)) + ";\n";
+    }
+    return R"(
+    #version 330 core
+    uniform float u_time;
+    uniform sampler2DArray u_texturas;
+    flat in uvec3 v_corTexturaModo;
+    flat in vec3 v_forma;
+    in vec2 v_local;
+    in vec3 v_uv;
+    out vec4 fragColor;
+    vec4 corPaleta(uint i) {
+)" + paleta + R"(        return vec4(1.0);
+    }
+    float sdCaixaArredondada(vec2 p, vec2 meia, float r) {
+        vec2 q = abs(p) - meia + vec2(r);
+        return length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r;
+    }
+    void main() {
+        vec4 corFinal = corPaleta(v_corTexturaModo.x);
+        if (v_corTexturaModo.z == 1u) {
+            float d = sdCaixaArredondada(v_local, v_forma.xy, v_forma.z);
+            float aa = fwidth(d);
+            float cobertura = 1.0 - smoothstep(-aa, aa, d);
+            if (cobertura <= 0.0) discard;
+            corFinal.a *= cobertura;
+        } else if (v_corTexturaModo.y > 0u) {
+            corFinal *= texture(u_texturas, v_uv);
+        }
+        fragColor = corFinal;
+    }
+)";
+}
+
+static GLuint compilarShader(GLenum tipo, const std::string& fonte) {
+    GLuint shader = glCreateShader(tipo);
+    const char* texto = fonte.c_str();
+    glShaderSource(shader, 1, &texto, NULL);
+    glCompileShader(shader);
+
+    int success;
+    char infoLog[512];
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        glGetShaderInfoLog(shader, 512, NULL, infoLog);
+        std::cerr << "ERRO: Falha ao compilar shader da cena\n" << infoLog << std::endl;
+    }
+    return shader;
+}
+
+// ========== Malhas Unitárias ==========
+
+/// Malha de um lote: triângulo, quad (retângulos e todo o modo SDF) ou leque do círculo
+static void gerarMalha(const LoteCena& lote, std::vector<float>& vertices, GLenum& modo) {
+    if (lote.modo == 1 || lote.tipo == static_cast<uint8_t>(TipoFormaCena::quadrado) ||
+        lote.tipo == static_cast<uint8_t>(TipoFormaCena::retangulo)) {
+        vertices = {-0.5f, -0.5f, 0.5f, -0.5f, -0.5f, 0.5f, 0.5f, 0.5f};
+        modo = GL_TRIANGLE_STRIP;
+    } else if (lote.tipo == static_cast<uint8_t>(TipoFormaCena::triangulo)) {
+        vertices = {-0.5f, -0.5f, 0.5f, -0.5f, 0.0f, 0.5f};
+        modo = GL_TRIANGLES;
+    } else {
+        vertices = {0.0f, 0.0f};
+        for (int i = 0; i <= lote.segmentos; i++) {
+            float angulo = 2.0f * 3.14159265358979f * i / lote.segmentos;
+            vertices.push_back(0.5f * std::cos(angulo));
+            vertices.push_back(0.5f * std::sin(angulo));
+        }
+        modo = GL_TRIANGLE_FAN;
+    }
+}
+
+// ========== Construtor e Destrutor ==========
+
+RenderizadorCena::RenderizadorCena()
+    : programa(0), localTempo(-1), vboMalhas(0), vboInstancias(0), numFormas(0), usaTextura(false)
+{
+    GLuint vs = compilarShader(GL_VERTEX_SHADER, FONTE_VERTICES);
+    GLuint fs = compilarShader(GL_FRAGMENT_SHADER, fonteFragmentos());
+    programa = glCreateProgram();
+    glAttachShader(programa, vs);
+    glAttachShader(programa, fs);
+    glLinkProgram(programa);
+    int success;
+    char infoLog[512];
+    glGetProgramiv(programa, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(programa, 512, NULL, infoLog);
+        std::cerr << "ERRO: Falha ao linkar shader da cena\n" << infoLog << std::endl;
+    }
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    localTempo = glGetUniformLocation(programa, "u_time");
+    glUseProgram(programa);
+    glUniform1i(glGetUniformLocation(programa, "u_texturas"), 0);
+    glUseProgram(0);
+
+    glGenBuffers(1, &vboMalhas);
+    glGenBuffers(1, &vboInstancias);
+}
+
+RenderizadorCena::~RenderizadorCena() {
+    liberarCena();
+    glDeleteBuffers(1, &vboMalhas);
+    glDeleteBuffers(1, &vboInstancias);
+    glDeleteProgram(programa);
+}
+
+void RenderizadorCena::liberarCena() {
+    for (const LoteGPU& lote : lotes) glDeleteVertexArrays(1, &lote.vao);
+    lotes.clear();
+    numFormas = 0;
+    usaTextura = false;
+}
+
+// ========== Carga ==========
+
+void RenderizadorCena::carregar(const Cena& cena) {
+    liberarCena();
+    numFormas = cena.getNumFormas();
+
+    // Os registros mapeados vão direto para o buffer de instâncias
+    glBindBuffer(GL_ARRAY_BUFFER, vboInstancias);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(numFormas * sizeof(RegistroForma)),
+                 cena.getFormas(), GL_STATIC_DRAW);
+
+    // Uma malha por lote, repetida só se a forma mudar (lotes vizinhos costumam coincidir)
+    std::vector<float> malhas;
+    std::vector<float> malha;
+    std::vector<float> anterior;
+    GLint inicioAnterior = 0;
+    lotes.reserve(cena.getNumLotes());
+    for (uint32_t l = 0; l < cena.getNumLotes(); l++) {
+        const LoteCena& lote = cena.getLotes()[l];
+        LoteGPU gpu;
+        gerarMalha(lote, malha, gpu.modo);
+        if (malha != anterior) {
+            inicioAnterior = static_cast<GLint>(malhas.size() / 2);
+            malhas.insert(malhas.end(), malha.begin(), malha.end());
+            anterior = malha;
+        }
+        gpu.primeiroVertice = inicioAnterior;
+        gpu.numVertices = static_cast<GLsizei>(malha.size() / 2);
+        gpu.instancias = static_cast<GLsizei>(lote.quantidade);
+        gpu.vao = 0;
+        lotes.push_back(gpu);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, vboMalhas);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(malhas.size() * sizeof(float)), malhas.data(), GL_STATIC_DRAW);
+
+    // O VAO de cada lote aponta os atributos de instância para a sua faixa
+    const GLsizei passo = sizeof(RegistroForma);
+    for (uint32_t l = 0; l < lotes.size(); l++) {
+        const char* base = reinterpret_cast<const char*>(static_cast<uintptr_t>(cena.getLotes()[l].primeira) * passo);
+        glGenVertexArrays(1, &lotes[l].vao);
+        glBindVertexArray(lotes[l].vao);
+
+        glBindBuffer(GL_ARRAY_BUFFER, vboMalhas);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+
+        glBindBuffer(GL_ARRAY_BUFFER, vboInstancias);
+        glVertexAttribIPointer(1, 4, GL_UNSIGNED_BYTE, passo, base + offsetof(RegistroForma, tipo));
+        glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, passo, base + offsetof(RegistroForma, x));
+        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, passo, base + offsetof(RegistroForma, altura));
+        for (GLuint atributo = 1; atributo <= 3; atributo++) {
+            glEnableVertexAttribArray(atributo);
+            glVertexAttribDivisor(atributo, 1);
+        }
+    }
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // O banco de texturas só é criado se alguma forma usar textura
+    for (uint32_t i = 0; i < numFormas && !usaTextura; i++) {
+        usaTextura = cena.getFormas()[i].textura != 0 && cena.getFormas()[i].modo == 0;
+    }
+    if (usaTextura) BancoTexturas::instancia();
+}
+
+// ========== Desenho ==========
+
+void RenderizadorCena::desenhar(float tempo) {
+    if (lotes.empty()) return;
+    glUseProgram(programa);
+    glUniform1f(localTempo, tempo);
+    if (usaTextura) {
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, BancoTexturas::instancia().getTextura());
+    }
+    for (const LoteGPU& lote : lotes) {
+        glBindVertexArray(lote.vao);
+        glDrawArraysInstanced(lote.modo, lote.primeiroVertice, lote.numVertices, lote.instancias);
+    }
+    glBindVertexArray(0);
+}
+
+void RenderizadorCena::executarRegistrado(void* contexto, const void* dados) {
+    static_cast<RenderizadorCena*>(contexto)->desenhar(*static_cast<const float*>(dados));
+}
+
+void RenderizadorCena::registrar(ListaComandos& lista, float tempo) {
+    if (lotes.empty()) return;
+    lista.chamarComDados(&RenderizadorCena::executarRegistrado, this, &tempo, sizeof(tempo));
+}
@@ -0,0 +1,77 @@
+#ifndef RENDERIZADOR_CENA_HPP
+#define RENDERIZADOR_CENA_HPP
+
+#include <GL/glew.h>
+#include <cstddef>
+#include <vector>
+
+class Cena;
+class ListaComandos;
+
+/**
+ * @class RenderizadorCena
+ * @brief Desenha uma Cena inteira com um draw instanciado por lote
+ *
+ * Diferente das classes de geometry/, que têm VAO, VBO e programa próprios
+ * por forma, aqui há um único programa para qualquer número de formas. Os
+ * registros da cena (já no layout do buffer) são enviados como estão para
+ * o buffer de instâncias; cada lote ganha um VAO que aponta para a sua
+ * faixa e para a malha unitária do seu tipo (triângulo, quad ou leque do
+ * círculo), escalada, girada e posicionada no vertex shader.
+ *
+ * Cores seguem visual::expressaoCor, texturas vêm do BancoTexturas e o
+ * modo SDF usa a mesma distância e folga das formas de geometry/.
+ *
+ * Uso direto (contexto nesta thread):
+ * @code
+ * RenderizadorCena renderizador;
+ * renderizador.carregar(cena);
+ * renderizador.desenhar(tempo);
+ * @endcode
+ * Com a ThreadRender, renderizador.registrar(lista, tempo).
+ */
+class RenderizadorCena {
+public:
+    /// Compila o programa (precisa do contexto OpenGL ativo)
+    RenderizadorCena();
+    ~RenderizadorCena();
+
+    RenderizadorCena(const RenderizadorCena&) = delete;
+    RenderizadorCena& operator=(const RenderizadorCena&) = delete;
+
+    /**
+     * @brief Envia as formas para a GPU e monta um VAO por lote (contexto ativo)
+     *
+     * Substitui a cena anterior. A Cena pode ser fechada depois: a GPU tem a
+     * própria cópia.
+     */
+    void carregar(const Cena& cena);
+
+    void desenhar(float tempo);
+    void registrar(ListaComandos& lista, float tempo);
+
+    size_t getNumFormas() const { return numFormas; }
+    size_t getNumLotes() const { return lotes.size(); }
+
+private:
+    struct LoteGPU {
+        GLuint vao;
+        GLenum modo;
+        GLint primeiroVertice;
+        GLsizei numVertices;
+        GLsizei instancias;
+    };
+
+    GLuint programa;
+    GLint localTempo;
+    GLuint vboMalhas;
+    GLuint vboInstancias;
+    std::vector<LoteGPU> lotes;
+    size_t numFormas;
+    bool usaTextura;
+
+    void liberarCena();
+    static void executarRegistrado(void* contexto, const void* dados);
+};
+
+#endif // RENDERIZADOR_CENA_HPP
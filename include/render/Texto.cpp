@@ -0,0 +1,364 @@
+#include "Texto.hpp"
+#include "ListaComandos.hpp"
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+// ========== Fonte Bitmap Embutida ==========
+
+// Ordem dos glifos no atlas
+static const char CARACTERES[] = " 0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ!%()+,-./:=?_";
+
+// 7 linhas de 5 bits por glifo (bit 4 = coluna da esquerda), na ordem de CARACTERES
+static const unsigned char FONTE_5X7[][7] = {
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // espaço
+    {0x0E,0x11,0x13,0x15,0x19,0x11,0x0E}, // 0
+    {0x04,0x0C,0x04,0x04,0x04,0x04,0x0E}, // 1
+    {0x0E,0x11,0x01,0x02,0x04,0x08,0x1F}, // 2
+    {0x1F,0x02,0x04,0x02,0x01,0x11,0x0E}, // 3
+    {0x02,0x06,0x0A,0x12,0x1F,0x02,0x02}, // 4
+    {0x1F,0x10,0x1E,0x01,0x01,0x11,0x0E}, // 5
+    {0x06,0x08,0x10,0x1E,0x11,0x11,0x0E}, // 6
+    {0x1F,0x01,0x02,0x04,0x08,0x08,0x08}, // 7
+    {0x0E,0x11,0x11,0x0E,0x11,0x11,0x0E}, // 8
+    {0x0E,0x11,0x11,0x0F,0x01,0x02,0x0C}, // 9
+    {0x0E,0x11,0x11,0x11,0x1F,0x11,0x11}, // A
+    {0x1E,0x11,0x11,0x1E,0x11,0x11,0x1E}, // B
+    {0x0E,0x11,0x10,0x10,0x10,0x11,0x0E}, // C
+    {0x1C,0x12,0x11,0x11,0x11,0x12,0x1C}, // D
+    {0x1F,0x10,0x10,0x1E,0x10,0x10,0x1F}, // E
+    {0x1F,0x10,0x10,0x1E,0x10,0x10,0x10}, // F
+    {0x0E,0x11,0x10,0x17,0x11,0x11,0x0F}, // G
+    {0x11,0x11,0x11,0x1F,0x11,0x11,0x11}, // H
+    {0x0E,0x04,0x04,0x04,0x04,0x04,0x0E}, // I
+    {0x07,0x02,0x02,0x02,0x02,0x12,0x0C}, // J
+    {0x11,0x12,0x14,0x18,0x14,0x12,0x11}, // K
+    {0x10,0x10,0x10,0x10,0x10,0x10,0x1F}, // L
+    {0x11,0x1B,0x15,0x15,0x11,0x11,0x11}, // M
+    {0x11,0x11,0x19,0x15,0x13,0x11,0x11}, // N
+    {0x0E,0x11,0x11,0x11,0x11,0x11,0x0E}, // O
+    {0x1E,0x11,0x11,0x1E,0x10,0x10,0x10}, // P
+    {0x0E,0x11,0x11,0x11,0x15,0x12,0x0D}, // Q
+    {0x1E,0x11,0x11,0x1E,0x14,0x12,0x11}, // R
+    {0x0F,0x10,0x10,0x0E,0x01,0x01,0x1E}, // S
+    {0x1F,0x04,0x04,0x04,0x04,0x04,0x04}, // T
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x0E}, // U
+    {0x11,0x11,0x11,0x11,0x11,0x0A,0x04}, // V
+    {0x11,0x11,0x11,0x15,0x15,0x15,0x0A}, // W
+    {0x11,0x11,0x0A,0x04,0x0A,0x11,0x11}, // X
+    {0x11,0x11,0x11,0x0A,0x04,0x04,0x04}, // Y
+    {0x1F,0x01,0x02,0x04,0x08,0x10,0x1F}, // Z
+    {0x04,0x04,0x04,0x04,0x00,0x00,0x04}, // !
+    {0x18,0x19,0x02,0x04,0x08,0x13,0x03}, // %
+    {0x02,0x04,0x08,0x08,0x08,0x04,0x02}, // (
+    {0x08,0x04,0x02,0x02,0x02,0x04,0x08}, // )
+    {0x00,0x04,0x04,0x1F,0x04,0x04,0x00}, // +
+    {0x00,0x00,0x00,0x00,0x0C,0x04,0x08}, // ,
+    {0x00,0x00,0x00,0x1F,0x00,0x00,0x00}, // -
+    {0x00,0x00,0x00,0x00,0x00,0x0C,0x0C}, // .
+    {0x00,0x01,0x02,0x04,0x08,0x10,0x00}, // /
+    {0x00,0x0C,0x0C,0x00,0x0C,0x0C,0x00}, // :
+    {0x00,0x00,0x1F,0x00,0x1F,0x00,0x00}, // =
+    {0x0E,0x11,0x01,0x02,0x04,0x00,0x04}, // ?
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x1F}, // _
+};
+
+static const int NUM_GLIFOS = sizeof(FONTE_5X7) / sizeof(FONTE_5X7[0]);
+
+// Geometria do atlas (em pixels da textura)
+static const int ESCALA = 4;                  // pixels do atlas por pixel da fonte
+static const int MARGEM = 6;                  // espaço para o campo de distância em volta
+static const int CELULA_L = 5 * ESCALA + 2 * MARGEM;   // 32
+static const int CELULA_A = 7 * ESCALA + 2 * MARGEM;   // 40
+static const int COLUNAS_ATLAS = 16;
+static const int ALCANCE_SDF = MARGEM;        // distância máxima codificada
+
+// Avanço horizontal entre letras, em pixels da fonte (5 de glifo + 1 de espaço)
+static const float AVANCO = 6.0f;
+
+// ========== TextoCache ==========
+
+bool TextoCache::definir(const std::string& novoTexto, float novoX, float novoY,
+                         float novaAltura, CorRGBA novaCor) {
+    bool mudou = sujo || novoTexto != texto || novoX != x || novoY != y || novaAltura != altura ||
+                 novaCor.r != cor.r || novaCor.g != cor.g || novaCor.b != cor.b || novaCor.a != cor.a;
+    if (mudou) {
+        texto = novoTexto;
+        x = novoX;
+        y = novoY;
+        altura = novaAltura;
+        cor = novaCor;
+        sujo = true;
+    }
+    return mudou;
+}
+
+// ========== Construtor e Destrutor ==========
+
+RenderizadorTexto::RenderizadorTexto(int larguraTela, int alturaTela, size_t maxGlifos)
+    : textura(0), programa(0), VAO(0), VBO(0),
+      larguraAtlas(0), alturaAtlas(0),
+      proporcao(static_cast<float>(alturaTela) / static_cast<float>(larguraTela)),
+      maxGlifos(maxGlifos)
+{
+    // Capacidade fixa: acumular texto no quadro nunca realoca
+    verticesQuadro.reserve(maxGlifos * FLOATS_POR_GLIFO);
+
+    std::memset(glifoDoCaractere, -1, sizeof(glifoDoCaractere));
+    for (int i = 0; i < NUM_GLIFOS; i++) {
+        glifoDoCaractere[static_cast<unsigned char>(CARACTERES[i])] = static_cast<signed char>(i);
+    }
+
+    criarAtlas();
+    criarShader();
+    criarBuffer();
+}
+
+RenderizadorTexto::~RenderizadorTexto() {
+    if (VAO) glDeleteVertexArrays(1, &VAO);
+    if (VBO) glDeleteBuffers(1, &VBO);
+    if (programa) glDeleteProgram(programa);
+    if (textura) glDeleteTextures(1, &textura);
+}
+
+// ========== Criação dos Recursos ==========
+
+void RenderizadorTexto::criarAtlas() {
+    int linhas = (NUM_GLIFOS + COLUNAS_ATLAS - 1) / COLUNAS_ATLAS;
+    larguraAtlas = COLUNAS_ATLAS * CELULA_L;
+    alturaAtlas = linhas * CELULA_A;
+
+    // 1. Bitmap ampliado (1 = dentro da letra)
+    std::vector<unsigned char> bitmap(larguraAtlas * alturaAtlas, 0);
+    for (int g = 0; g < NUM_GLIFOS; g++) {
+        int cx = (g % COLUNAS_ATLAS) * CELULA_L + MARGEM;
+        int cy = (g / COLUNAS_ATLAS) * CELULA_A + MARGEM;
+        for (int linha = 0; linha < 7; linha++) {
+            for (int coluna = 0; coluna < 5; coluna++) {
+                if (!(FONTE_5X7[g][linha] & (0x10 >> coluna))) continue;
+                for (int dy = 0; dy < ESCALA; dy++) {
+                    for (int dx = 0; dx < ESCALA; dx++) {
+                        int px = cx + coluna * ESCALA + dx;
+                        int py = cy + linha * ESCALA + dy;
+                        bitmap[py * larguraAtlas + px] = 1;
+                    }
+                }
+            }
+        }
+    }
+
+    // 2. Campo de distância: para cada pixel, a distância até o pixel mais
+    //    próximo do estado oposto (limitada a ALCANCE_SDF). 0.5 = borda.
+    //    Força bruta em janela pequena: roda uma vez, na inicialização.
+    std::vector<unsigned char> sdf(larguraAtlas * alturaAtlas, 0);
+    for (int y = 0; y < alturaAtlas; y++) {
+        for (int x = 0; x < larguraAtlas; x++) {
+            unsigned char dentro = bitmap[y * larguraAtlas + x];
+            float melhor2 = static_cast<float>(ALCANCE_SDF * ALCANCE_SDF);
+            for (int dy = -ALCANCE_SDF; dy <= ALCANCE_SDF; dy++) {
+                int yy = y + dy;
+                if (yy < 0 || yy >= alturaAtlas) continue;
+                for (int dx = -ALCANCE_SDF; dx <= ALCANCE_SDF; dx++) {
+                    int xx = x + dx;
+                    if (xx < 0 || xx >= larguraAtlas) continue;
+                    if (bitmap[yy * larguraAtlas + xx] == dentro) continue;
+                    float d2 = static_cast<float>(dx * dx + dy * dy);
+                    if (d2 < melhor2) melhor2 = d2;
+                }
+            }
+            // Meio pixel de correção: a borda fica entre os dois pixels
+            float d = std::sqrt(melhor2) - 0.5f;
+            float assinada = dentro ? d : -d;
+            float valor = 0.5f + assinada / (2.0f * ALCANCE_SDF);
+            if (valor < 0.0f) valor = 0.0f;
+            if (valor > 1.0f) valor = 1.0f;
+            sdf[y * larguraAtlas + x] = static_cast<unsigned char>(valor * 255.0f + 0.5f);
+        }
+    }
+
+    // 3. Uma única textura de um canal
+    glGenTextures(1, &textura);
+    glBindTexture(GL_TEXTURE_2D, textura);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, larguraAtlas, alturaAtlas, 0, GL_RED, GL_UNSIGNED_BYTE, sdf.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+}
+
+void RenderizadorTexto::criarShader() {
+    const char* fonteVertex = R"(
+        #version 330 core
+        layout(location = 0) in vec2 a_pos;
+        layout(location = 1) in vec2 a_uv;
+        layout(location = 2) in vec4 a_cor;
+        out vec2 v_uv;
+        out vec4 v_cor;
+        void main() {
+            v_uv = a_uv;
+            v_cor = a_cor;
+            gl_Position = vec4(a_pos, 0.0, 1.0);
+        }
+    )";
+    const char* fonteFragment = R"(
+        #version 330 core
+        uniform sampler2D u_atlas;
+        in vec2 v_uv;
+        in vec4 v_cor;
+        out vec4 fragColor;
+        void main() {
+            float d = texture(u_atlas, v_uv).r;
+            float aa = fwidth(d);
+            float cobertura = smoothstep(0.5 - aa, 0.5 + aa, d);
+            if (cobertura <= 0.0) discard;
+            fragColor = vec4(v_cor.rgb, v_cor.a * cobertura);
+        }
+    )";
+
+    GLuint vs = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vs, 1, &fonteVertex, NULL);
+    glCompileShader(vs);
+    GLuint fs = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fs, 1, &fonteFragment, NULL);
+    glCompileShader(fs);
+
+    programa = glCreateProgram();
+    glAttachShader(programa, vs);
+    glAttachShader(programa, fs);
+    glLinkProgram(programa);
+
+    int success;
+    char infoLog[512];
+    glGetProgramiv(programa, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(programa, 512, NULL, infoLog);
+        std::cerr << "ERRO: Falha ao linkar o shader de texto\n" << infoLog << std::endl;
+    }
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    // O atlas fica sempre na unidade de textura 0
+    glUseProgram(programa);
+    glUniform1i(glGetUniformLocation(programa, "u_atlas"), 0);
+}
+
+void RenderizadorTexto::criarBuffer() {
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+    glGenBuffers(1, &VBO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+
+    // Buffer de streaming: reespecificado a cada quadro (orphaning)
+    glBufferData(GL_ARRAY_BUFFER, maxGlifos * FLOATS_POR_GLIFO * sizeof(float), NULL, GL_STREAM_DRAW);
+
+    GLsizei stride = FLOATS_POR_VERTICE * sizeof(float);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, stride, (void*)(4 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+}
+
+// ========== Layout ==========
+
+void RenderizadorTexto::gerarQuads(const std::string& texto, float x, float y, float altura,
+                                   CorRGBA cor, std::vector<float>& saida) const {
+    // Tamanho de um pixel da fonte em NDC (a letra tem 7 pixels de altura)
+    float unidadeY = altura / 7.0f;
+    float unidadeX = unidadeY * proporcao;
+
+    // O quad cobre a célula inteira, inclusive a margem do campo de distância
+    float margem = static_cast<float>(MARGEM) / ESCALA;
+    float larguraQuad = static_cast<float>(CELULA_L) / ESCALA * unidadeX;
+    float alturaQuad = static_cast<float>(CELULA_A) / ESCALA * unidadeY;
+
+    float caneta = x;
+    for (char c : texto) {
+        unsigned char uc = static_cast<unsigned char>(c);
+        if (uc >= 'a' && uc <= 'z') uc = static_cast<unsigned char>(uc - 'a' + 'A');
+        int g = uc < 128 ? glifoDoCaractere[uc] : -1;
+        if (g <= 0) {
+            // Espaço ou caractere sem glifo: só avança
+            caneta += AVANCO * unidadeX;
+            continue;
+        }
+
+        float x0 = caneta - margem * unidadeX;
+        float y0 = y - margem * unidadeY;
+        float x1 = x0 + larguraQuad;
+        float y1 = y0 + alturaQuad;
+
+        // Linha 0 da textura é o topo da célula
+        float u0 = static_cast<float>((g % COLUNAS_ATLAS) * CELULA_L) / larguraAtlas;
+        float u1 = u0 + static_cast<float>(CELULA_L) / larguraAtlas;
+        float vTopo = static_cast<float>((g / COLUNAS_ATLAS) * CELULA_A) / alturaAtlas;
+        float vBase = vTopo + static_cast<float>(CELULA_A) / alturaAtlas;
+
+        const float cantos[6][4] = {
+            {x0, y0, u0, vBase}, {x1, y0, u1, vBase}, {x1, y1, u1, vTopo},
+            {x0, y0, u0, vBase}, {x1, y1, u1, vTopo}, {x0, y1, u0, vTopo},
+        };
+        for (const auto& v : cantos) {
+            saida.insert(saida.end(), {v[0], v[1], v[2], v[3], cor.r, cor.g, cor.b, cor.a});
+        }
+        caneta += AVANCO * unidadeX;
+    }
+}
+
+float RenderizadorTexto::medirLargura(const std::string& texto, float altura) const {
+    // A última letra não precisa do pixel de espaço
+    if (texto.empty()) return 0.0f;
+    float unidadeX = altura / 7.0f * proporcao;
+    return (texto.size() * AVANCO - 1.0f) * unidadeX;
+}
+
+// ========== Acúmulo do Quadro ==========
+
+void RenderizadorTexto::adicionar(const std::string& texto, float x, float y, float altura, CorRGBA cor) {
+    // Sem espaço para o texto inteiro: descarta (nunca realoca no quadro)
+    if (getGlifosNoQuadro() + texto.size() > maxGlifos) return;
+    gerarQuads(texto, x, y, altura, cor, verticesQuadro);
+}
+
+void RenderizadorTexto::adicionar(TextoCache& texto) {
+    if (texto.sujo) {
+        texto.vertices.clear();
+        gerarQuads(texto.texto, texto.x, texto.y, texto.altura, texto.cor, texto.vertices);
+        texto.sujo = false;
+    }
+    if (verticesQuadro.size() + texto.vertices.size() > verticesQuadro.capacity()) return;
+    verticesQuadro.insert(verticesQuadro.end(), texto.vertices.begin(), texto.vertices.end());
+}
+
+// ========== Envio ==========
+
+void RenderizadorTexto::desenhar() {
+    if (!verticesQuadro.empty()) {
+        // Orphaning: o driver entrega memória nova sem esperar o quadro anterior
+        glBindBuffer(GL_ARRAY_BUFFER, VBO);
+        glBufferData(GL_ARRAY_BUFFER, maxGlifos * FLOATS_POR_GLIFO * sizeof(float), NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, verticesQuadro.size() * sizeof(float), verticesQuadro.data());
+
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, textura);
+        glUseProgram(programa);
+        glBindVertexArray(VAO);
+        glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(verticesQuadro.size() / FLOATS_POR_VERTICE));
+    }
+    verticesQuadro.clear();
+}
+
+void RenderizadorTexto::registrar(ListaComandos& lista) {
+    if (!verticesQuadro.empty()) {
+        // Os vértices são copiados para a lista: o vetor pode ser reusado já.
+        // O órfão mantém a capacidade de criarBuffer()
+        lista.atualizarBuffer(VBO, verticesQuadro.data(), verticesQuadro.size() * sizeof(float),
+                              maxGlifos * FLOATS_POR_GLIFO * sizeof(float));
+        lista.ligarTextura(GL_TEXTURE_2D, textura, 0);
+        lista.usarPrograma(programa);
+        lista.desenhar(VAO, GL_TRIANGLES, 0, static_cast<GLsizei>(verticesQuadro.size() / FLOATS_POR_VERTICE));
+    }
+    verticesQuadro.clear();
+}
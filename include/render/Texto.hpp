@@ -0,0 +1,125 @@
+#ifndef TEXTO_HPP
+#define TEXTO_HPP
+
+#include <GL/glew.h>
+#include <string>
+#include <vector>
+
+class ListaComandos;
+
+/// Cor de texto (componentes de 0 a 1)
+struct CorRGBA {
+    float r, g, b, a;
+};
+
+/**
+ * @class TextoCache
+ * @brief Texto com layout guardado: só refaz os quads quando algo muda
+ *
+ * Para placares e HUD que mudam pouco: a cada quadro chame definir() com
+ * o conteúdo atual; se nada mudou, os vértices já calculados são reusados
+ * e o RenderizadorTexto só os copia para o buffer do quadro.
+ */
+class TextoCache {
+public:
+    TextoCache() : x(0.0f), y(0.0f), altura(0.0f), cor{1.0f, 1.0f, 1.0f, 1.0f}, sujo(true) {}
+
+    /**
+     * @brief Atualiza conteúdo, posição, tamanho e cor
+     * @return bool - true se o layout precisou ser refeito
+     */
+    bool definir(const std::string& novoTexto, float novoX, float novoY, float novaAltura, CorRGBA novaCor);
+
+    const std::string& getTexto() const { return texto; }
+
+private:
+    friend class RenderizadorTexto;
+
+    std::string texto;
+    float x, y, altura;
+    CorRGBA cor;
+    bool sujo;                    ///< O layout precisa ser refeito
+    std::vector<float> vertices;  ///< Quads prontos (mesmo formato do buffer de texto)
+};
+
+/**
+ * @class RenderizadorTexto
+ * @brief Desenha todo o texto do quadro com uma textura e um único draw call
+ *
+ * Na criação, uma fonte bitmap 5x7 embutida é ampliada e convertida em um
+ * atlas de campo de distância (SDF) em uma única textura GL_R8. O fragment
+ * shader usa a distância para bordas suaves em qualquer tamanho.
+ *
+ * Durante o quadro, adicionar() acumula os quads de todos os textos em um
+ * vetor de capacidade fixa; desenhar() (ou registrar() com a ThreadRender)
+ * envia tudo para um buffer de streaming e desenha em uma chamada.
+ *
+ * Caracteres suportados: espaço, 0-9, A-Z (minúsculas viram maiúsculas)
+ * e ! % ( ) + , - . / : = ? _
+ *
+ * Coordenadas em NDC: (x, y) é o canto inferior esquerdo do primeiro
+ * caractere e altura é a altura de uma letra maiúscula.
+ */
+class RenderizadorTexto {
+public:
+    /**
+     * @brief Cria o atlas, o shader e o buffer de streaming
+     *
+     * @param larguraTela - Largura da janela em pixels (para a proporção das letras)
+     * @param alturaTela - Altura da janela em pixels
+     * @param maxGlifos - Máximo de caracteres por quadro
+     *
+     * Precisa do contexto OpenGL ativo.
+     */
+    RenderizadorTexto(int larguraTela, int alturaTela, size_t maxGlifos = 4096);
+    ~RenderizadorTexto();
+
+    RenderizadorTexto(const RenderizadorTexto&) = delete;
+    RenderizadorTexto& operator=(const RenderizadorTexto&) = delete;
+
+    // ========== Acúmulo do Quadro ==========
+
+    /// Texto dinâmico: faz o layout agora
+    void adicionar(const std::string& texto, float x, float y, float altura, CorRGBA cor);
+
+    /// Texto com layout guardado: refaz só se definir() marcou mudança
+    void adicionar(TextoCache& texto);
+
+    // ========== Envio ==========
+
+    /// Envia e desenha o texto acumulado e esvazia o quadro (contexto ativo)
+    void desenhar();
+
+    /// Versão para a ThreadRender: grava os comandos equivalentes a desenhar()
+    void registrar(ListaComandos& lista);
+
+    /**
+     * @brief Largura em NDC que um texto ocupará
+     */
+    float medirLargura(const std::string& texto, float altura) const;
+
+    size_t getGlifosNoQuadro() const { return verticesQuadro.size() / FLOATS_POR_GLIFO; }
+
+private:
+    static const int FLOATS_POR_VERTICE = 8;   ///< x, y, u, v, r, g, b, a
+    static const int FLOATS_POR_GLIFO = 6 * FLOATS_POR_VERTICE;
+
+    GLuint textura;
+    GLuint programa;
+    GLuint VAO;
+    GLuint VBO;
+    int larguraAtlas;
+    int alturaAtlas;
+    float proporcao;                ///< altura / largura da tela
+    size_t maxGlifos;
+    std::vector<float> verticesQuadro;
+    signed char glifoDoCaractere[128];  ///< Índice no atlas ou -1
+
+    void criarAtlas();
+    void criarShader();
+    void criarBuffer();
+    void gerarQuads(const std::string& texto, float x, float y, float altura,
+                    CorRGBA cor, std::vector<float>& saida) const;
+};
+
+#endif // TEXTO_HPP
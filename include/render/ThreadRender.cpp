@@ -0,0 +1,119 @@
+#include "ThreadRender.hpp"
+#include <iostream>
+
+// ========== Construtor e Destrutor ==========
+
+ThreadRender::ThreadRender(GLFWwindow* janela)
+    : janela(janela),
+      indiceEscrita(0),
+      indicePendente(-1),
+      indiceEmUso(-1),
+      rodando(true),
+      quadrosApresentados(0),
+      quadrosTransbordados(0),
+      aoApresentar(nullptr),
+      contextoAoApresentar(nullptr)
+{
+    // A thread é criada por último: todos os membros já estão prontos
+    thread = std::thread(&ThreadRender::laco, this);
+}
+
+ThreadRender::~ThreadRender() {
+    encerrar();
+}
+
+// ========== Thread do Jogo ==========
+
+ListaComandos& ThreadRender::iniciarQuadro() {
+    std::unique_lock<std::mutex> lk(trava);
+    mudou.wait(lk, [this] { return indiceEmUso != indiceEscrita; });
+
+    ListaComandos& lista = listas[indiceEscrita];
+    lista.reiniciar();
+    return lista;
+}
+
+void ThreadRender::enviarQuadro() {
+    // Fora da trava: só a thread do jogo muda indiceEscrita, e a de render
+    // não pode ficar esperando a saída de erro
+    if (listas[indiceEscrita].transbordou() && quadrosTransbordados++ == 0) {
+        std::cerr << "AVISO: Lista de comandos cheia, comandos descartados (avisado uma vez; total no encerramento)"
+                  << std::endl;
+    }
+
+    std::unique_lock<std::mutex> lk(trava);
+    // Espera a thread de render retirar o quadro anterior
+    mudou.wait(lk, [this] { return indicePendente == -1 || !rodando; });
+    indicePendente = indiceEscrita;
+    indiceEscrita = 1 - indiceEscrita;
+    lk.unlock();
+    mudou.notify_all();
+}
+
+void ThreadRender::esperarVaga() {
+    std::unique_lock<std::mutex> lk(trava);
+    mudou.wait(lk, [this] { return (indicePendente == -1 && indiceEmUso == -1) || !rodando; });
+}
+
+void ThreadRender::setAoApresentar(AoApresentar funcao, void* contexto) {
+    std::lock_guard<std::mutex> lk(trava);
+    aoApresentar = funcao;
+    contextoAoApresentar = contexto;
+}
+
+void ThreadRender::encerrar() {
+    {
+        std::lock_guard<std::mutex> lk(trava);
+        if (!rodando) return;
+        rodando = false;
+    }
+    mudou.notify_all();
+    thread.join();
+}
+
+unsigned long ThreadRender::getQuadrosApresentados() const {
+    std::lock_guard<std::mutex> lk(trava);
+    return quadrosApresentados;
+}
+
+// ========== Thread de Render ==========
+
+void ThreadRender::laco() {
+    // O contexto só pode estar ativo em uma thread por vez
+    glfwMakeContextCurrent(janela);
+
+    while (true) {
+        int indice;
+        AoApresentar avisar;
+        void* contextoAviso;
+        {
+            std::unique_lock<std::mutex> lk(trava);
+            mudou.wait(lk, [this] { return indicePendente != -1 || !rodando; });
+
+            // Ao encerrar, ainda executa o quadro já enviado
+            if (indicePendente == -1) break;
+            indice = indicePendente;
+            indiceEmUso = indice;
+            indicePendente = -1;
+            avisar = aoApresentar;
+            contextoAviso = contextoAoApresentar;
+        }
+        mudou.notify_all();
+
+        // Fora da trava: o jogo grava a outra lista enquanto isso
+        listas[indice].executar();
+        glfwSwapBuffers(janela);
+
+        unsigned long apresentado;
+        {
+            std::lock_guard<std::mutex> lk(trava);
+            indiceEmUso = -1;
+            apresentado = ++quadrosApresentados;
+        }
+        mudou.notify_all();
+        if (avisar) avisar(contextoAviso, apresentado);
+    }
+
+    // Devolve o contexto para quem vier depois (ex.: destrutores na thread principal)
+    glfwMakeContextCurrent(nullptr);
+}
@@ -0,0 +1,118 @@
+#ifndef THREAD_RENDER_HPP
+#define THREAD_RENDER_HPP
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include "ListaComandos.hpp"
+
+/**
+ * @class ThreadRender
+ * @brief Thread dona do contexto OpenGL que executa as listas de comandos
+ *
+ * Duas listas se alternam (double buffering): enquanto a thread de render
+ * executa a lista do quadro N (e espera o glfwSwapBuffers), a thread do
+ * jogo já simula e grava o quadro N+1 na outra lista.
+ *
+ * Fluxo na thread do jogo:
+ * @code
+ * glfwMakeContextCurrent(nullptr);   // solta o contexto antes de criar
+ * ThreadRender render(window);
+ * while (...) {
+ *     ListaComandos& lista = render.iniciarQuadro();
+ *     forma.registrar(lista, tempo);
+ *     render.enviarQuadro();
+ *     glfwPollEvents();                // eventos continuam na thread principal
+ * }
+ * render.encerrar();
+ * glfwMakeContextCurrent(window);    // para os destrutores liberarem os recursos
+ * @endcode
+ */
+class ThreadRender {
+public:
+    /// Chamada na thread de render logo após o swap do quadro `quadro` (1, 2, 3...)
+    using AoApresentar = void (*)(void* contexto, unsigned long quadro);
+
+    /**
+     * @brief Inicia a thread e torna o contexto da janela atual nela
+     *
+     * @param janela - Janela cujo contexto NÃO pode estar ativo em outra thread
+     */
+    explicit ThreadRender(GLFWwindow* janela);
+
+    /**
+     * @brief Chama encerrar() se ainda não foi chamado
+     */
+    ~ThreadRender();
+
+    ThreadRender(const ThreadRender&) = delete;
+    ThreadRender& operator=(const ThreadRender&) = delete;
+
+    /**
+     * @brief Devolve a lista livre, já vazia, para gravar o próximo quadro
+     *
+     * Só bloqueia se a thread de render ainda estiver executando essa lista
+     * (ou seja, se o jogo estiver mais de um quadro à frente).
+     */
+    ListaComandos& iniciarQuadro();
+
+    /**
+     * @brief Entrega a lista gravada para a thread de render
+     *
+     * Bloqueia enquanto o quadro anterior ainda não foi retirado.
+     */
+    void enviarQuadro();
+
+    /**
+     * @brief Espera a thread de render apresentar o quadro anterior e ficar ociosa
+     *
+     * Depois disso enviarQuadro() não bloqueia e a lista começa a ser
+     * executada na hora: o que for gravado entre as duas chamadas (ex.: a
+     * raquete com a entrada mais recente, na trava tardia) chega ao próximo
+     * swap sem envelhecer na fila.
+     */
+    void esperarVaga();
+
+    /**
+     * @brief Registra quem é avisado a cada quadro apresentado
+     *
+     * Os quadros são apresentados na ordem de envio, então o n-ésimo
+     * enviarQuadro() corresponde ao aviso com quadro = n.
+     */
+    void setAoApresentar(AoApresentar funcao, void* contexto);
+
+    /**
+     * @brief Termina o quadro em andamento, solta o contexto e junta a thread
+     */
+    void encerrar();
+
+    /**
+     * @brief Quantos quadros a thread de render já apresentou (swap)
+     * @return unsigned long - Contador de quadros
+     */
+    unsigned long getQuadrosApresentados() const;
+
+    /// Quadros enviados com a lista cheia (comandos descartados); só a thread do jogo lê
+    unsigned long getQuadrosTransbordados() const { return quadrosTransbordados; }
+
+private:
+    GLFWwindow* janela;
+    ListaComandos listas[2];
+    int indiceEscrita;      ///< Lista que a thread do jogo está gravando
+    int indicePendente;     ///< Lista enviada esperando a thread de render (-1 = nenhuma)
+    int indiceEmUso;        ///< Lista sendo executada agora (-1 = nenhuma)
+    bool rodando;
+    unsigned long quadrosApresentados;
+    unsigned long quadrosTransbordados;     ///< Só a thread do jogo mexe: fora da trava
+    AoApresentar aoApresentar;
+    void* contextoAoApresentar;
+    mutable std::mutex trava;
+    std::condition_variable mudou;
+    std::thread thread;
+
+    void laco();
+};
+
+#endif // THREAD_RENDER_HPP
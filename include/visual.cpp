@@ -1,21 +1,157 @@
 #include "visual.hpp"
 
-visual::visual(cor c, textura t) : color(c), texture(t) {}
+visual::visual(cor c, textura t) 
+    : color(c), texture(t), modo(renderizacao::triangulos), 
+      larguraContorno(0.0f), corContorno(cor::black) {
+    if (texture != textura::none) {
+        // o material vem do array de texturas (camada no vértice) e a cor tinge;
+        // com cor::white a textura aparece sem alteração
+        fonteFragmentTextura = R"(
+            #version 330 core
+            uniform float u_time;
+            uniform sampler2DArray u_texturas;
+            in vec3 v_uv;
+            out vec4 fragColor;
+            void main() {
+                fragColor = texture(u_texturas, v_uv) * )" + std::string(expressaoCor(color)) + R"(;
+            }
+        )";
+    }
+}
+
+//cor de cada enum como expressão GLSL (usada pelos shaders montados em tempo de execução)
+const char* visual::expressaoCor(cor c) {
+    switch (c) {
+        case cor::red:    return "vec4(1.0, 0.0, 0.0, 1.0)";
+        case cor::blue:   return "vec4(0.0, 0.0, 1.0, 1.0)";
+        case cor::yellow: return "vec4(1.0, 1.0, 0.0, 1.0)";
+        case cor::green:  return "vec4(0.0, 1.0, 0.0, 1.0)";
+        case cor::black:  return "vec4(0.0, 0.0, 0.0, 1.0)";
+        case cor::orange: return "vec4(1.0, 0.5, 0.0, 1.0)";
+        case cor::gray:   return "vec4(0.5, 0.5, 0.5, 1.0)";
+        case cor::rainbow:
+            return "vec4(abs(sin(u_time)), abs(sin(u_time*0.7)), abs(cos(u_time*1.3)), 1.0)";
+        case cor::white:
+        default:          return "vec4(1.0, 1.0, 1.0, 1.0)";
+    }
+}
 
+void visual::ativarSDF(float largura, cor corBorda) {
+    modo = renderizacao::sdf;
+    larguraContorno = largura < 0.0f ? 0.0f : largura;
+    corContorno = corBorda;
+
+    // a distância é a de uma caixa com cantos arredondados: com raio = meia dimensão
+    // vira círculo, com raio 0 vira retângulo. fwidth(d) dá a largura de 1 pixel
+    // em unidades de distância, então a borda fica suave em qualquer resolução
+    fonteFragmentSDF = R"(
+        #version 330 core
+        uniform float u_time;
+        in vec2 v_local;
+        flat in vec3 v_forma;
+        out vec4 fragColor;
+        const float CONTORNO = )" + std::to_string(larguraContorno) + R"(;
+        float sdCaixaArredondada(vec2 p, vec2 meia, float r) {
+            vec2 q = abs(p) - meia + vec2(r);
+            return length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r;
+        }
+        void main() {
+            float d = sdCaixaArredondada(v_local, v_forma.xy, v_forma.z);
+            float aa = fwidth(d);
+            float cobertura = 1.0 - smoothstep(-aa, aa, d);
+            if (cobertura <= 0.0) discard;
+            vec4 corFinal = )" + expressaoCor(color) + R"(;
+            if (CONTORNO > 0.0) {
+                vec4 borda = )" + expressaoCor(corContorno) + R"(;
+                corFinal = mix(corFinal, borda, smoothstep(-CONTORNO - aa, -CONTORNO + aa, d));
+            }
+            fragColor = vec4(corFinal.rgb, corFinal.a * cobertura);
+        }
+    )";
+}
+
+void visual::desativarSDF() {
+    modo = renderizacao::triangulos;
+    fonteFragmentSDF.clear();
+}
+
+//os vértices vêm em espaço local (malha compartilhada); u_escalaRotacao e u_deslocamento posicionam a forma
 const char* visual::geraVertexShader() const {
+    if (usaTextura()) {
+        // location 1: coordenadas de textura (u, v) e camada do material
+        return R"(
+            #version 330 core
+            uniform vec2 u_deslocamento;
+            uniform mat2 u_escalaRotacao;
+            layout(location = 0) in vec2 vitor;
+            layout(location = 1) in vec3 a_uv;
+            out vec3 v_uv;
+            void main() {
+                v_uv = a_uv;
+                gl_Position = vec4(u_escalaRotacao * vitor + u_deslocamento, 0.0, 1.0);
+            }
+        )";
+    }
+    if (modo == renderizacao::sdf) {
+        // location 0 já é a posição relativa ao centro da forma
+        // location 1: meia largura, meia altura e raio do canto
+        return R"(
+            #version 330 core
+            uniform vec2 u_deslocamento;
+            uniform mat2 u_escalaRotacao;
+            layout(location = 0) in vec2 vitor;
+            layout(location = 1) in vec3 a_forma;
+            out vec2 v_local;
+            flat out vec3 v_forma;
+            void main() {
+                v_local = vitor;
+                v_forma = a_forma;
+                gl_Position = vec4(u_escalaRotacao * vitor + u_deslocamento, 0.0, 1.0);
+            }
+        )";
+    }
     return R"(
         #version 330 core
         //uniform float u_time;
+        uniform vec2 u_deslocamento;
+        uniform mat2 u_escalaRotacao;
         layout(location = 0) in vec2 vitor;
         void main() {
             //float offset = cos(u_time*10)*0.5;
             //vec2 pos = vec2(offset, offset);
-            gl_Position = vec4(vitor, 0.0, 1.0);
+            gl_Position = vec4(u_escalaRotacao * vitor + u_deslocamento, 0.0, 1.0);
         }
     )";
 }
 
+std::string visual::geraVertexShaderPorInstancia() const {
+    //troca só as declarações: o corpo continua usando u_deslocamento e u_escalaRotacao
+    std::string fonte = geraVertexShader();
+    auto trocar = [&fonte](const char* antes, const char* depois) {
+        size_t pos = fonte.find(antes);
+        if (pos != std::string::npos) fonte.replace(pos, std::string(antes).size(), depois);
+    };
+    trocar("uniform vec2 u_deslocamento;",
+           "layout(location = 2) in vec2 a_deslocamento;\n#define u_deslocamento a_deslocamento");
+    trocar("uniform mat2 u_escalaRotacao;",
+           "layout(location = 3) in vec4 a_escalaRotacao;\n#define u_escalaRotacao mat2(a_escalaRotacao)");
+    return fonte;
+}
+
+bool visual::mesmoMaterial(const visual& outro) const {
+    //a camada da textura vai nos vértices: materiais texturizados só diferem pela cor
+    if (color != outro.color || modo != outro.modo || usaTextura() != outro.usaTextura()) return false;
+    return modo != renderizacao::sdf ||
+           (larguraContorno == outro.larguraContorno && corContorno == outro.corContorno);
+}
+
 const char* visual::geraFragmentShader() const {
+    if (modo == renderizacao::sdf) {
+        return fonteFragmentSDF.c_str();
+    }
+    if (usaTextura()) {
+        return fonteFragmentTextura.c_str();
+    }
     switch (color) {
         case cor::blue:
             return R"(
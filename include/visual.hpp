@@ -21,18 +21,49 @@ enum class textura{
     metal
 };
 
+// modo como a forma é rasterizada
+enum class renderizacao{
+    triangulos, // geometria tesselada (padrão)
+    sdf         // um único quad avaliando a distância analítica no fragment shader
+};
+
 class visual {
     private:
         cor color;
         textura texture;
+        renderizacao modo;
+        float larguraContorno;
+        cor corContorno;
+        std::string fonteFragmentSDF; // montado em ativarSDF, precisa viver junto com o objeto
+        std::string fonteFragmentTextura; // montado no construtor quando há textura
+
     public:
         visual(cor c = cor::white, textura t = textura::none);
 
+        //cor do enum como expressão GLSL vec4 (rainbow usa o uniform u_time)
+        static const char* expressaoCor(cor c);
+
+        //liga o modo SDF: bordas suavizadas e contorno opcional (largura em unidades NDC)
+        void ativarSDF(float larguraContorno = 0.0f, cor corContorno = cor::black);
+        void desativarSDF();
+
         const char* geraVertexShader() const;
         const char* geraFragmentShader() const;
 
+        //mesmo vertex shader, com posição e matriz vindas de atributos por instância
+        //(location 2: deslocamento, location 3: colunas da matriz) em vez de uniforms
+        std::string geraVertexShaderPorInstancia() const;
+
+        //mesmos shaders: formas com o mesmo material podem dividir um programa
+        bool mesmoMaterial(const visual& outro) const;
+
         cor getColor() const { return color; }
         textura getTexture() const { return texture; }
+        bool usaSDF() const { return modo == renderizacao::sdf; }
+        //textura só no modo de triângulos: no modo SDF ela é ignorada
+        bool usaTextura() const { return texture != textura::none && modo != renderizacao::sdf; }
+        float getLarguraContorno() const { return larguraContorno; }
+        cor getCorContorno() const { return corContorno; }
 };
 
 #endif
\ No newline at end of file
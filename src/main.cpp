@@ -9,22 +9,136 @@
  * - Classe base abstrata Forma
  * - Classes derivadas: Triangulo, Quadrado, Retangulo, Circulo
  * - Sistema de visualização com cores e shaders
+ * - Modo SDF: círculos e retângulos (arredondados) como um único quad
+ * - Bolinhas com física: integração, fase ampla e geração de vértices
+ *   em paralelo no SistemaJobs
+ * - Thread de render dona do contexto OpenGL executando listas de comandos
+ *   gravadas pela thread do jogo (quadro N+1 simulado durante o render do N)
+ * - Partida de ping-pong com passo fixo (W/S e setas), gravada em
+ *   replays/ultima.ppr ao fechar (reproduzir com `make replay`); sem as
+ *   setas, a raquete da direita é do OponenteIA
+ * - Latência da tecla até a tela (percentis no HUD) e trava tardia da
+ *   entrada das raquetes (tecla L liga/desliga)
+ * - Captura assíncrona do framebuffer: P grava um PNG e V liga/desliga um
+ *   vídeo Y4M, ambos em capturas/
+ * - Cena binária opcional (./app cena.ppcn): arquivo mapeado em memória e
+ *   desenhado com um draw instanciado por lote, atrás do resto
  */
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
 #include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
 
 // Sistema de formas geométricas modular
 #include "geometry/Triangulo.hpp"
 #include "geometry/Quadrado.hpp"
 #include "geometry/Retangulo.hpp"
 #include "geometry/Circulo.hpp"
+#include "geometry/PoligonoRegular.hpp"
+#include "geometry/Estrela.hpp"
+#include "geometry/Elipse.hpp"
+#include "geometry/Poligono.hpp"
+#include "geometry/GeometriaEstatica.hpp"
+#include "geometry/DesenhoMultiplo.hpp"
+#include "geometry/FilaDesenho.hpp"
+#include "geometry/RegistroMalhas.hpp"
 
 // Utilitários de inicialização e visualização
 #include "init.hpp"
 #include "visual.hpp"
 
+// Paralelismo e simulação (sem OpenGL)
+#include "core/ArenaQuadro.hpp"
+#include "core/MedidorLatencia.hpp"
+#include "core/RastreioAlocacoes.hpp"
+#include "core/SistemaJobs.hpp"
+#include "fisica/MundoFisico.hpp"
+#include "jogo/OponenteIA.hpp"
+#include "jogo/Partida.hpp"
+#include "jogo/Replay.hpp"
+#include "cena/Cena.hpp"
+
+// Thread de render e listas de comandos
+#include "render/ListaComandos.hpp"
+#include "render/ThreadRender.hpp"
+#include "render/Texto.hpp"
+#include "render/Particulas.hpp"
+#include "render/BancoTexturas.hpp"
+#include "render/CapturaQuadros.hpp"
+#include "render/RenderizadorCena.hpp"
+
+// Quantidade de bolinhas da demonstração de física
+static const int NUM_BOLINHAS = 64;
+
+// Onde a sessão é gravada ao fechar a janela
+static const char* ARQUIVO_REPLAY = "replays/ultima.ppr";
+
+/**
+ * @brief Amostra o teclado no formato de entrada da Partida
+ * 
+ * Jogador 1: W/S. Jogador 2: setas para cima/baixo.
+ */
+static uint8_t teclasPressionadas(GLFWwindow* window) {
+    uint8_t result = 0;
+    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS) result |= ENTRADA_P1_CIMA;
+    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS) result |= ENTRADA_P1_BAIXO;
+    if (glfwGetKey(window, GLFW_KEY_UP) == GLFW_PRESS) result |= ENTRADA_P2_CIMA;
+    if (glfwGetKey(window, GLFW_KEY_DOWN) == GLFW_PRESS) result |= ENTRADA_P2_BAIXO;
+    return result;
+}
+
+/**
+ * @struct EstadoEntrada
+ * @brief O que o callback de teclado alcança pelo ponteiro de usuário da janela
+ */
+struct EstadoEntrada {
+    MedidorLatencia* medidor;
+    bool travaTardia;     ///< Lê as teclas das raquetes logo antes de enviar o quadro (custa a sobreposição jogo/render)
+    bool trocouModo;      ///< L foi apertada desde o último quadro
+    bool pedirFoto;       ///< P: captura de tela no próximo quadro
+    bool alternarVideo;   ///< V: começa ou termina a gravação de vídeo
+};
+
+/**
+ * @brief Callback de teclado (roda dentro do glfwPollEvents)
+ *
+ * Marca o instante de cada tecla das raquetes para o MedidorLatencia,
+ * alterna a trava tardia com L e anota os pedidos de captura (P e V).
+ */
+static void aoTeclar(GLFWwindow* window, int tecla, int, int acao, int) {
+    EstadoEntrada* estado = static_cast<EstadoEntrada*>(glfwGetWindowUserPointer(window));
+    if (!estado || acao == GLFW_REPEAT) return;
+    switch (tecla) {
+        case GLFW_KEY_W:
+        case GLFW_KEY_S:
+        case GLFW_KEY_UP:
+        case GLFW_KEY_DOWN:
+            estado->medidor->evento();
+            break;
+        case GLFW_KEY_L:
+            if (acao == GLFW_PRESS) {
+                estado->travaTardia = !estado->travaTardia;
+                estado->trocouModo = true;
+            }
+            break;
+        case GLFW_KEY_P:
+            if (acao == GLFW_PRESS) estado->pedirFoto = true;
+            break;
+        case GLFW_KEY_V:
+            if (acao == GLFW_PRESS) estado->alternarVideo = true;
+            break;
+        default:
+            break;
+    }
+}
+
 /**
  * @brief Ponto de entrada da aplicação
  * 
@@ -34,8 +148,10 @@
  * 3. Cria diferentes formas geométricas
  * 4. Loop de renderização
  * 5. Cleanup automático
+ *
+ * Uso: ./app [cena.ppcn]
  */
-int main() {
+int main(int argc, char** argv) {
     // ========== INICIALIZAÇÃO ==========
     
     // Configura callbacks de erro do GLFW
@@ -66,6 +182,10 @@ int main() {
         return -1; 
     }
     
+    // Mistura por alpha: as formas SDF usam a cobertura do pixel como alpha
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    
     // ========== CRIAÇÃO DAS FORMAS ==========
     
     std::cout << "\n=== Criando Formas Geométricas ===" << std::endl;
@@ -102,53 +222,406 @@ int main() {
     std::cout << "5. Triângulo padrão animado (centro)" << std::endl;
     Triangulo trianguloAnimado(corAnimada);
     
+    // 6. CÍRCULO SDF amarelo com contorno laranja (4 vértices, borda suave)
+    std::cout << "6. Círculo SDF com contorno (direita)" << std::endl;
+    visual corSDF(cor::yellow);
+    corSDF.ativarSDF(0.015f, cor::orange);
+    Circulo circuloSDF(0.15f, corSDF);
+    circuloSDF.setPosicao(0.55f, -0.35f);
+    
+    // 7. RETÂNGULO SDF com cantos arredondados (topo)
+    std::cout << "7. Retângulo SDF arredondado (topo)" << std::endl;
+    visual corArredondada(cor::blue);
+    corArredondada.ativarSDF(0.01f, cor::white);
+    Retangulo retanguloArredondado(0.5f, 0.15f, corArredondada);
+    retanguloArredondado.setPosicao(-0.2f, 0.8f);
+    retanguloArredondado.setRaioCanto(0.05f);
+    
+    // 8. BOLINHAS quicando: física calculada pelas threads do pool; todas dividem uma malha
+    SistemaJobs jobs;
+    std::cout << "8. " << NUM_BOLINHAS << " bolinhas com física (" 
+              << jobs.getNumThreads() << " threads)" << std::endl;
+    MundoFisico mundo;
+    std::vector<std::unique_ptr<Circulo>> bolinhas;
+    visual corBolinha(cor::rainbow);
+    corBolinha.ativarSDF();
+    std::mt19937 gerador(42);
+    std::uniform_real_distribution<float> posicao(-0.9f, 0.9f);
+    std::uniform_real_distribution<float> velocidade(-0.6f, 0.6f);
+    for (int i = 0; i < NUM_BOLINHAS; i++) {
+        float x = posicao(gerador);
+        float y = posicao(gerador);
+        mundo.adicionarCorpo(x, y, velocidade(gerador), velocidade(gerador), 0.02f);
+        bolinhas.push_back(std::make_unique<Circulo>(x, y, 0.02f, 16, corBolinha));
+    }
+    
+    // 9. HUD: todo o texto do quadro sai em um único draw call
+    std::cout << "9. HUD com texto SDF" << std::endl;
+    RenderizadorTexto texto(800, 600);
+    const CorRGBA corHUD{1.0f, 1.0f, 1.0f, 0.9f};
+    TextoCache textoBolinhas;
+    TextoCache textoFPS;
+    textoBolinhas.definir("BOLINHAS: " + std::to_string(NUM_BOLINHAS), -0.97f, -0.95f, 0.05f, corHUD);
+    
+    // 10. PARTÍCULAS na GPU: faíscas nas colisões e rastro da primeira bolinha
+    std::cout << "10. Partículas (transform feedback)" << std::endl;
+    SistemaParticulas faiscas;
+    ConfigParticulas configRastro;
+    configRastro.maxParticulas = 4096;
+    configRastro.vidaMin = 0.3f;
+    configRastro.vidaMax = 0.5f;
+    configRastro.velocidadeMin = 0.0f;
+    configRastro.velocidadeMax = 0.05f;
+    configRastro.gravidadeY = 0.0f;
+    configRastro.tamanhoInicial = 0.015f;
+    configRastro.tamanhoFinal = 0.0f;
+    configRastro.corInicial[0] = 0.6f; configRastro.corInicial[1] = 0.8f;
+    configRastro.corInicial[2] = 1.0f; configRastro.corInicial[3] = 0.6f;
+    configRastro.corFinal[0] = 0.3f; configRastro.corFinal[1] = 0.3f;
+    configRastro.corFinal[2] = 1.0f; configRastro.corFinal[3] = 0.0f;
+    SistemaParticulas rastro(configRastro);
+    
+    // 11. FORMAS TEXTURIZADAS: materiais diferentes, mesma textura (array) e mesmo shader
+    std::cout << "11. Raquetes de madeira e bloco de metal (texturas)" << std::endl;
+    Retangulo raquetes[2] = {
+        Retangulo(-Partida::RAQUETE_X, 0.0f, 2.0f * Partida::RAQUETE_MEIA_LARGURA,
+                  2.0f * Partida::RAQUETE_MEIA_ALTURA, visual(cor::white, textura::wood)),
+        Retangulo(Partida::RAQUETE_X, 0.0f, 2.0f * Partida::RAQUETE_MEIA_LARGURA,
+                  2.0f * Partida::RAQUETE_MEIA_ALTURA, visual(cor::white, textura::wood))
+    };
+    Quadrado blocoMetal(0.8f, -0.7f, 0.25f, visual(cor::white, textura::metal));
+    
+    // 12. PARTIDA: simulação com passo fixo, sem OpenGL; cada tick é gravado
+    uint64_t semente = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    std::cout << "12. Partida de ping-pong (semente " << semente << ")" << std::endl;
+    Partida partida(semente);
+    visual corBola(cor::white);
+    corBola.ativarSDF();
+    Circulo bola(0.0f, 0.0f, Partida::BOLA_RAIO, 16, corBola);
+    Replay gravacao;
+    gravacao.semente = semente;
+    gravacao.ticksPorSegundo = Partida::TICKS_POR_SEGUNDO;
+    gravacao.entradas.reserve(Partida::TICKS_POR_SEGUNDO * 60 * 30);  // 30 min sem realocar
+    TextoCache textoPlacar;
+    uint32_t placarExibido[2] = {~0u, ~0u};
+    ConfigIA configIA;
+    configIA.jogador = 1;
+    configIA.semente = static_cast<uint32_t>(semente);
+    OponenteIA oponente(configIA);
+    
+    // 13. CAPTURA: leitura do framebuffer em PBOs, PNG/Y4M gravados em outra thread
+    std::cout << "13. Captura de tela (P) e vídeo (V)" << std::endl;
+    CapturaQuadros captura(800, 600);
+    
+    // 14. CENA BINÁRIA (opcional): mmap + validação + um envio para a GPU, sem objeto por forma
+    RenderizadorCena renderizadorCena;
+    if (argc > 1) {
+        auto inicioCena = std::chrono::steady_clock::now();
+        Cena cena;
+        if (cena.abrir(argv[1])) {
+            auto mapeada = std::chrono::steady_clock::now();
+            renderizadorCena.carregar(cena);
+            glFinish();
+            auto enviada = std::chrono::steady_clock::now();
+            std::cout << "14. Cena " << argv[1] << ": " << cena.getNumFormas() << " formas em "
+                      << cena.getNumLotes() << " lotes (mapear e validar "
+                      << std::chrono::duration<double, std::milli>(mapeada - inicioCena).count() << " ms, enviar "
+                      << std::chrono::duration<double, std::milli>(enviada - mapeada).count() << " ms)" << std::endl;
+        } else {
+            std::cerr << "AVISO: cena " << argv[1] << " ignorada: " << cena.getErro() << std::endl;
+        }
+    }
+    
+    // 15. POLÍGONOS REGULARES: tesselação unitária em cache, tamanho na escala do shader
+    std::cout << "15. Hexágonos, estrela girando e elipse (malhas unitárias)" << std::endl;
+    PoligonoRegular hexagonos[3] = {
+        PoligonoRegular(-0.30f, -0.88f, 6, 0.06f, visual(cor::blue)),
+        PoligonoRegular(-0.18f, -0.88f, 6, 0.05f, visual(cor::blue)),
+        PoligonoRegular(-0.08f, -0.88f, 6, 0.04f, visual(cor::blue))
+    };
+    Estrela estrela(-0.82f, 0.62f, 5, 0.1f, 0.45f, visual(cor::yellow));
+    Elipse elipse(0.2f, -0.88f, 0.12f, 0.04f, 32, visual(cor::green));
+    
+    // 16. POLÍGONO CÔNCAVO: contorno qualquer triangulado uma vez (cache pelo hash do contorno)
+    std::cout << "16. Engrenagem côncava (triangulação por corte de orelhas)" << std::endl;
+    std::vector<float> contornoEngrenagem;
+    for (int i = 0; i < 144; i++) {
+        float angulo = 2.0f * 3.14159265f * i / 144.0f;
+        float raio = (i / 6) % 2 == 0 ? 0.1f : 0.07f;   // 12 dentes de 6 pontos
+        contornoEngrenagem.push_back(raio * std::cos(angulo));
+        contornoEngrenagem.push_back(raio * std::sin(angulo));
+    }
+    Poligono engrenagem(0.82f, 0.62f, contornoEngrenagem, visual(cor::orange));
+    
+    // 17. GEOMETRIA ESTÁTICA: o que não se mexe vira um lote por material (uma chamada cada)
+    std::cout << "17. Formas paradas assadas por material" << std::endl;
+    Forma* estaticas[] = { &triangulo, &quadrado, &retangulo, &circulo, &trianguloAnimado,
+                           &blocoMetal, &hexagonos[0], &hexagonos[1], &hexagonos[2], &elipse };
+    for (Forma* forma : estaticas) {
+        forma->setEstatica(true);
+    }
+    GeometriaEstatica::instancia().assar();
+    
+    // 18. FILA DE DESENHO: formas que se mexem ordenadas por chave; as bolinhas
+    // dividem programa e malha, e saem juntas em um desenho múltiplo
+    FilaDesenho fila;
+    fila.prepararLote(*bolinhas[0]);
+    std::cout << "18. Fila de desenho ordenada, bolinhas em um desenho múltiplo ("
+              << (DesenhoMultiplo::indiretoDisponivel() ? "glMultiDrawArraysIndirect" : "instanciado, GL 3.3")
+              << ")" << std::endl;
+    
+    // Formas de mesmos parâmetros (as bolinhas, as raquetes, os hexágonos) dividem VAO/VBO
+    RegistroMalhas::instancia().relatorio(std::cout);
+    GeometriaEstatica::instancia().relatorio(std::cout);
+    
     std::cout << "\n=== Iniciando Loop de Renderização ===" << std::endl;
     
     // ========== LOOP DE RENDERIZAÇÃO ==========
     
+    // A partir daqui o contexto OpenGL pertence à thread de render:
+    // esta thread simula, grava listas de comandos e processa eventos
+    glfwMakeContextCurrent(nullptr);
+    ThreadRender render(window);
+    
+    // Memória temporária do quadro (fase ampla da física etc.), zerada no fim de cada quadro
+    ArenaQuadro arena(64 * 1024);
+    unsigned long quadro = 0;
+    unsigned long quadrosComMalloc = 0;  // após o aquecimento deve ficar em zero
+    
+    // Latência de entrada: eventos vêm do callback, a apresentação da thread de render
+    // Trava tardia começa desligada: ela espera a thread de render ficar livre
+    // a cada quadro, e o jogo deixa de gravar enquanto o quadro anterior executa
+    MedidorLatencia medidor;
+    EstadoEntrada estadoEntrada{&medidor, false, false, false, false};
+    glfwSetWindowUserPointer(window, &estadoEntrada);
+    glfwSetKeyCallback(window, aoTeclar);
+    render.setAoApresentar([](void* contexto, unsigned long quadroApresentado) {
+        static_cast<MedidorLatencia*>(contexto)->apresentou(quadroApresentado);
+    }, &medidor);
+    TextoCache textoLatencia;
+    textoLatencia.definir("ENTRADA: --", -0.97f, 0.83f, 0.05f, corHUD);
+    
+    float tempoAnterior = glfwGetTime();
+    float acumuladorPartida = 0.0f;
+    float inicioContagemFPS = tempoAnterior;
+    int quadrosContagemFPS = 0;
+    textoFPS.definir("FPS: --", -0.97f, 0.9f, 0.05f, corHUD);
     while (!glfwWindowShouldClose(window)) {
         // Obtém o tempo atual (para animações)
         float timeValue = glfwGetTime();
         
-        // Limpa o buffer de cor com uma cor de fundo roxa
-        glClearColor(0.15f, 0.05f, 0.25f, 1.0f);
-        glClear(GL_COLOR_BUFFER_BIT);
+        // Passo da física limitado para não atravessar paredes após travadas
+        float dt = timeValue - tempoAnterior;
+        tempoAnterior = timeValue;
+        if (dt > 1.0f / 30.0f) dt = 1.0f / 30.0f;
+        
+        // Contagem de alocações do quadro (só com -DRASTREAR_ALOCACOES)
+        iniciarQuadroAlocacoes();
+        
+        // ===== SIMULAÇÃO (threads do pool) =====
+        {
+            EscopoAlocacao escopo(Subsistema::fisica);
+            mundo.passo(dt, &jobs, &arena);
+        }
+        jobs.paraCada(bolinhas.size(), 16, [&](size_t i) {
+            EscopoAlocacao escopo(Subsistema::geometria);
+            bolinhas[i]->reposicionar(mundo.getX(i), mundo.getY(i));
+        });
         
-        // ===== DESENHA TODAS AS FORMAS =====
+        // Partida: quantos ticks fixos couberem no tempo do quadro; a entrada
+        // amostrada em cada tick é o que o replay guarda. Sem a trava tardia
+        // roda aqui; com ela, só depois de todo o resto do quadro gravado
+        acumuladorPartida += dt;
+        auto avancarPartida = [&]() {
+            bool amostrou = false;
+            while (acumuladorPartida >= Partida::TICK) {
+                uint8_t entradas = teclasPressionadas(window);
+                // A IA joga sempre (mantém a latência em dia), mas só vale sem as setas
+                uint8_t entradasIA = oponente.decidir(partida.getEstado());
+                if (!(entradas & (ENTRADA_P2_CIMA | ENTRADA_P2_BAIXO))) entradas |= entradasIA;
+                gravacao.entradas.push_back(entradas);
+                partida.passo(entradas);
+                acumuladorPartida -= Partida::TICK;
+                amostrou = true;
+            }
+            // Os eventos até aqui aparecem no quadro que está sendo gravado
+            if (amostrou) medidor.amostrou(quadro + 1);
+
+            const EstadoPartida& estadoPartida = partida.getEstado();
+            raquetes[0].reposicionar(-Partida::RAQUETE_X, paraFloat(estadoPartida.raqueteY[0]));
+            raquetes[1].reposicionar(Partida::RAQUETE_X, paraFloat(estadoPartida.raqueteY[1]));
+            bola.reposicionar(paraFloat(estadoPartida.bolaX), paraFloat(estadoPartida.bolaY));
+            if (estadoPartida.placar[0] != placarExibido[0] || estadoPartida.placar[1] != placarExibido[1]) {
+                char placar[32];
+                std::snprintf(placar, sizeof(placar), "%u : %u", estadoPartida.placar[0], estadoPartida.placar[1]);
+                textoPlacar.definir(placar, -texto.medirLargura(placar, 0.08f) / 2.0f, 0.85f, 0.08f, corHUD);
+                placarExibido[0] = estadoPartida.placar[0];
+                placarExibido[1] = estadoPartida.placar[1];
+            }
+        };
+        if (!estadoEntrada.travaTardia) avancarPartida();
+        
+        // ===== GRAVA O QUADRO (nenhuma chamada OpenGL nesta thread) =====
+        {
+            EscopoAlocacao escopo(Subsistema::render);
+            ListaComandos& lista = render.iniciarQuadro();
+        
+            // Limpa o buffer de cor com uma cor de fundo roxa
+            lista.limparTela(0.15f, 0.05f, 0.25f, 1.0f);
+        
+            // Cena carregada do arquivo, atrás de todas as formas
+            renderizadorCena.registrar(lista, timeValue);
+        
+            // Formas paradas (triângulos, quadrado, retângulo, círculo, bloco de metal,
+            // hexágonos e elipse): um draw call por material, reassado só se mudar
+            GeometriaEstatica::instancia().registrar(lista, timeValue);
+        
+            // Formas SDF (translúcidas) e polígonos que giram pelo uniform, sem
+            // reenviar vértices (as raquetes texturizadas vão no fim, depois da trava tardia)
+            fila.acrescentar(circuloSDF, 0);
+            fila.acrescentar(retanguloArredondado, 0);
+            estrela.setRotacao(timeValue);
+            fila.acrescentar(estrela, 0);
+            engrenagem.setRotacao(-timeValue);
+            fila.acrescentar(engrenagem, 0);
+        
+            // Bolinhas por cima: posições e matrizes de todas em um buffer, uma chamada de desenho
+            for (auto& bolinha : bolinhas) {
+                fila.acrescentar(*bolinha, 1);
+            }
+            fila.registrar(lista, timeValue);
         
-        // Triângulo azul customizado
-        triangulo.usar(timeValue);
-        triangulo.desenhar();
+            // Partículas: só emissões e uniforms por quadro, a simulação é na GPU
+            for (const ParColisao& par : mundo.getPares()) {
+                float dx = mundo.getX(par.b) - mundo.getX(par.a);
+                float dy = mundo.getY(par.b) - mundo.getY(par.a);
+                float soma = mundo.getRaio(par.a) + mundo.getRaio(par.b);
+                if (dx * dx + dy * dy <= soma * soma * 1.001f) {
+                    faiscas.emitir(mundo.getX(par.a) + dx * 0.5f, mundo.getY(par.a) + dy * 0.5f, 48);
+                }
+            }
+            rastro.emitir(mundo.getX(0), mundo.getY(0), 8);
+            rastro.registrar(lista, dt);
+            faiscas.registrar(lista, dt);
         
-        // Quadrado vermelho
-        quadrado.usar(timeValue);
-        quadrado.desenhar();
+            // Trava tardia: espera a thread de render liberar a vaga, lê o teclado
+            // de novo e só então avança a partida; o quadro sai logo em seguida
+            if (estadoEntrada.travaTardia) {
+                render.esperarVaga();
+                glfwPollEvents();
+                avancarPartida();
+            }
+            raquetes[0].registrar(lista, timeValue);
+            raquetes[1].registrar(lista, timeValue);
+            bola.registrar(lista, timeValue);
         
-        // Retângulo verde
-        retangulo.usar(timeValue);
-        retangulo.desenhar();
+            // HUD por cima de tudo; o FPS só refaz o layout uma vez por segundo
+            quadrosContagemFPS++;
+            if (timeValue - inicioContagemFPS >= 1.0f) {
+                char fps[32];
+                std::snprintf(fps, sizeof(fps), "FPS: %d", 
+                              static_cast<int>(quadrosContagemFPS / (timeValue - inicioContagemFPS) + 0.5f));
+                textoFPS.definir(fps, -0.97f, 0.9f, 0.05f, corHUD);
+                inicioContagemFPS = timeValue;
+                quadrosContagemFPS = 0;
         
-        // Círculo animado
-        circulo.usar(timeValue);
-        circulo.desenhar();
+                Percentis latencia = medidor.latenciaEntrada();
+                char linha[64];
+                if (latencia.amostras > 0) {
+                    std::snprintf(linha, sizeof(linha), "ENTRADA P50 %.1f P99 %.1f MS (%s)", latencia.p50,
+                                  latencia.p99, estadoEntrada.travaTardia ? "TARDIA" : "NORMAL");
+                } else {
+                    std::snprintf(linha, sizeof(linha), "ENTRADA: -- (%s)", estadoEntrada.travaTardia ? "TARDIA" : "NORMAL");
+                }
+                textoLatencia.definir(linha, -0.97f, 0.83f, 0.05f, corHUD);
+            }
+            texto.adicionar(textoFPS);
+            texto.adicionar(textoLatencia);
+            texto.adicionar(textoBolinhas);
+            texto.adicionar(textoPlacar);
+            texto.registrar(lista);
         
-        // Triângulo animado central
-        trianguloAnimado.usar(timeValue);
-        trianguloAnimado.desenhar();
+            // Captura lê o quadro pronto, logo antes do swap
+            if (estadoEntrada.pedirFoto) {
+                estadoEntrada.pedirFoto = false;
+                char caminho[64];
+                std::snprintf(caminho, sizeof(caminho), "capturas/quadro_%06lu.png", quadro + 1);
+                captura.fotografar(caminho);
+                std::cout << "Captura: " << caminho << std::endl;
+            }
+            if (estadoEntrada.alternarVideo) {
+                estadoEntrada.alternarVideo = false;
+                if (captura.gravandoVideo()) {
+                    captura.pararVideo();
+                    std::cout << "Vídeo parado" << std::endl;
+                } else {
+                    char caminho[64];
+                    std::snprintf(caminho, sizeof(caminho), "capturas/video_%06lu.y4m", quadro + 1);
+                    captura.iniciarVideo(caminho, 60);
+                    std::cout << "Gravando vídeo em " << caminho << std::endl;
+                }
+            }
+            captura.registrar(lista);
         
-        // Troca os buffers (double buffering)
-        glfwSwapBuffers(window);
+            // Entrega para a thread de render (que executa e faz o swap)
+            // e já segue para simular o próximo quadro
+            render.enviarQuadro();
+        }
+        
+        // Fim do quadro: os jobs já terminaram, a memória temporária volta toda
+        arena.reiniciar();
+        if (++quadro > 10 && arena.getAlocacoesHeapUltimoQuadro() > 0) {
+            quadrosComMalloc++;
+        }
+        
+        // A cada ~5 s, quem alocou neste quadro
+        if (rastreioAtivo() && quadro % 300 == 0) {
+            std::cout << "Alocações no quadro " << quadro << ":" << std::endl;
+            relatorioAlocacoes(std::cout);
+        }
         
         // Processa eventos (teclado, mouse, etc.)
         glfwPollEvents();
+        
+        // Trocou de modo: fecha as medições do anterior para não misturar
+        if (estadoEntrada.trocouModo) {
+            estadoEntrada.trocouModo = false;
+            medidor.relatorio(std::cout, estadoEntrada.travaTardia ? "Latência (normal)" : "Latência (trava tardia)");
+            medidor.reiniciar();
+            std::cout << "Trava tardia " << (estadoEntrada.travaTardia ? "ligada" : "desligada") << std::endl;
+        }
     }
     
     // ========== CLEANUP ==========
-    // Os destrutores das formas são chamados automaticamente
+    // A thread de render termina o último quadro e devolve o contexto;
+    // os destrutores das formas são chamados automaticamente
     // e liberam todos os recursos OpenGL (VAO, VBO, shaders)
+    render.encerrar();
+    glfwMakeContextCurrent(window);
+    captura.encerrar();
     
     std::cout << "\n=== Encerrando Aplicação ===" << std::endl;
+    if (render.getQuadrosTransbordados()) {
+        std::cout << "Lista de comandos cheia em " << render.getQuadrosTransbordados() << " quadros" << std::endl;
+    }
+    captura.relatorio(std::cout);
+    fila.relatorio(std::cout);
+    medidor.relatorio(std::cout, estadoEntrada.travaTardia ? "Latência (trava tardia)" : "Latência (normal)");
+    
+    // Grava a sessão: semente + entradas de cada tick reproduzem a partida inteira
+    gravacao.checksumFinal = partida.checksum();
+    std::error_code erroDiretorio;
+    std::filesystem::create_directories(std::filesystem::path(ARQUIVO_REPLAY).parent_path(), erroDiretorio);
+    if (salvarReplay(ARQUIVO_REPLAY, gravacao)) {
+        std::cout << "Replay: " << gravacao.entradas.size() << " ticks gravados em " << ARQUIVO_REPLAY << std::endl;
+    } else {
+        std::cerr << "AVISO: não foi possível gravar o replay em " << ARQUIVO_REPLAY << std::endl;
+    }
+    std::cout << "Arena do quadro: pico de " << arena.getPicoBytes() << " bytes, "
+              << quadrosComMalloc << " quadros com malloc após o aquecimento" << std::endl;
     
+    GeometriaEstatica::instancia().liberar();
+    BancoTexturas::instancia().liberar();
     glfwDestroyWindow(window);
     glfwTerminate();
     
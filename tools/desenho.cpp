@@ -0,0 +1,169 @@
+/**
+ * @file desenho.cpp
+ * @brief Custo de submissão: laço por forma contra o desenho múltiplo
+ *
+ * Janela invisível, N desenhos de círculos pequenos do mesmo material e
+ * três maneiras de mandar tudo para a GPU:
+ * - por forma: o que Forma::registrar() grava (programa, posição, matriz
+ *   e um glDrawArrays por forma);
+ * - indireto: DesenhoMultiplo com glMultiDrawArraysIndirect;
+ * - instanciado: DesenhoMultiplo no caminho de GL 3.3.
+ *
+ * Cada uma roda com a mesma malha para todos (os comandos se juntam em
+ * instâncias) e com malhas sorteadas (um comando por desenho, o pior caso
+ * do multi-draw). "gravar" é o tempo da thread do jogo; "executar" é o da
+ * thread de render, até o glFinish. O laço por forma aqui usa um programa
+ * só: na aplicação cada forma tem o seu, e ele custa ainda mais.
+ *
+ * Uso: ./desenho_app [desenhos=10000] [quadros=30]   (roda também com 10x os desenhos)
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "init.hpp"
+#include "geometry/Circulo.hpp"
+#include "geometry/DesenhoMultiplo.hpp"
+#include "render/ListaComandos.hpp"
+
+using relogio = std::chrono::steady_clock;
+
+static double milissegundos(relogio::time_point inicio) {
+    return std::chrono::duration<double, std::milli>(relogio::now() - inicio).count();
+}
+
+/// Um desenho: faixa de uma malha e onde ela vai
+struct Item {
+    const Circulo* malha;
+    float x, y;
+};
+
+struct Tempos {
+    double gravar = 0.0;
+    double executar = 0.0;
+};
+
+/// Grava e executa `quadros` quadros (mais 3 de aquecimento) e devolve a média
+template <typename Gravar>
+static Tempos medir(ListaComandos& lista, int quadros, Gravar gravar) {
+    Tempos total;
+    for (int q = -3; q < quadros; q++) {
+        lista.reiniciar();
+        relogio::time_point inicio = relogio::now();
+        gravar(lista);
+        double gravacao = milissegundos(inicio);
+
+        inicio = relogio::now();
+        glClear(GL_COLOR_BUFFER_BIT);
+        lista.executar();
+        glFinish();
+        double execucao = milissegundos(inicio);
+        if (q >= 0) {
+            total.gravar += gravacao;
+            total.executar += execucao;
+        }
+    }
+    total.gravar /= quadros;
+    total.executar /= quadros;
+    return total;
+}
+
+static void rodar(size_t numDesenhos, int quadros, bool malhasVariadas,
+                  const std::vector<std::unique_ptr<Circulo>>& modelos, DesenhoMultiplo& multiplo) {
+    std::mt19937 gerador(7);
+    std::uniform_real_distribution<float> posicao(-0.95f, 0.95f);
+    std::vector<Item> itens(numDesenhos);
+    for (Item& item : itens) {
+        item.malha = modelos[malhasVariadas ? gerador() % modelos.size() : 0].get();
+        item.x = posicao(gerador);
+        item.y = posicao(gerador);
+    }
+
+    // Mesmas posições nas três: só a maneira de submeter muda
+    const Circulo& modelo = *modelos[0];
+    GLuint programa = modelo.getShaderProgram();
+    GLint deslocamentoLoc = glGetUniformLocation(programa, "u_deslocamento");
+    GLint escalaRotacaoLoc = glGetUniformLocation(programa, "u_escalaRotacao");
+    ListaComandos lista(numDesenhos * 4 + 16, 1 << 20);
+
+    Tempos porForma = medir(lista, quadros, [&](ListaComandos& l) {
+        for (const Item& item : itens) {
+            l.usarPrograma(programa);
+            l.uniformVec2(deslocamentoLoc, item.x, item.y);
+            l.uniformMat2(escalaRotacaoLoc, item.malha->getEscalaRotacao());
+            l.desenhar(item.malha->getVAO(), item.malha->getModoDesenho(),
+                       item.malha->getPrimeiroVertice(), item.malha->getNumeroVertices());
+        }
+    });
+
+    auto gravarMultiplo = [&](ListaComandos& l) {
+        for (const Item& item : itens) {
+            multiplo.acrescentar(item.malha->getPrimeiroVertice(), item.malha->getNumeroVertices(),
+                                 item.x, item.y, item.malha->getEscalaRotacao());
+        }
+        multiplo.registrar(l, 0.0f);
+    };
+    Tempos indireto;
+    bool temIndireto = DesenhoMultiplo::indiretoDisponivel();
+    size_t chamadasIndireto = 0;
+    if (temIndireto) {
+        multiplo.setCaminho(DesenhoMultiplo::Caminho::indireto);
+        indireto = medir(lista, quadros, gravarMultiplo);
+        chamadasIndireto = multiplo.getEstatisticas().chamadasGL;
+    }
+    multiplo.setCaminho(DesenhoMultiplo::Caminho::instanciado);
+    Tempos instanciado = medir(lista, quadros, gravarMultiplo);
+    const EstatisticasDesenhoMultiplo& e = multiplo.getEstatisticas();
+
+    std::printf("\n%zu desenhos, %s (%zu comandos):\n", numDesenhos,
+                malhasVariadas ? "malhas sorteadas" : "mesma malha", e.comandos);
+    std::printf("  %-12s %10s %10s %10s\n", "caminho", "gravar ms", "executar ms", "chamadas");
+    std::printf("  %-12s %10.3f %10.3f %10zu\n", "por forma", porForma.gravar, porForma.executar, numDesenhos);
+    if (temIndireto) {
+        std::printf("  %-12s %10.3f %10.3f %10zu\n", "indireto", indireto.gravar, indireto.executar, chamadasIndireto);
+    } else {
+        std::printf("  %-12s %10s\n", "indireto", "indisponível neste driver");
+    }
+    std::printf("  %-12s %10.3f %10.3f %10zu\n", "instanciado", instanciado.gravar, instanciado.executar, e.chamadasGL);
+    if (lista.transbordou()) {
+        std::printf("  AVISO: a lista transbordou; os tempos do laço por forma estão incompletos\n");
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t numDesenhos = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    int quadros = argc > 2 ? std::atoi(argv[2]) : 30;
+
+    identificandoErros();
+    if (initGLFW() == -1) return 1;
+    hintswindow();
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* janela = glfwCreateWindow(800, 600, "desenho", nullptr, nullptr);
+    if (testJanela(janela) == -1) return 1;
+    glfwMakeContextCurrent(janela);
+    if (initopenglew() == -1) return 1;
+    std::printf("OpenGL %s (%s)\n", glGetString(GL_VERSION), glGetString(GL_RENDERER));
+
+    {
+        // Círculos pequenos de segmentos diferentes: malhas distintas do mesmo material
+        visual material(cor::blue);
+        std::vector<std::unique_ptr<Circulo>> modelos;
+        for (int segmentos : { 12, 16, 20, 24, 32, 48 }) {
+            modelos.push_back(std::make_unique<Circulo>(0.0f, 0.0f, 0.01f, segmentos, material));
+        }
+        DesenhoMultiplo multiplo(*modelos[0]);
+
+        for (size_t n : { numDesenhos, numDesenhos * 10 }) {
+            rodar(n, quadros, false, modelos, multiplo);
+            rodar(n, quadros, true, modelos, multiplo);
+        }
+    }
+
+    glfwDestroyWindow(janela);
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file replay.cpp
+ * @brief Reproduz uma partida gravada sem janela, na velocidade máxima
+ *
+ * Refaz a simulação tick a tick a partir da semente e das entradas do
+ * arquivo, confere o checksum final com o gravado e mede o tempo de cada
+ * tick: o tick mais lento aparece com o número, para investigar picos
+ * de desempenho com o mesmo estado que os causou.
+ *
+ * Uso: ./replay_app arquivo.ppr [repetições]
+ *      (com repetições > 1, a partida inteira é refeita várias vezes e o
+ *       resultado vira um benchmark da simulação isolada)
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "jogo/Partida.hpp"
+#include "jogo/Replay.hpp"
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "Uso: %s arquivo.ppr [repetições]\n", argv[0]);
+        return 2;
+    }
+    int repeticoes = argc > 2 ? std::atoi(argv[2]) : 1;
+    if (repeticoes < 1) repeticoes = 1;
+
+    Replay replay;
+    if (!carregarReplay(argv[1], replay)) {
+        std::fprintf(stderr, "ERRO: não foi possível ler o replay '%s'\n", argv[1]);
+        return 2;
+    }
+    if (replay.ticksPorSegundo != Partida::TICKS_POR_SEGUNDO) {
+        std::fprintf(stderr, "AVISO: replay gravado a %u ticks/s, simulação atual usa %u\n",
+                     replay.ticksPorSegundo, Partida::TICKS_POR_SEGUNDO);
+    }
+
+    size_t numTicks = replay.entradas.size();
+    std::printf("Replay: %zu ticks (%.1f s de jogo), semente %llu\n", numTicks,
+                static_cast<double>(numTicks) / Partida::TICKS_POR_SEGUNDO,
+                static_cast<unsigned long long>(replay.semente));
+    std::printf("Simulação em %s, gravação em %s\n", nomeTipoNumerico(TIPO_NUMERICO_ATUAL),
+                nomeTipoNumerico(replay.tipoNumerico));
+
+    // Outro tipo numérico é outra simulação: o checksum nunca conferiria
+    bool tipoConhecido = replay.tipoNumerico != TipoNumerico::desconhecido;
+    if (tipoConhecido && replay.tipoNumerico != TIPO_NUMERICO_ATUAL) {
+        std::fprintf(stderr, "ERRO: replay gravado em %s; este build simula em %s "
+                     "(recompile %s -DFISICA_PONTO_FIXO)\n", nomeTipoNumerico(replay.tipoNumerico),
+                     nomeTipoNumerico(TIPO_NUMERICO_ATUAL),
+                     replay.tipoNumerico == TipoNumerico::pontoFixoQ16_16 ? "com" : "sem");
+        return 2;
+    }
+
+    using relogio = std::chrono::steady_clock;
+    double segundosTotal = 0.0;
+    double piorTick = 0.0;
+    size_t indicePiorTick = 0;
+    uint64_t checksum = 0;
+    EstadoPartida final{};
+
+    for (int r = 0; r < repeticoes; r++) {
+        Partida partida(replay.semente);
+        auto inicio = relogio::now();
+        auto anterior = inicio;
+        for (size_t t = 0; t < numTicks; t++) {
+            partida.passo(replay.entradas[t]);
+
+            // Tempo por tick só na primeira passada (o relógio custa mais que o tick)
+            if (r == 0) {
+                auto agora = relogio::now();
+                double duracao = std::chrono::duration<double>(agora - anterior).count();
+                if (duracao > piorTick) {
+                    piorTick = duracao;
+                    indicePiorTick = t;
+                }
+                anterior = agora;
+            }
+        }
+        segundosTotal += std::chrono::duration<double>(relogio::now() - inicio).count();
+
+        // Todas as repetições precisam terminar no mesmo estado
+        if (r == 0) {
+            checksum = partida.checksum();
+            final = partida.getEstado();
+        } else if (partida.checksum() != checksum) {
+            std::printf("ERRO: repetição %d divergiu da primeira\n", r);
+            return 1;
+        }
+    }
+
+    double ticksPorSegundo = segundosTotal > 0.0 ? numTicks * repeticoes / segundosTotal : 0.0;
+    std::printf("Placar final: %u x %u\n", final.placar[0], final.placar[1]);
+    std::printf("Tempo: %.3f ms por partida, %.0f ticks/s (%.0fx tempo real)\n",
+                segundosTotal * 1000.0 / repeticoes, ticksPorSegundo,
+                ticksPorSegundo / Partida::TICKS_POR_SEGUNDO);
+    std::printf("Tick mais lento: #%zu (%.3f us)\n", indicePiorTick, piorTick * 1e6);
+
+    bool confere = checksum == replay.checksumFinal;
+    std::printf("Checksum: %016llx (gravado %016llx) %s\n", static_cast<unsigned long long>(checksum),
+                static_cast<unsigned long long>(replay.checksumFinal),
+                confere ? "OK" : (tipoConhecido ? "DIVERGIU" : "DIVERGIU (versão 1: tipo numérico da gravação desconhecido)"));
+    return confere ? 0 : 1;
+}
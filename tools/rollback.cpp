@@ -0,0 +1,199 @@
+/**
+ * @file rollback.cpp
+ * @brief Duas pontas de rollback no mesmo processo, ligadas por UDP em loopback
+ *
+ * Cada ponta tem sua SessaoRollback e seu TransporteUDP (portas trocadas),
+ * com o simulador de rede aplicando latência, jitter e perda nos dois
+ * sentidos. Jogadores automáticos mudam de ideia com frequência para
+ * forçar previsões erradas. Os ticks rodam em tempo real (120 Hz).
+ *
+ * No fim, as duas pontas param no mesmo tick e trocam pacotes até
+ * confirmar todas as entradas: os checksums precisam ser iguais. Também
+ * mede o custo de salvar/restaurar um snapshot e de um rollback de 8 ticks.
+ *
+ * Uso: ./rollback_app [latência ms=60] [jitter ms=20] [perda=0.05] [segundos=10]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "jogo/Partida.hpp"
+#include "rede/SessaoRollback.hpp"
+#include "rede/TransporteUDP.hpp"
+
+static const uint16_t PORTA_BASE = 47310;
+static const uint64_t SEMENTE = 20240601;
+
+using relogio = std::chrono::steady_clock;
+
+static volatile uint64_t sumidouro;
+
+/// Segue a bola, mas a cada ~0.1 s sorteia se obedece, inverte ou fica parado
+static uint8_t jogadorAutomatico(const EstadoPartida& e, int jogador, uint32_t& rng) {
+    if (e.tick % 12 == 0) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+    }
+    float diferenca = paraFloat(e.bolaY) - paraFloat(e.raqueteY[jogador]);
+    uint8_t teclas = 0;
+    if (diferenca > 0.03f) teclas = ENTRADA_P1_CIMA;
+    if (diferenca < -0.03f) teclas = ENTRADA_P1_BAIXO;
+    switch (rng % 4) {
+        case 0: return 0;
+        case 1: return teclas ? static_cast<uint8_t>(teclas ^ (ENTRADA_P1_CIMA | ENTRADA_P1_BAIXO)) : 0;
+        default: return teclas;
+    }
+}
+
+/**
+ * @struct Ponta
+ * @brief Um jogador: sessão, transporte e seu jogador automático
+ */
+struct Ponta {
+    int jogador;
+    SessaoRollback sessao;
+    TransporteUDP transporte;
+    uint32_t rng;
+    double maiorQuadroMs = 0.0;   ///< avancar() mais lento (inclui o rollback)
+
+    Ponta(int jogador, CondicoesRede condicoes)
+        : jogador(jogador), sessao(SEMENTE, jogador),
+          transporte(PORTA_BASE + jogador, PORTA_BASE + 1 - jogador, condicoes, 17u + jogador),
+          rng(0x9E3779B9u + jogador * 7919u) {}
+
+    /// Recebe, avança (ou só corrige) e envia: um tick de uma ponta
+    void tick(bool avancar) {
+        uint8_t pacote[TransporteUDP::MAX_PACOTE];
+        transporte.atualizar();
+        size_t tamanho;
+        while ((tamanho = transporte.receber(pacote, sizeof(pacote))) > 0) {
+            sessao.receberPacote(pacote, tamanho);
+        }
+
+        auto t0 = relogio::now();
+        if (avancar) {
+            sessao.avancar(jogadorAutomatico(sessao.getPartida().getEstado(), jogador, rng));
+        } else {
+            sessao.corrigir();
+        }
+        double ms = std::chrono::duration<double, std::milli>(relogio::now() - t0).count();
+        if (ms > maiorQuadroMs) maiorQuadroMs = ms;
+
+        tamanho = sessao.montarPacote(pacote, sizeof(pacote));
+        if (tamanho) transporte.enviar(pacote, tamanho);
+    }
+
+    bool sincronizada(uint32_t alvo) const {
+        return sessao.getTick() == alvo && sessao.getConfirmados() >= alvo && !sessao.temCorrecaoPendente();
+    }
+};
+
+/// Custo de um snapshot e de voltar 8 ticks (restaurar + resimular), em ns
+static void medirSnapshots() {
+    const int REPETICOES = 200000;
+    Partida partida(SEMENTE);
+    for (int i = 0; i < 300; i++) partida.passo(static_cast<uint8_t>(i % 5));
+
+    EstadoPartida anel[SessaoRollback::TAMANHO_HISTORICO];
+    auto t0 = relogio::now();
+    for (int i = 0; i < REPETICOES; i++) {
+        anel[i % SessaoRollback::TAMANHO_HISTORICO] = partida.getEstado();
+        partida.restaurar(anel[(i * 7) % SessaoRollback::TAMANHO_HISTORICO]);
+    }
+    double nsSnapshot = std::chrono::duration<double, std::nano>(relogio::now() - t0).count() / REPETICOES;
+
+    EstadoPartida inicio = partida.getEstado();
+    uint64_t acumulado = 0;
+    t0 = relogio::now();
+    for (int i = 0; i < REPETICOES; i++) {
+        partida.restaurar(inicio);
+        for (int t = 0; t < 8; t++) partida.passo(static_cast<uint8_t>((i + t) & 0x0F));
+        acumulado += partida.getEstado().tick;
+    }
+    sumidouro = acumulado;   // impede o compilador de descartar o laço
+    double nsRollback = std::chrono::duration<double, std::nano>(relogio::now() - t0).count() / REPETICOES;
+
+    std::printf("Snapshot (salvar + restaurar, %zu bytes): %.1f ns\n", sizeof(EstadoPartida), nsSnapshot);
+    std::printf("Rollback de 8 ticks: %.1f ns (%.0f rollbacks cabem em um quadro de 16.7 ms)\n",
+                nsRollback, 16.7e6 / nsRollback);
+}
+
+int main(int argc, char** argv) {
+    CondicoesRede condicoes;
+    condicoes.latenciaMs = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 60.0f;
+    condicoes.jitterMs = argc > 2 ? static_cast<float>(std::atof(argv[2])) : 20.0f;
+    condicoes.perda = argc > 3 ? static_cast<float>(std::atof(argv[3])) : 0.05f;
+    double segundos = argc > 4 ? std::atof(argv[4]) : 10.0;
+
+    Ponta pontas[2] = { Ponta(0, condicoes), Ponta(1, condicoes) };
+    if (!pontas[0].transporte.aberto() || !pontas[1].transporte.aberto()) {
+        std::fprintf(stderr, "ERRO: não foi possível abrir as portas UDP %u e %u\n", PORTA_BASE, PORTA_BASE + 1);
+        return 2;
+    }
+
+    std::printf("Rollback: latência %.0f ms, jitter ±%.0f ms, perda %.0f%%, %.0f s a %u Hz\n",
+                condicoes.latenciaMs, condicoes.jitterMs, condicoes.perda * 100.0f, segundos,
+                Partida::TICKS_POR_SEGUNDO);
+
+    const auto duracaoTick = std::chrono::duration_cast<relogio::duration>(std::chrono::duration<double>(Partida::TICK));
+    auto inicio = relogio::now();
+    auto proximoTick = inicio;
+
+    // 1. Jogo normal
+    while (std::chrono::duration<double>(relogio::now() - inicio).count() < segundos) {
+        std::this_thread::sleep_until(proximoTick);
+        proximoTick += duracaoTick;
+        for (Ponta& p : pontas) p.tick(true);
+    }
+
+    // 2. As duas param no mesmo tick e trocam pacotes até confirmar tudo
+    uint32_t alvo = pontas[0].sessao.getTick() > pontas[1].sessao.getTick() ? pontas[0].sessao.getTick()
+                                                                            : pontas[1].sessao.getTick();
+    auto limite = relogio::now() + std::chrono::seconds(10);
+    while (!(pontas[0].sincronizada(alvo) && pontas[1].sincronizada(alvo))) {
+        if (relogio::now() > limite) {
+            std::fprintf(stderr, "ERRO: as pontas não sincronizaram em 10 s (ticks %u/%u, confirmados %u/%u)\n",
+                         pontas[0].sessao.getTick(), pontas[1].sessao.getTick(),
+                         pontas[0].sessao.getConfirmados(), pontas[1].sessao.getConfirmados());
+            return 1;
+        }
+        std::this_thread::sleep_until(proximoTick);
+        proximoTick += duracaoTick;
+        for (Ponta& p : pontas) p.tick(p.sessao.getTick() < alvo);
+    }
+
+    std::printf("\n%8s %10s %12s %10s %10s %10s %12s %10s\n", "ponta", "rollbacks", "resimulados",
+                "media", "maior", "previstos", "parados", "pior ms");
+    for (const Ponta& p : pontas) {
+        const EstatisticasRollback& e = p.sessao.getEstatisticas();
+        std::printf("%8d %10llu %12llu %10.2f %10u %10llu %12llu %10.3f\n", p.jogador,
+                    static_cast<unsigned long long>(e.rollbacks),
+                    static_cast<unsigned long long>(e.ticksResimulados),
+                    e.rollbacks ? static_cast<double>(e.ticksResimulados) / e.rollbacks : 0.0,
+                    e.maiorRollback, static_cast<unsigned long long>(e.ticksPrevistos),
+                    static_cast<unsigned long long>(e.ticksParados), p.maiorQuadroMs);
+    }
+    std::printf("Pacotes: %llu/%llu enviados, %llu/%llu descartados pelo simulador\n",
+                static_cast<unsigned long long>(pontas[0].transporte.getEnviados()),
+                static_cast<unsigned long long>(pontas[1].transporte.getEnviados()),
+                static_cast<unsigned long long>(pontas[0].transporte.getDescartados()),
+                static_cast<unsigned long long>(pontas[1].transporte.getDescartados()));
+
+    uint64_t c0 = pontas[0].sessao.getPartida().checksum();
+    uint64_t c1 = pontas[1].sessao.getPartida().checksum();
+    const EstadoPartida& estado = pontas[0].sessao.getPartida().getEstado();
+    std::printf("Tick %u, placar %u x %u, checksums %016llx / %016llx\n", alvo, estado.placar[0], estado.placar[1],
+                static_cast<unsigned long long>(c0), static_cast<unsigned long long>(c1));
+
+    medirSnapshots();
+
+    if (c0 != c1) {
+        std::printf("ERRO: as pontas divergiram\n");
+        return 1;
+    }
+    std::printf("OK: as duas pontas chegaram ao mesmo estado\n");
+    return 0;
+}
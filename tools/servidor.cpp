@@ -0,0 +1,138 @@
+/**
+ * @file servidor.cpp
+ * @brief Servidor de partidas sem janela: milhares de partidas por processo
+ *
+ * Mantém N partidas simultâneas (cada uma que termina é substituída por
+ * uma nova) e avança todas a cada tick no SistemaJobs. As entradas vêm de
+ * dois OponenteIA por partida, com latência e erro diferentes em cada uma.
+ *
+ * Sem --tempo-real, os ticks rodam um atrás do outro e o resultado é a
+ * capacidade da máquina; com --tempo-real, o servidor dorme até o próximo
+ * tick de 1/120 s como faria em produção e mostra a folga de cada tick.
+ *
+ * Uso: ./servidor_app [partidas=4096] [segundos=5] [--tempo-real]
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "core/SistemaJobs.hpp"
+#include "jogo/OponenteIA.hpp"
+#include "jogo/Partida.hpp"
+#include "jogo/ServidorPartidas.hpp"
+
+/// Dois OponenteIA por partida, indexados pelo id (cada job só toca os da sua partida)
+static uint8_t jogadorAutomatico(void* contexto, uint32_t idPartida, const EstadoPartida& e) {
+    std::vector<OponenteIA>& ias = *static_cast<std::vector<OponenteIA>*>(contexto);
+    return ias[2 * idPartida].decidir(e) | ias[2 * idPartida + 1].decidir(e);
+}
+
+/// Jogadores novos para uma partida recém-criada (latência e erro variam entre partidas)
+static void novosJogadores(std::vector<OponenteIA>& ias, uint32_t idPartida) {
+    if (ias.size() < 2 * (idPartida + 1)) ias.resize(2 * (idPartida + 1));
+    for (int jogador = 0; jogador < 2; jogador++) {
+        ConfigIA config;
+        config.jogador = jogador;
+        config.semente = idPartida * 2654435761u + jogador + 1;
+        config.latenciaTicks = 4 + config.semente % 12;
+        config.erro = 0.1f + (config.semente >> 8) % 8 * 0.04f;
+        ias[2 * idPartida + jogador] = OponenteIA(config);
+    }
+}
+
+int main(int argc, char** argv) {
+    size_t numPartidas = 4096;
+    double segundos = 5.0;
+    bool tempoReal = false;
+    int posicional = 0;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--tempo-real") == 0) {
+            tempoReal = true;
+        } else if (posicional == 0) {
+            numPartidas = std::strtoul(argv[i], nullptr, 10);
+            posicional++;
+        } else {
+            segundos = std::atof(argv[i]);
+            posicional++;
+        }
+    }
+
+    SistemaJobs jobs;
+    ServidorPartidas servidor(11, 12345);
+    std::vector<OponenteIA> ias;
+    ias.reserve(2 * numPartidas);
+    for (size_t i = 0; i < numPartidas; i++) novosJogadores(ias, servidor.criarPartida());
+
+    std::printf("Servidor: %zu partidas, %u threads, %zu bytes por partida (%.1f KB no total), %s\n",
+                numPartidas, jobs.getNumThreads(), ServidorPartidas::bytesPorPartida(),
+                numPartidas * ServidorPartidas::bytesPorPartida() / 1024.0,
+                tempoReal ? "tempo real (120 Hz)" : "velocidade máxima");
+    std::printf("%6s %10s %14s %12s %12s %10s\n", "tempo", "ativas", "partida-tick/s", "ms/tick med", "ms/tick max", "concluidas");
+
+    using relogio = std::chrono::steady_clock;
+    const auto duracaoTick = std::chrono::duration_cast<relogio::duration>(std::chrono::duration<double>(Partida::TICK));
+    auto inicio = relogio::now();
+    auto proximoTick = inicio;
+    auto inicioJanela = inicio;
+
+    uint64_t ticksJanela = 0;
+    uint64_t partidaTicksJanela = 0;
+    double somaTickJanela = 0.0;
+    double maxTickJanela = 0.0;
+    uint64_t ticksTotal = 0;
+    uint64_t partidaTicksTotal = 0;
+    double somaTickTotal = 0.0;
+    int segundoAtual = 0;
+
+    while (std::chrono::duration<double>(relogio::now() - inicio).count() < segundos) {
+        if (tempoReal) {
+            std::this_thread::sleep_until(proximoTick);
+            proximoTick += duracaoTick;
+        }
+
+        size_t ativas = servidor.getNumAtivas();
+        auto t0 = relogio::now();
+        size_t terminaram = servidor.passo(&jobs, &jogadorAutomatico, &ias);
+        double duracao = std::chrono::duration<double>(relogio::now() - t0).count();
+
+        // Mantém o número de partidas simultâneas
+        for (size_t i = 0; i < terminaram; i++) novosJogadores(ias, servidor.criarPartida());
+
+        ticksJanela++;
+        partidaTicksJanela += ativas;
+        somaTickJanela += duracao;
+        if (duracao > maxTickJanela) maxTickJanela = duracao;
+
+        // Uma linha por segundo
+        double janela = std::chrono::duration<double>(relogio::now() - inicioJanela).count();
+        if (janela >= 1.0) {
+            segundoAtual++;
+            std::printf("%5ds %10zu %14.0f %12.4f %12.4f %10llu\n", segundoAtual, servidor.getNumAtivas(),
+                        partidaTicksJanela / janela, somaTickJanela * 1000.0 / ticksJanela,
+                        maxTickJanela * 1000.0, static_cast<unsigned long long>(servidor.getPartidasConcluidas()));
+            ticksTotal += ticksJanela;
+            partidaTicksTotal += partidaTicksJanela;
+            somaTickTotal += somaTickJanela;
+            ticksJanela = partidaTicksJanela = 0;
+            somaTickJanela = maxTickJanela = 0.0;
+            inicioJanela = relogio::now();
+        }
+    }
+    ticksTotal += ticksJanela;
+    partidaTicksTotal += partidaTicksJanela;
+    somaTickTotal += somaTickJanela;
+
+    // Quantas partidas caberiam usando o tick inteiro de 1/120 s
+    double segundosPorPartidaTick = partidaTicksTotal ? somaTickTotal / partidaTicksTotal : 0.0;
+    double capacidade = segundosPorPartidaTick > 0.0 ? Partida::TICK / segundosPorPartidaTick : 0.0;
+    std::printf("\nTicks: %llu | partidas concluídas: %llu | roubos de lote: %zu\n",
+                static_cast<unsigned long long>(ticksTotal),
+                static_cast<unsigned long long>(servidor.getPartidasConcluidas()), jobs.getRoubos());
+    std::printf("Custo: %.1f ns por partida-tick -> capacidade estimada de %.0f partidas a %u Hz\n",
+                segundosPorPartidaTick * 1e9, capacidade, Partida::TICKS_POR_SEGUNDO);
+    return 0;
+}